@@ -360,7 +360,7 @@ void dig_activity_actor::finish( player_activity &act, Character &who )
         here.place_items( "jewelry_front", 20, location, location, false, calendar::turn );
         for( item * const &it : dropped ) {
             if( it->is_armor() ) {
-                it->item_tags.insert( "FILTHY" );
+                it->set_flag( "FILTHY" );
                 it->set_damage( rng( 1, it->max_damage() - 1 ) );
             }
         }
@@ -753,10 +753,10 @@ void move_items_activity_actor::do_turn( player_activity &act, Character &who )
             item newit = leftovers;
             // Handle charges, quantity == 0 means move all
             if( quantity != 0 && newit.count_by_charges() ) {
-                newit.charges = std::min( newit.charges, quantity );
-                leftovers.charges -= quantity;
+                newit.set_charges( std::min( newit.charges, quantity ) );
+                leftovers.set_charges( leftovers.charges - quantity );
             } else {
-                leftovers.charges = 0;
+                leftovers.set_charges( 0 );
             }
 
             // This is for hauling across zlevels, remove when going up and down stairs
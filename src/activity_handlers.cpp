@@ -1560,7 +1560,7 @@ void activity_handlers::fill_liquid_do_turn( player_activity *act, player *p )
                 break;
             case liquid_source_type::INFINITE_MAP:
                 deserialize( liquid, act_ref.str_values.at( 0 ) );
-                liquid.charges = item::INFINITE_CHARGES;
+                liquid.set_charges( item::INFINITE_CHARGES );
                 break;
             case liquid_source_type::MAP_ITEM:
                 if( static_cast<size_t>( act_ref.values.at( 1 ) ) >= source_stack.size() ) {
@@ -1578,13 +1578,13 @@ void activity_handlers::fill_liquid_do_turn( player_activity *act, player *p )
                     act_ref.set_to_null();
                 }
                 deserialize( liquid, act_ref.str_values.at( 0 ) );
-                liquid.charges = 1;
+                liquid.set_charges( 1 );
                 break;
         }
 
         static const units::volume volume_per_second = units::from_liter( 4.0F / 6.0F );
         const int charges_per_second = std::max( 1, liquid.charges_per_volume( volume_per_second ) );
-        liquid.charges = std::min( charges_per_second, liquid.charges );
+        liquid.set_charges( std::min( charges_per_second, liquid.charges ) );
         const int original_charges = liquid.charges;
         if( liquid.has_temperature() && liquid.specific_energy < 0 ) {
             liquid.set_item_temperature( temp_to_kelvin( std::max( get_weather().get_temperature( p->pos() ),
@@ -1609,11 +1609,11 @@ void activity_handlers::fill_liquid_do_turn( player_activity *act, player *p )
                 } else {
                     here.add_item_or_charges( act_ref.coords.at( 1 ), liquid );
                     p->add_msg_if_player( _( "You pour %1$s onto the ground." ), liquid.tname() );
-                    liquid.charges = 0;
+                    liquid.set_charges( 0 );
                 }
                 break;
             case liquid_target_type::MONSTER:
-                liquid.charges = 0;
+                liquid.set_charges( 0 );
                 break;
         }
 
@@ -1629,7 +1629,7 @@ void activity_handlers::fill_liquid_do_turn( player_activity *act, player *p )
             case liquid_source_type::VEHICLE:
                 if( part_num != -1 ) {
                     source_veh->drain( part_num, removed_charges );
-                    liquid.charges = veh_charges - removed_charges;
+                    liquid.set_charges( veh_charges - removed_charges );
                     // If there's no liquid left in this tank we're done, otherwise
                     // we need to update our liquid serialization to reflect how
                     // many charges are actually left for the next time we come
@@ -1650,7 +1650,7 @@ void activity_handlers::fill_liquid_do_turn( player_activity *act, player *p )
                 }
                 break;
             case liquid_source_type::MAP_ITEM:
-                on_ground->charges -= removed_charges;
+                on_ground->set_charges( on_ground->charges - removed_charges );
                 if( on_ground->charges <= 0 ) {
                     source_stack.erase( on_ground );
                     if( here.ter( source_pos ).obj().examine == &iexamine::gaspump ) {
@@ -1909,7 +1909,7 @@ void activity_handlers::pickaxe_finish( player_activity *act, player *p )
                               _( "You finish digging." ),
                               _( "<npcname> finishes digging." ) );
     here.destroy( pos, true );
-    it.charges = std::max( 0, it.charges - it.type->charges_to_use() );
+    it.set_charges( std::max( 0, it.charges - it.type->charges_to_use() ) );
     if( it.charges == 0 && it.destroyed_at_zero_charges() ) {
         p->i_rem( &it );
     }
@@ -2775,7 +2775,7 @@ void activity_handlers::heat_item_finish( player_activity *act, player *p )
         return;
     }
     item &target = *food;
-    if( target.item_tags.count( "FROZEN" ) ) {
+    if( target.has_own_flag( "FROZEN" ) ) {
         target.apply_freezerburn();
         if( target.has_flag( flag_EATEN_COLD ) ) {
             target.cold_up();
@@ -2912,7 +2912,7 @@ void activity_handlers::toolmod_add_finish( player_activity *act, player *p )
     item &mod = *act->targets[1];
     p->add_msg_if_player( m_good, _( "You successfully attached the %1$s to your %2$s." ),
                           mod.tname(), tool.tname() );
-    mod.item_tags.insert( "IRREMOVABLE" );
+    mod.set_flag( "IRREMOVABLE" );
     tool.put_in( mod, item_pocket::pocket_type::MOD );
     act->targets[1].remove_item();
 }
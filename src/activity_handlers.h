@@ -100,6 +100,8 @@ int butcher_time_to_cut( const player &u, const item &corpse_item, butcher_type
 // activity_item_handling.cpp
 void activity_on_turn_drop();
 void activity_on_turn_move_loot( player_activity &act, player &p );
+// forgets the loot sorting plans, they refer to the characters and map of the current game
+void clear_loot_sort_plans();
 //return true if there is an activity that can be done potentially, return false if no work can be found.
 bool generic_multi_activity_handler( player_activity &act, player &p, bool check_only = false );
 void activity_on_turn_fetch( player_activity &, player *p );
@@ -1,12 +1,17 @@
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <climits>
 #include <cmath>
 #include <cstdlib>
 #include <list>
+#include <map>
 #include <memory>
+#include <queue>
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -14,6 +19,7 @@
 #include "activity_type.h"
 #include "avatar.h"
 #include "calendar.h"
+#include "cata_utility.h"
 #include "character.h"
 #include "clzones.h"
 #include "colony.h"
@@ -111,6 +117,7 @@ static const zone_type_id zone_type_CONSTRUCTION_BLUEPRINT( "CONSTRUCTION_BLUEPR
 static const zone_type_id zone_type_FARM_PLOT( "FARM_PLOT" );
 static const zone_type_id zone_type_FISHING_SPOT( "FISHING_SPOT" );
 static const zone_type_id zone_type_LOOT_CORPSE( "LOOT_CORPSE" );
+static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
 static const zone_type_id zone_type_LOOT_IGNORE( "LOOT_IGNORE" );
 static const zone_type_id zone_type_MINING( "MINING" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
@@ -127,17 +134,18 @@ static const quality_id qual_SAW_M( "SAW_M" );
 static const quality_id qual_SAW_W( "SAW_W" );
 static const quality_id qual_WELD( "WELD" );
 
-static const std::string flag_BUTCHER_EQ( "BUTCHER_EQ" );
-static const std::string flag_DIG_TOOL( "DIG_TOOL" );
-static const std::string flag_FISHABLE( "FISHABLE" );
-static const std::string flag_FISH_GOOD( "FISH_GOOD" );
-static const std::string flag_FISH_POOR( "FISH_POOR" );
-static const std::string flag_GROWTH_HARVEST( "GROWTH_HARVEST" );
-static const std::string flag_PLANT( "PLANT" );
-static const std::string flag_PLANTABLE( "PLANTABLE" );
-static const std::string flag_PLOWABLE( "PLOWABLE" );
-static const std::string flag_POWERED( "POWERED" );
-static const std::string flag_TREE( "TREE" );
+static const flag_id flag_BUTCHER_EQ( "BUTCHER_EQ" );
+static const flag_id flag_DIG_TOOL( "DIG_TOOL" );
+static const flag_id flag_DOOR( "DOOR" );
+static const flag_id flag_FISHABLE( "FISHABLE" );
+static const flag_id flag_FISH_GOOD( "FISH_GOOD" );
+static const flag_id flag_FISH_POOR( "FISH_POOR" );
+static const flag_id flag_GROWTH_HARVEST( "GROWTH_HARVEST" );
+static const flag_id flag_PLANT( "PLANT" );
+static const flag_id flag_PLANTABLE( "PLANTABLE" );
+static const flag_id flag_PLOWABLE( "PLOWABLE" );
+static const flag_id flag_POWERED( "POWERED" );
+static const flag_id flag_TREE( "TREE" );
 
 void cancel_aim_processing();
 //Generic activity: maximum search distance for zones, constructions, etc.
@@ -542,12 +550,12 @@ void activity_on_turn_wear( player_activity &act, player &p )
 
         // Handle charges, quantity == 0 means move all
         if( quantity != 0 && newit.count_by_charges() ) {
-            leftovers.charges = newit.charges - quantity;
+            leftovers.set_charges( newit.charges - quantity );
             if( leftovers.charges > 0 ) {
-                newit.charges = quantity;
+                newit.set_charges( quantity );
             }
         } else {
-            leftovers.charges = 0;
+            leftovers.set_charges( 0 );
         }
 
         if( p.wear_item( newit ) ) {
@@ -600,7 +608,7 @@ void activity_handlers::washing_finish( player_activity *act, player *p )
 
     for( const act_item &ait : items ) {
         item *filthy_item = const_cast<item *>( &*ait.loc );
-        filthy_item->item_tags.erase( "FILTHY" );
+        filthy_item->unset_flag( "FILTHY" );
         p->on_worn_item_washed( *filthy_item );
     }
 
@@ -796,12 +804,12 @@ static void move_item( player &p, item &it, const int quantity, const tripoint &
 
     if( quantity != 0 && it.count_by_charges() ) {
         // Reinserting leftovers happens after item removal to avoid stacking issues.
-        leftovers.charges = it.charges - quantity;
+        leftovers.set_charges( it.charges - quantity );
         if( leftovers.charges > 0 ) {
-            it.charges = quantity;
+            it.set_charges( quantity );
         }
     } else {
-        leftovers.charges = 0;
+        leftovers.set_charges( 0 );
     }
 
     map &here = get_map();
@@ -1076,12 +1084,12 @@ static bool are_requirements_nearby( const std::vector<tripoint> &loot_spots,
                 const cata::optional<vpart_reference> weldpart = vp.part_with_feature( "WELDRIG", true );
                 if( weldpart ) {
                     item welder( itype_welder, 0 );
-                    welder.charges = veh.fuel_left( itype_battery, true );
-                    welder.item_tags.insert( "PSEUDO" );
+                    welder.set_charges( veh.fuel_left( itype_battery, true ) );
+                    welder.set_flag( "PSEUDO" );
                     temp_inv.add_item( welder );
                     item soldering_iron( itype_soldering_iron, 0 );
-                    soldering_iron.charges = veh.fuel_left( itype_battery, true );
-                    soldering_iron.item_tags.insert( "PSEUDO" );
+                    soldering_iron.set_charges( veh.fuel_left( itype_battery, true ) );
+                    soldering_iron.set_flag( "PSEUDO" );
                     temp_inv.add_item( soldering_iron );
                 }
             }
@@ -1235,7 +1243,7 @@ static activity_reason_info can_do_activity_there( const activity_id &act, playe
         return activity_reason_info::fail( do_activity_reason::NO_ZONE );
     }
     if( act == ACT_MULTIPLE_MINE ) {
-        if( !here.has_flag( "MINEABLE", src_loc ) ) {
+        if( !here.has_flag( TFLAG_MINEABLE, src_loc ) ) {
             return activity_reason_info::fail( do_activity_reason::NO_ZONE );
         }
         std::vector<item *> mining_inv = p.items_with( []( const item & itm ) {
@@ -1870,12 +1878,12 @@ static bool fetch_activity( player &p, const tripoint &src_loc,
                     item leftovers = it;
                     if( pickup_count != 1 && it.count_by_charges() ) {
                         // Reinserting leftovers happens after item removal to avoid stacking issues.
-                        leftovers.charges = it.charges - pickup_count;
+                        leftovers.set_charges( it.charges - pickup_count );
                         if( leftovers.charges > 0 ) {
-                            it.charges = pickup_count;
+                            it.set_charges( pickup_count );
                         }
                     } else {
-                        leftovers.charges = 0;
+                        leftovers.set_charges( 0 );
                     }
                     it.set_var( "activity_var", p.name );
                     p.i_add( it );
@@ -1950,6 +1958,187 @@ static bool chop_plank_activity( player &p, const tripoint &src_loc )
     return false;
 }
 
+namespace
+{
+
+/** An item on a loot source tile and the zone it belongs in. */
+struct loot_sort_assignment {
+    safe_reference<item> it;
+    zone_type_id zone;
+    /** The item already is in its zone and stays where it is. */
+    bool stays = false;
+};
+
+/** A loot source tile with the items found there when planning. */
+struct loot_sort_trip {
+    tripoint src;
+    std::vector<loot_sort_assignment> items;
+};
+
+/** The tiles of a destination zone, nearest first. */
+struct loot_sort_destination {
+    std::vector<tripoint> tiles;
+    /** Some tiles are also in a custom loot zone, which only takes the items it matches. */
+    bool has_custom_tiles = false;
+};
+
+/**
+ * The work of one ACT_MOVE_LOOT run, planned once when it starts: the reachable source tiles
+ * that have anything to sort, the destination zone of each of their items and, looked up once
+ * per zone, the destination tiles ordered by walking distance from where sorting started.
+ */
+struct loot_sort_plan {
+    tripoint origin;
+    std::vector<loot_sort_trip> trips;
+    /** Trips before this index have been made. */
+    size_t trips_done = 0;
+    /** Walking distance in steps from @ref origin, by absolute position. */
+    std::unordered_map<tripoint, int> distance;
+    std::map<zone_type_id, loot_sort_destination> destinations;
+
+    std::chrono::steady_clock::duration planning_time = std::chrono::steady_clock::duration::zero();
+    std::chrono::steady_clock::duration executing_time = std::chrono::steady_clock::duration::zero();
+};
+
+} // namespace
+
+/** Plans of the characters sorting loot right now. */
+static std::map<character_id, loot_sort_plan> loot_sort_plans;
+
+void clear_loot_sort_plans()
+{
+    loot_sort_plans.clear();
+}
+
+// Walking distance from a point over the tiles within range, closed doors count as open.
+static std::unordered_map<tripoint, int> loot_sort_distance_field( const map &here,
+        const tripoint &from, int range )
+{
+    std::unordered_map<tripoint, int> distance;
+    std::queue<tripoint> open;
+    distance.emplace( here.getabs( from ), 0 );
+    open.push( from );
+    while( !open.empty() ) {
+        const tripoint cur = open.front();
+        open.pop();
+        const int next_distance = distance[here.getabs( cur )] + 1;
+        for( const tripoint &next : here.points_in_radius( cur, 1 ) ) {
+            if( square_dist( next, from ) > range ||
+                ( !here.passable( next ) && !here.has_flag( flag_DOOR, next ) ) ) {
+                continue;
+            }
+            if( distance.emplace( here.getabs( next ), next_distance ).second ) {
+                open.push( next );
+            }
+        }
+    }
+    return distance;
+}
+
+// Impassable source tiles (lockers etc.) are sorted from an adjacent tile.
+static bool loot_sort_reachable( const loot_sort_plan &plan, const map &here,
+                                 const tripoint &src_loc )
+{
+    if( here.passable( src_loc ) ) {
+        return plan.distance.count( here.getabs( src_loc ) ) > 0;
+    }
+    for( const tripoint &p : here.points_in_radius( src_loc, 1 ) ) {
+        if( plan.distance.count( here.getabs( p ) ) > 0 ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static loot_sort_plan plan_loot_sort( player &p, const std::unordered_set<tripoint> &sources )
+{
+    const auto start = std::chrono::steady_clock::now();
+    map &here = get_map();
+    const zone_manager &mgr = zone_manager::get_manager();
+
+    loot_sort_plan plan;
+    plan.origin = here.getabs( p.pos() );
+    plan.distance = loot_sort_distance_field( here, p.pos(), ACTIVITY_SEARCH_DISTANCE );
+
+    for( const tripoint &src : sources ) {
+        const tripoint src_loc = here.getlocal( src );
+        loot_sort_trip trip;
+        trip.src = src;
+        if( !here.inbounds( src_loc ) ) {
+            // Dealt with when the trip is made.
+            plan.trips.emplace_back( std::move( trip ) );
+            continue;
+        }
+        if( mgr.has( zone_type_LOOT_IGNORE, src ) ) {
+            continue;
+        }
+
+        bool anything_to_move = false;
+        const auto assign = [&]( item & it ) {
+            // skip unpickable liquid
+            if( it.made_of_from_type( phase_id::LIQUID ) ) {
+                return;
+            }
+            loot_sort_assignment assignment;
+            assignment.it = it.get_safe_reference();
+            assignment.zone = mgr.get_near_zone_type_for_item( it, plan.origin,
+                              ACTIVITY_SEARCH_DISTANCE );
+            assignment.stays = mgr.has( assignment.zone, src );
+            anything_to_move = anything_to_move || !assignment.stays;
+            trip.items.emplace_back( std::move( assignment ) );
+        };
+        if( const cata::optional<vpart_reference> vp = here.veh_at( src_loc ).part_with_feature( "CARGO",
+                false ) ) {
+            for( item &it : vp->vehicle().get_items( vp->part_index() ) ) {
+                assign( it );
+            }
+        }
+        for( item &it : here.i_at( src_loc ) ) {
+            assign( it );
+        }
+        if( !anything_to_move ) {
+            continue;
+        }
+
+        if( !loot_sort_reachable( plan, here, src_loc ) ) {
+            add_msg( m_info, _( "%s can't reach the source tile.  Try to sort out loot without a cart." ),
+                     p.disp_name() );
+            continue;
+        }
+        plan.trips.emplace_back( std::move( trip ) );
+    }
+
+    plan.planning_time += std::chrono::steady_clock::now() - start;
+    return plan;
+}
+
+static const loot_sort_destination &loot_sort_destinations( loot_sort_plan &plan,
+        const zone_type_id &zone )
+{
+    const auto iter = plan.destinations.find( zone );
+    if( iter != plan.destinations.end() ) {
+        return iter->second;
+    }
+
+    const zone_manager &mgr = zone_manager::get_manager();
+    const std::unordered_set<tripoint> dest_set = mgr.get_near( zone, plan.origin,
+            ACTIVITY_SEARCH_DISTANCE );
+    loot_sort_destination &dest = plan.destinations[zone];
+    dest.tiles.assign( dest_set.begin(), dest_set.end() );
+    const auto walking_distance = [&plan]( const tripoint & p ) {
+        const auto found = plan.distance.find( p );
+        return found != plan.distance.end() ? found->second : INT_MAX;
+    };
+    std::sort( dest.tiles.begin(), dest.tiles.end(), [&]( const tripoint & a, const tripoint & b ) {
+        return walking_distance( a ) < walking_distance( b );
+    } );
+    dest.has_custom_tiles = std::any_of( dest.tiles.begin(), dest.tiles.end(),
+    [&mgr]( const tripoint & p ) {
+        return mgr.has( zone_type_LOOT_CUSTOM, p );
+    } );
+    return dest;
+}
+
 void activity_on_turn_move_loot( player_activity &act, player &p )
 {
     enum activity_stage : int {
@@ -1973,23 +2162,53 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
     map &here = get_map();
     const tripoint abspos = here.getabs( p.pos() );
     auto &mgr = zone_manager::get_manager();
-    if( here.check_vehicle_zones( here.get_abs_sub().z ) ) {
+    const bool vzones_moved = here.check_vehicle_zones( here.get_abs_sub().z );
+    if( vzones_moved ) {
         mgr.cache_vzones();
     }
 
+    // Everything but planning counts as carrying out the plan.
+    const auto turn_start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration planned_this_turn = std::chrono::steady_clock::duration::zero();
+    const character_id who = p.getID();
+    on_out_of_scope account_time( [&]() {
+        const auto iter = loot_sort_plans.find( who );
+        if( iter != loot_sort_plans.end() ) {
+            iter->second.executing_time += std::chrono::steady_clock::now() - turn_start -
+                                           planned_this_turn;
+        }
+    } );
+
     if( stage == INIT ) {
         act.coord_set = mgr.get_near( zone_type_LOOT_UNSORTED, abspos, ACTIVITY_SEARCH_DISTANCE );
+        loot_sort_plans.erase( who );
         stage = THINK;
     }
 
+    auto plan_iter = loot_sort_plans.find( who );
+    if( plan_iter == loot_sort_plans.end() ) {
+        // A new run, or a run resumed from a save: plan what is left of it.
+        plan_iter = loot_sort_plans.emplace( who, plan_loot_sort( p, act.coord_set ) ).first;
+        planned_this_turn = plan_iter->second.planning_time;
+    }
+    loot_sort_plan &plan = plan_iter->second;
+    if( vzones_moved ) {
+        plan.destinations.clear();
+    }
+
     if( stage == THINK ) {
         //initialize num_processed
         num_processed = 0;
-        const auto &src_set = act.coord_set;
-        // sort source tiles by distance
-        const auto &src_sorted = get_sorted_tiles_by_distance( abspos, src_set );
+        while( plan.trips_done < plan.trips.size() ) {
+            // go to the nearest source tile next
+            const auto next = std::min_element( plan.trips.begin() + plan.trips_done, plan.trips.end(),
+            [&abspos]( const loot_sort_trip & a, const loot_sort_trip & b ) {
+                return rl_dist( abspos, a.src ) < rl_dist( abspos, b.src );
+            } );
+            std::swap( *next, plan.trips[plan.trips_done] );
+            const tripoint src = plan.trips[plan.trips_done].src;
+            plan.trips_done++;
 
-        for( const tripoint &src : src_sorted ) {
             act.placement = src;
             act.coord_set.erase( src );
 
@@ -1998,6 +2217,7 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
                 if( !here.inbounds( p.pos() ) ) {
                     // p is implicitly an NPC that has been moved off the map, so reset the activity
                     // and unload them
+                    loot_sort_plans.erase( plan_iter );
                     p.cancel_activity();
                     p.assign_activity( ACT_MOVE_LOOT );
                     p.set_moves( 0 );
@@ -2017,11 +2237,9 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
                 return;
             }
 
-            // skip tiles in IGNORE zone and tiles on fire
-            // (to prevent taking out wood off the lit brazier)
+            // skip tiles on fire (to prevent taking out wood off the lit brazier)
             // and inaccessible furniture, like filled charcoal kiln
-            if( mgr.has( zone_type_LOOT_IGNORE, src ) ||
-                here.get_field( src_loc, fd_fire ) != nullptr ||
+            if( here.get_field( src_loc, fd_fire ) != nullptr ||
                 !here.can_put_items_ter_furn( src_loc ) ) {
                 continue;
             }
@@ -2090,6 +2308,20 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
             return;
         }
 
+        // zones of the items found here when planning, items put here since are assigned below
+        std::unordered_map<const item *, const loot_sort_assignment *> planned;
+        for( const loot_sort_trip &trip : plan.trips ) {
+            if( trip.src != src ) {
+                continue;
+            }
+            for( const loot_sort_assignment &assignment : trip.items ) {
+                if( assignment.it ) {
+                    planned.emplace( assignment.it.get(), &assignment );
+                }
+            }
+            break;
+        }
+
         // the boolean in this pair being true indicates the item is from a vehicle storage space
         auto items = std::vector<std::pair<item *, bool>>();
         vehicle *src_veh, *dest_veh;
@@ -2127,19 +2359,30 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
             vehicle *this_veh = it->second ? src_veh : nullptr;
             const int this_part = it->second ? src_part : -1;
 
-            const zone_type_id id = mgr.get_near_zone_type_for_item( thisitem, abspos,
-                                    ACTIVITY_SEARCH_DISTANCE );
-
             // checks whether the item is already on correct loot zone or not
             // if it is, we can skip such item, if not we move the item to correct pile
             // think empty bag on food pile, after you ate the content
-            if( mgr.has( id, src ) ) {
-                continue;
+            zone_type_id id;
+            const auto planned_iter = planned.find( &thisitem );
+            if( planned_iter != planned.end() ) {
+                if( planned_iter->second->stays ) {
+                    continue;
+                }
+                id = planned_iter->second->zone;
+            } else {
+                id = mgr.get_near_zone_type_for_item( thisitem, plan.origin, ACTIVITY_SEARCH_DISTANCE );
+                if( mgr.has( id, src ) ) {
+                    continue;
+                }
             }
 
-            const std::unordered_set<tripoint> &dest_set = mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE,
-                    &thisitem );
-            for( const tripoint &dest : dest_set ) {
+            const loot_sort_destination &dest_zone = loot_sort_destinations( plan, id );
+            for( const tripoint &dest : dest_zone.tiles ) {
+                // custom loot zones only take the items matching their filter
+                if( dest_zone.has_custom_tiles && mgr.has( zone_type_LOOT_CUSTOM, dest ) &&
+                    !mgr.custom_loot_has( dest, &thisitem ) ) {
+                    continue;
+                }
                 const tripoint &dest_loc = here.getlocal( dest );
 
                 //Check destination for cargo part
@@ -2187,6 +2430,14 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
     }
 
     // If we got here without restarting the activity, it means we're done
+    const auto to_ms = []( std::chrono::steady_clock::duration d ) {
+        return std::chrono::duration<double, std::milli>( d ).count();
+    };
+    add_msg( m_debug, "Loot sorting: planned %d trips in %.1f ms, carried them out in %.1f ms",
+             static_cast<int>( plan.trips.size() ), to_ms( plan.planning_time ),
+             to_ms( plan.executing_time + std::chrono::steady_clock::now() - turn_start -
+                    planned_this_turn ) );
+    loot_sort_plans.erase( plan_iter );
     add_msg( m_info, _( "%s sorted out every item possible." ), p.disp_name( false, true ) );
     if( p.is_npc() ) {
         npc *guy = dynamic_cast<npc *>( &p );
@@ -2217,7 +2468,7 @@ static bool mine_activity( player &p, const tripoint &src_loc )
     } );
     map &here = get_map();
     if( mining_inv.empty() || p.is_mounted() || p.is_underwater() || here.veh_at( src_loc ) ||
-        !here.has_flag( "MINEABLE", src_loc ) || p.has_effect( effect_incorporeal ) ) {
+        !here.has_flag( TFLAG_MINEABLE, src_loc ) || p.has_effect( effect_incorporeal ) ) {
         return false;
     }
     item *chosen_item = nullptr;
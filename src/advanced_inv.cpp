@@ -1374,7 +1374,7 @@ bool advanced_inventory::action_move_item( advanced_inv_listitem *sitem,
         bool can_stash = false;
         if( sitem->items.front()->count_by_charges() ) {
             item dummy = *sitem->items.front();
-            dummy.charges = amount_to_move;
+            dummy.set_charges( amount_to_move );
             can_stash = player_character.can_stash( dummy );
         } else {
             can_stash = player_character.can_stash( *sitem->items.front() );
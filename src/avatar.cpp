@@ -129,6 +129,111 @@ avatar::avatar()
     calorie_diary.push_front( daily_calories{} );
 }
 
+// Bumped by invalidate_visible_creatures, 0 is never valid.
+static unsigned long long visible_creatures_generation_counter = 1;
+
+void avatar::invalidate_visible_creatures()
+{
+    ++visible_creatures_generation_counter;
+}
+
+void avatar::update_visible_creatures()
+{
+    const bool blind = is_blind();
+    if( visible_creatures_generation == visible_creatures_generation_counter &&
+        visible_creatures_turn == calendar::turn && visible_creatures_pos == pos() &&
+        visible_creatures_blind == blind ) {
+        for( visible_creature &seen : visible_creatures_cache ) {
+            seen.attitude = attitude_to( *seen.critter );
+        }
+        for( visible_creature &seen : infrared_creatures_cache ) {
+            seen.attitude = attitude_to( *seen.critter );
+        }
+        return;
+    }
+    visible_creatures_generation = visible_creatures_generation_counter;
+    visible_creatures_turn = calendar::turn;
+    visible_creatures_pos = pos();
+    visible_creatures_blind = blind;
+
+    const std::vector<Creature *> nearby = g->get_creatures_if( [this]( const Creature & critter ) {
+        // TODO: get rid of fake npcs (pos() check)
+        return this != &critter && pos() != critter.pos() && rl_dist( pos(), critter.pos() ) <= MAPSIZE_X;
+    } );
+    visible_creatures_cache.clear();
+    infrared_creatures_cache.clear();
+    for( Creature *c : nearby ) {
+        std::vector<visible_creature> *cache = &visible_creatures_cache;
+        if( !sees( *c ) ) {
+            if( !sees_with_infrared( *c ) ) {
+                continue;
+            }
+            cache = &infrared_creatures_cache;
+        }
+        visible_creature seen;
+        seen.critter = c;
+        seen.mon = c->as_monster();
+        seen.guy = c->is_npc() ? static_cast<npc *>( c ) : nullptr;
+        seen.dir = direction_from( pos().xy(), c->pos().xy() );
+        seen.distance = rl_dist( pos(), c->pos() );
+        seen.attitude = attitude_to( *c );
+        cache->push_back( seen );
+    }
+}
+
+const std::vector<visible_creature> &avatar::visible_creatures()
+{
+    update_visible_creatures();
+    return visible_creatures_cache;
+}
+
+const std::vector<visible_creature> &avatar::infrared_creatures()
+{
+    update_visible_creatures();
+    return infrared_creatures_cache;
+}
+
+std::vector<Creature *> avatar::visible_creatures_in_range( const int range )
+{
+    std::vector<Creature *> result;
+    for( const visible_creature &seen : visible_creatures() ) {
+        if( seen.distance <= range ) {
+            result.push_back( seen.critter );
+        }
+    }
+    return result;
+}
+
+std::vector<Creature *> avatar::targetable_creatures( const int range, const bool melee )
+{
+    update_visible_creatures();
+    std::vector<Creature *> result;
+    const auto add_if_targetable = [&]( const visible_creature & seen ) {
+        if( seen.attitude != Attitude::FRIENDLY && can_target( *seen.critter, range, melee ) ) {
+            result.push_back( seen.critter );
+        }
+    };
+    for( const visible_creature &seen : visible_creatures_cache ) {
+        add_if_targetable( seen );
+    }
+    for( const visible_creature &seen : infrared_creatures_cache ) {
+        add_if_targetable( seen );
+    }
+    return result;
+}
+
+std::vector<Creature *> avatar::hostile_creatures( const int range )
+{
+    std::vector<Creature *> result;
+    for( const visible_creature &seen : visible_creatures() ) {
+        if( std::round( rl_dist_exact( pos(), seen.critter->pos() ) ) <= range &&
+            seen.critter->attitude_to( *this ) == Attitude::HOSTILE ) {
+            result.push_back( seen.critter );
+        }
+    }
+    return result;
+}
+
 void avatar::toggle_map_memory()
 {
     show_map_memory = !show_map_memory;
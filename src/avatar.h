@@ -15,6 +15,7 @@
 #include "coordinates.h"
 #include "enums.h"
 #include "game_constants.h"
+#include "line.h"
 #include "magic_teleporter_list.h"
 #include "map_memory.h"
 #include "memory_fast.h"
@@ -66,6 +67,19 @@ struct monster_visible_info {
     bool dangerous[8] = {};
 };
 
+// A creature the avatar can see, see avatar::visible_creatures
+struct visible_creature {
+    Creature *critter = nullptr;
+    // Exactly one of these is set, saving the casts
+    monster *mon = nullptr;
+    npc *guy = nullptr;
+    // Direction and rl_dist from the avatar
+    direction dir = direction::CENTER;
+    int distance = 0;
+    // The avatar's attitude towards the creature
+    Creature::Attitude attitude = Creature::Attitude::NEUTRAL;
+};
+
 class avatar : public player
 {
     public:
@@ -241,6 +255,24 @@ class avatar : public player
             return mon_visible;
         }
 
+        /**
+         * Every creature the avatar can see, in the order game::get_creatures_if returns them.
+         * The list is shared by everything that asks until the turn, the avatar's position or
+         * blindness, the seen cache or the position of any creature changes. The attitudes
+         * are looked up again on every call, as they can change at any time.
+         */
+        const std::vector<visible_creature> &visible_creatures();
+        /** The creatures the avatar can only make out with infrared vision, kept like the above. */
+        const std::vector<visible_creature> &infrared_creatures();
+        /** The creatures from @ref visible_creatures at most @p range away. */
+        std::vector<Creature *> visible_creatures_in_range( int range );
+        /** Same as Character::get_targetable_creatures, but only looks at the creatures above. */
+        std::vector<Creature *> targetable_creatures( int range, bool melee );
+        /** Same as Character::get_hostile_creatures, but only looks at @ref visible_creatures. */
+        std::vector<Creature *> hostile_creatures( int range );
+        /** Called whenever the seen cache or a creature position changes. */
+        static void invalidate_visible_creatures();
+
         struct daily_calories {
             int spent = 0;
             int gained = 0;
@@ -333,6 +365,16 @@ class avatar : public player
         int per_upgrade = 0;
 
         monster_visible_info mon_visible;
+
+        void update_visible_creatures();
+
+        std::vector<visible_creature> visible_creatures_cache;
+        std::vector<visible_creature> infrared_creatures_cache;
+        // The state the caches above were built for
+        unsigned long long visible_creatures_generation = 0;
+        time_point visible_creatures_turn;
+        tripoint visible_creatures_pos;
+        bool visible_creatures_blind = false;
 };
 
 avatar &get_avatar();
@@ -605,7 +605,7 @@ static float rate_critter( const Creature &c )
 void avatar_action::autoattack( avatar &you, map &m )
 {
     int reach = you.weapon.reach_range( you );
-    std::vector<Creature *> critters = you.get_targetable_creatures( reach, true );
+    std::vector<Creature *> critters = you.targetable_creatures( reach, true );
     critters.erase( std::remove_if( critters.begin(), critters.end(), []( const Creature * c ) {
         if( !c->is_npc() ) {
             return false;
@@ -1062,7 +1062,7 @@ void avatar_action::plthrow( avatar &you, item_location loc,
 
     if( you.weapon.count_by_charges() && you.weapon.charges > 1 ) {
         you.weapon.mod_charges( -1 );
-        thrown.charges = 1;
+        thrown.set_charges( 1 );
     } else {
         you.remove_weapon();
     }
@@ -589,7 +589,7 @@ std::list<item> basecamp::use_charges( const itype_id &fake_id, int &quantity )
     for( basecamp_resource &bcp_r : resources ) {
         if( bcp_r.fake_id == fake_id ) {
             item camp_item( bcp_r.fake_id, 0 );
-            camp_item.charges = std::min( bcp_r.available, quantity );
+            camp_item.set_charges( std::min( bcp_r.available, quantity ) );
             quantity -= camp_item.charges;
             bcp_r.available -= camp_item.charges;
             bcp_r.consumed += camp_item.charges;
@@ -646,7 +646,7 @@ void basecamp::form_crafting_inventory( map &target_map )
     for( basecamp_resource &bcp_r : resources ) {
         bcp_r.consumed = 0;
         item camp_item( bcp_r.fake_id, 0 );
-        camp_item.item_tags.insert( "PSEUDO" );
+        camp_item.set_flag( "PSEUDO" );
         if( !bcp_r.ammo_id.is_null() ) {
             for( basecamp_fuel &bcp_f : fuels ) {
                 if( bcp_f.ammo_id == bcp_r.ammo_id ) {
@@ -24,6 +24,7 @@
 #include "colony.h"
 #include "color.h"
 #include "compatibility.h"
+#include "crafting_inventory_view.h"
 #include "cursesdef.h"
 #include "damage.h"
 #include "debug.h"
@@ -943,7 +944,7 @@ bool Character::activate_bionic( int b, bool eff_only, bool *close_bionics_ui )
             } else {
                 ctr = item( "radiocontrol", 0 );
             }
-            ctr.charges = units::to_kilojoule( get_power_level() );
+            ctr.set_charges( units::to_kilojoule( get_power_level() ) );
             int power_use = invoke_item( &ctr );
             mod_power_level( units::from_kilojoule( -power_use ) );
             bio.powered = ctr.active;
@@ -1888,7 +1889,7 @@ bool Character::has_enough_anesth( const itype &cbm, player &patient )
     const requirement_data req_anesth = *requirement_id( "anesthetic" ) *
                                         cbm.bionic->difficulty * 2 * weight;
 
-    return req_anesth.can_make_with_inventory( crafting_inventory(), is_crafting_component );
+    return req_anesth.can_make_with_inventory( crafting_view(), is_crafting_component );
 }
 
 bool Character::has_enough_anesth( const itype &cbm )
@@ -1900,7 +1901,7 @@ bool Character::has_enough_anesth( const itype &cbm )
     const int weight = units::to_kilogram( bodyweight() ) / 10;
     const requirement_data req_anesth = *requirement_id( "anesthetic" ) *
                                         cbm.bionic->difficulty * 2 * weight;
-    if( !req_anesth.can_make_with_inventory( crafting_inventory(),
+    if( !req_anesth.can_make_with_inventory( crafting_view(),
             is_crafting_component ) ) {
         std::string buffer = _( "You don't have enough anesthetic to perform the installation." );
         buffer += "\n";
@@ -1931,7 +1932,7 @@ bool Character::has_installation_requirment( const bionic_id &bid )
         return false;
     }
 
-    if( !bid->installation_requirement->can_make_with_inventory( crafting_inventory(),
+    if( !bid->installation_requirement->can_make_with_inventory( crafting_view(),
             is_crafting_component ) ) {
         std::string buffer = _( "You don't have the required components to perform the installation." );
         buffer += "\n";
@@ -44,6 +44,7 @@
 #include "mtype.h"
 #include "npc.h"
 #include "optional.h"
+#include "options.h"
 #include "output.h"
 #include "overlay_ordering.h"
 #include "path_info.h"
@@ -74,6 +75,8 @@ static const efftype_id effect_ridden( "ridden" );
 
 static const itype_id itype_corpse( "corpse" );
 
+static const option_handle<std::string> option_USE_CELSIUS( "USE_CELSIUS" );
+
 static const std::string ITEM_HIGHLIGHT( "highlight_item" );
 static const std::string ZOMBIE_REVIVAL_INDICATOR( "zombie_revival_indicator" );
 
@@ -1206,9 +1209,9 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                 } else {
                     color = catacurses::blue + bold;
                 }
-                if( get_option<std::string>( "USE_CELSIUS" ) == "celsius" ) {
+                if( option_USE_CELSIUS.get() == "celsius" ) {
                     temp_value = temp_to_celsius( temp_value );
-                } else if( get_option<std::string>( "USE_CELSIUS" ) == "kelvin" ) {
+                } else if( option_USE_CELSIUS.get() == "kelvin" ) {
                     temp_value = temp_to_kelvin( temp_value );
 
                 }
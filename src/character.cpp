@@ -26,6 +26,7 @@
 #include "construction.h"
 #include "coordinate_conversions.h"
 #include "coordinates.h"
+#include "crafting_inventory_view.h"
 #include "debug.h"
 #include "disease.h"
 #include "effect.h"
@@ -73,6 +74,7 @@
 #include "pathfinding.h"
 #include "player.h"
 #include "proficiency.h"
+#include "recipe_availability.h"
 #include "recipe_dictionary.h"
 #include "ret_val.h"
 #include "rng.h"
@@ -3163,7 +3165,7 @@ units::mass Character::get_selected_stack_weight( const item *i,
     if( stack != without.end() ) {
         int selected = stack->second;
         item copy = *i;
-        copy.charges = selected;
+        copy.set_charges( selected );
         return copy.weight();
     }
 
@@ -3248,7 +3250,7 @@ units::volume Character::get_selected_stack_volume( const item *i,
     if( stack != without.end() ) {
         int selected = stack->second;
         item copy = *i;
-        copy.charges = selected;
+        copy.set_charges( selected );
         return copy.volume();
     }
 
@@ -3365,7 +3367,7 @@ ret_val<bool> Character::can_wear( const item &it, bool with_equip_change ) cons
     }
 
     if( has_trait( trait_WOOLALLERGY ) && ( it.made_of( material_id( "wool" ) ) ||
-                                            it.item_tags.count( "wooled" ) ) ) {
+                                            it.has_own_flag( "wooled" ) ) ) {
         return ret_val<bool>::make_failure( _( "Can't wear that, it's made of wool!" ) );
     }
 
@@ -6900,7 +6902,7 @@ int Character::throw_range( const item &it ) const
     item tmp = it;
 
     if( tmp.count_by_charges() && tmp.charges > 1 ) {
-        tmp.charges = 1;
+        tmp.set_charges( 1 );
     }
 
     /** @EFFECT_STR determines maximum weight that can be thrown */
@@ -7086,7 +7088,7 @@ bool Character::pour_into( item &container, item &liquid )
 
     add_msg_if_player( _( "You pour %1$s into the %2$s." ), liquid.tname(), container.tname() );
 
-    liquid.charges -= container.fill_with( liquid, amount );
+    liquid.set_charges( liquid.charges - container.fill_with( liquid, amount ) );
     inv->unsort();
 
     if( liquid.charges > 0 ) {
@@ -8219,7 +8221,7 @@ bool Character::consume_charges( item &used, int qty )
 
     // Consume comestibles destroying them if no charges remain
     if( used.is_food() || used.is_medication() ) {
-        used.charges -= qty;
+        used.set_charges( used.charges - qty );
         if( used.charges <= 0 ) {
             i_rem( &used );
             return true;
@@ -11114,30 +11116,38 @@ std::vector<Creature *> Character::get_visible_creatures( const int range ) cons
 
 std::vector<Creature *> Character::get_targetable_creatures( const int range, bool melee ) const
 {
-    map &here = get_map();
-    return g->get_creatures_if( [this, range, melee, &here]( const Creature & critter ) -> bool {
-        //the call to map.sees is to make sure that even if we can see it through walls
-        //via a mutation or cbm we only attack targets with a line of sight
-        bool can_see = ( ( sees( critter ) || sees_with_infrared( critter ) ) && here.sees( pos(), critter.pos(), 100 ) );
-        if( can_see && melee )  //handles the case where we can see something with glass in the way for melee attacks
-        {
-            std::vector<tripoint> path = here.find_clear_path( pos(), critter.pos() );
-            for( const tripoint &point : path ) {
-                if( here.impassable( point ) &&
-                    !( weapon.has_flag( "SPEAR" ) && // Fences etc. Spears can stab through those
-                       here.has_flag( "THIN_OBSTACLE", point ) ) ) { //this mirrors melee.cpp function reach_attack
-                    can_see = false;
-                    break;
-                }
-            }
-        }
-        bool in_range = std::round( rl_dist_exact( pos(), critter.pos() ) ) <= range;
+    return g->get_creatures_if( [this, range, melee]( const Creature & critter ) -> bool {
         // TODO: get rid of fake npcs (pos() check)
         bool valid_target = this != &critter && pos() != critter.pos() && attitude_to( critter ) != Creature::Attitude::FRIENDLY;
-        return valid_target && in_range && can_see;
+        return valid_target && ( sees( critter ) || sees_with_infrared( critter ) ) &&
+               can_target( critter, range, melee );
     } );
 }
 
+bool Character::can_target( const Creature &critter, const int range, const bool melee ) const
+{
+    if( std::round( rl_dist_exact( pos(), critter.pos() ) ) > range ) {
+        return false;
+    }
+    map &here = get_map();
+    //the call to map.sees is to make sure that even if we can see it through walls
+    //via a mutation or cbm we only attack targets with a line of sight
+    if( !here.sees( pos(), critter.pos(), 100 ) ) {
+        return false;
+    }
+    if( melee ) { //handles the case where we can see something with glass in the way for melee attacks
+        std::vector<tripoint> path = here.find_clear_path( pos(), critter.pos() );
+        for( const tripoint &point : path ) {
+            if( here.impassable( point ) &&
+                !( weapon.has_flag( "SPEAR" ) && // Fences etc. Spears can stab through those
+                   here.has_flag( "THIN_OBSTACLE", point ) ) ) { //this mirrors melee.cpp function reach_attack
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 std::vector<Creature *> Character::get_hostile_creatures( int range ) const
 {
     return g->get_creatures_if( [this, range]( const Creature & critter ) -> bool {
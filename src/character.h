@@ -59,6 +59,7 @@ class SkillLevelMap;
 class basecamp;
 class bionic_collection;
 class character_martial_arts;
+class crafting_inventory_view;
 class faction;
 class inventory;
 class item_contents;
@@ -72,6 +73,7 @@ class npc;
 class player;
 class player_morale;
 class proficiency_set;
+class recipe_availability_cache;
 class recipe_subset;
 class vehicle;
 struct bionic;
@@ -2046,6 +2048,11 @@ class Character : public Creature, public visitable<Character>
          * with ranged weapons, e.g. with infrared vision.
          */
         std::vector<Creature *> get_targetable_creatures( int range, bool melee ) const;
+        /**
+         * Whether @p critter, which this can already detect, is within @p range and in
+         * line of sight, so it can be targeted.
+         */
+        bool can_target( const Creature &critter, int range, bool melee ) const;
         /** Returns an enumeration of visible mutations with colors */
         std::string visible_mutations( int visibility_cap ) const;
         player_activity get_destination_activity() const;
@@ -2223,6 +2230,17 @@ class Character : public Creature, public visitable<Character>
         const inventory &crafting_inventory( const tripoint &src_pos = tripoint_zero,
                                              int radius = PICKUP_RANGE, bool clear_path = true );
         void invalidate_crafting_inventory();
+        /**
+         * Like @ref crafting_inventory, but refers to the items instead of copying them.
+         * Use it to check requirements, it is much cheaper to keep up to date.
+         */
+        const crafting_inventory_view &crafting_view( const tripoint &src_pos = tripoint_zero,
+                int radius = PICKUP_RANGE, bool clear_path = true );
+        /**
+         * Which recipes can be crafted with the items of @ref crafting_view, brought up to
+         * date with it. Kept between calls, so only recipes affected by changes are checked again.
+         */
+        recipe_availability_cache &recipe_availability();
 
         /** Returns a value from 1.0 to 5.0 that acts as a multiplier
          * for the time taken to perform tasks that require detail vision,
@@ -2621,6 +2639,8 @@ class Character : public Creature, public visitable<Character>
         int cached_moves;
         tripoint cached_position;
         pimpl<inventory> cached_crafting_inventory;
+        pimpl<crafting_inventory_view> cached_crafting_view;
+        pimpl<recipe_availability_cache> cached_recipe_availability;
 
     protected:
         /** Subset of learned recipes. Needs to be mutable for lazy initialization. */
@@ -557,62 +557,155 @@ bool zone_manager::has_type( const zone_type_id &type ) const
 
 bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac ) const
 {
-    const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
-    return type_iter != area_cache.end();
+    const auto indexes = get_indexes( type, fac );
+    return indexes.first != nullptr || indexes.second != nullptr;
 }
 
-void zone_manager::cache_data()
+// Zone tiles are bucketed in cells of this size, on each z-level.
+static constexpr int zone_index_cell_size = 24;
+
+static tripoint zone_index_cell( const tripoint &p )
 {
-    area_cache.clear();
+    return tripoint( divide_round_down( p.x, zone_index_cell_size ),
+                     divide_round_down( p.y, zone_index_cell_size ), p.z );
+}
 
-    for( const zone_data &elem : zones ) {
-        if( !elem.get_enabled() ) {
+void zone_area_index::add( const tripoint &start, const tripoint &end )
+{
+    const int index = boxes.size();
+    const tripoint lo( std::min( start.x, end.x ), std::min( start.y, end.y ),
+                       std::min( start.z, end.z ) );
+    const tripoint hi( std::max( start.x, end.x ), std::max( start.y, end.y ),
+                       std::max( start.z, end.z ) );
+    boxes.push_back( { lo, hi } );
+    for( const tripoint &cell : tripoint_range<tripoint>( zone_index_cell( lo ),
+            zone_index_cell( hi ) ) ) {
+        cells[cell].push_back( index );
+    }
+}
+
+void zone_area_index::clear()
+{
+    boxes.clear();
+    cells.clear();
+}
+
+std::vector<int> zone_area_index::boxes_overlapping( const tripoint &start,
+        const tripoint &end ) const
+{
+    std::vector<int> result;
+    for( const tripoint &cell : tripoint_range<tripoint>( zone_index_cell( start ),
+            zone_index_cell( end ) ) ) {
+        const auto iter = cells.find( cell );
+        if( iter == cells.end() ) {
             continue;
         }
+        for( const int index : iter->second ) {
+            const box &b = boxes[index];
+            if( b.start.x <= end.x && b.end.x >= start.x && b.start.y <= end.y && b.end.y >= start.y &&
+                b.start.z <= end.z && b.end.z >= start.z ) {
+                result.push_back( index );
+            }
+        }
+    }
+    std::sort( result.begin(), result.end() );
+    result.erase( std::unique( result.begin(), result.end() ), result.end() );
+    return result;
+}
+
+bool zone_area_index::contains( const tripoint &p ) const
+{
+    const auto iter = cells.find( zone_index_cell( p ) );
+    if( iter == cells.end() ) {
+        return false;
+    }
+    return std::any_of( iter->second.begin(), iter->second.end(), [&]( const int index ) {
+        const box &b = boxes[index];
+        return p.x >= b.start.x && p.x <= b.end.x && p.y >= b.start.y && p.y <= b.end.y &&
+               p.z >= b.start.z && p.z <= b.end.z;
+    } );
+}
+
+bool zone_area_index::any_near( const tripoint &where, int range ) const
+{
+    return !boxes_overlapping( where - point( range, range ), where + point( range, range ) ).empty();
+}
+
+void zone_area_index::for_each_near( const tripoint &where, int range,
+                                     const std::function<void( const tripoint & )> &func ) const
+{
+    const tripoint start = where - point( range, range );
+    const tripoint end = where + point( range, range );
+    const std::vector<int> overlapping = boxes_overlapping( start, end );
+    for( auto iter = overlapping.begin(); iter != overlapping.end(); ++iter ) {
+        const box &b = boxes[*iter];
+        const tripoint from( std::max( b.start.x, start.x ), std::max( b.start.y, start.y ), where.z );
+        const tripoint to( std::min( b.end.x, end.x ), std::min( b.end.y, end.y ), where.z );
+        for( const tripoint &p : tripoint_range<tripoint>( from, to ) ) {
+            // tiles of overlapping zones are reported by the first of them only
+            const bool seen = std::any_of( overlapping.begin(), iter, [&]( const int index ) {
+                const box &other = boxes[index];
+                return p.x >= other.start.x && p.x <= other.end.x &&
+                       p.y >= other.start.y && p.y <= other.end.y;
+            } );
+            if( !seen ) {
+                func( p );
+            }
+        }
+    }
+}
 
-        const std::string &type_hash = elem.get_type_hash();
-        auto &cache = area_cache[type_hash];
+cata::optional<tripoint> zone_area_index::nearest( const tripoint &where, int range ) const
+{
+    cata::optional<tripoint> result;
+    int nearest_dist = range + 1;
+    for( const box &b : boxes ) {
+        const tripoint p( clamp( where.x, b.start.x, b.end.x ), clamp( where.y, b.start.y, b.end.y ),
+                          clamp( where.z, b.start.z, b.end.z ) );
+        const int dist = square_dist( p, where );
+        if( dist < nearest_dist ) {
+            nearest_dist = dist;
+            result = p;
+        }
+    }
+    return result;
+}
 
-        // Draw marked area
-        for( const tripoint &p : tripoint_range<tripoint>( elem.get_start_point(),
-                elem.get_end_point() ) ) {
-            cache.insert( p );
+void zone_manager::cache_data()
+{
+    area_index.clear();
+
+    for( const zone_data &elem : zones ) {
+        if( !elem.get_enabled() ) {
+            continue;
         }
+        area_index[ { elem.get_type(), elem.get_faction() } ].add( elem.get_start_point(),
+                elem.get_end_point() );
     }
 }
 
 void zone_manager::cache_vzones()
 {
-    vzone_cache.clear();
+    vzone_index.clear();
     map &here = get_map();
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z );
     for( zone_data *elem : vzones ) {
         if( !elem->get_enabled() ) {
             continue;
         }
-
-        const std::string &type_hash = elem->get_type_hash();
-        auto &cache = area_cache[type_hash];
-
-        // TODO: looks very similar to the above cache_data - maybe merge it?
-
-        // Draw marked area
-        for( const tripoint &p : tripoint_range<tripoint>( elem->get_start_point(),
-                elem->get_end_point() ) ) {
-            cache.insert( p );
-        }
+        vzone_index[ { elem->get_type(), elem->get_faction() } ].add( elem->get_start_point(),
+                elem->get_end_point() );
     }
 }
 
-std::unordered_set<tripoint> zone_manager::get_point_set( const zone_type_id &type,
-        const faction_id &fac ) const
+std::pair<const zone_area_index *, const zone_area_index *> zone_manager::get_indexes(
+    const zone_type_id &type, const faction_id &fac ) const
 {
-    const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
-    if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint>();
-    }
-
-    return type_iter->second;
+    const area_index_key key( type, fac );
+    const auto area_iter = area_index.find( key );
+    const auto vzone_iter = vzone_index.find( key );
+    return { area_iter != area_index.end() ? &area_iter->second : nullptr,
+             vzone_iter != vzone_index.end() ? &vzone_iter->second : nullptr };
 }
 
 std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &where,
@@ -626,13 +719,33 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
 {
     std::unordered_set<tripoint> res;
     map &here = get_map();
-    for( const tripoint elem : here.points_in_radius( here.getlocal( where ), radius ) ) {
-        const zone_data *zone = get_zone_at( here.getabs( elem ) );
+    const tripoint_range<tripoint> area = here.points_in_radius( here.getlocal( where ), radius );
+    const tripoint area_min = here.getabs( area.min() );
+    const tripoint area_max = here.getabs( area.max() );
+    // Only the zones overlapping the area, topmost first like get_zone_at looks at them.
+    std::vector<const zone_data *> candidates;
+    for( auto it = zones.rbegin(); it != zones.rend(); ++it ) {
+        const tripoint start = it->get_start_point();
+        const tripoint end = it->get_end_point();
+        if( start.x <= area_max.x && end.x >= area_min.x && start.y <= area_max.y &&
+            end.y >= area_min.y && start.z <= area_max.z && end.z >= area_min.z ) {
+            candidates.push_back( &*it );
+        }
+    }
+    if( candidates.empty() ) {
+        return res;
+    }
+    for( const tripoint elem : area ) {
+        const tripoint abs_elem = here.getabs( elem );
+        const auto zone = std::find_if( candidates.begin(), candidates.end(),
+        [&abs_elem]( const zone_data * z ) {
+            return z->has_inside( abs_elem );
+        } );
         // if not a LOOT zone
-        if( ( !zone ) || ( zone->get_type().str().substr( 0, 4 ) != "LOOT" ) ) {
+        if( zone == candidates.end() || ( *zone )->get_type().str().substr( 0, 4 ) != "LOOT" ) {
             continue;
         }
-        if( npc_search && ( has( zone_type_id( "NO_NPC_PICKUP" ), elem ) ) ) {
+        if( npc_search && has( zone_type_id( "NO_NPC_PICKUP" ), abs_elem ) ) {
             continue;
         }
         res.insert( elem );
@@ -640,48 +753,20 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
     return res;
 }
 
-std::unordered_set<tripoint> zone_manager::get_vzone_set( const zone_type_id &type,
-        const faction_id &fac ) const
-{
-    //Only regenerate the vehicle zone cache if any vehicles have moved
-    const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
-    if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint>();
-    }
-
-    return type_iter->second;
-}
-
 bool zone_manager::has( const zone_type_id &type, const tripoint &where,
                         const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    const auto &vzone_set = get_vzone_set( type, fac );
-    return point_set.find( where ) != point_set.end() || vzone_set.find( where ) != vzone_set.end();
+    const auto indexes = get_indexes( type, fac );
+    return ( indexes.first && indexes.first->contains( where ) ) ||
+           ( indexes.second && indexes.second->contains( where ) );
 }
 
 bool zone_manager::has_near( const zone_type_id &type, const tripoint &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
-        }
-    }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
-        }
-    }
-
-    return false;
+    const auto indexes = get_indexes( type, fac );
+    return ( indexes.first && indexes.first->any_near( where, range ) ) ||
+           ( indexes.second && indexes.second->any_near( where, range ) );
 }
 
 bool zone_manager::has_loot_dest_near( const tripoint &where ) const
@@ -734,36 +819,23 @@ bool zone_manager::custom_loot_has( const tripoint &where, const item *it ) cons
 std::unordered_set<tripoint> zone_manager::get_near( const zone_type_id &type,
         const tripoint &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
     auto near_point_set = std::unordered_set<tripoint>();
-
-    for( const tripoint &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
-                    near_point_set.insert( point );
-                }
+    const auto add_point = [&]( const tripoint & point ) {
+        if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
+            if( custom_loot_has( point, it ) ) {
+                near_point_set.insert( point );
             }
+        } else {
+            near_point_set.insert( point );
         }
-    }
+    };
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
-                    near_point_set.insert( point );
-                }
-            }
-        }
+    const auto indexes = get_indexes( type, fac );
+    if( indexes.first ) {
+        indexes.first->for_each_near( where, range, add_point );
+    }
+    if( indexes.second ) {
+        indexes.second->for_each_near( where, range, add_point );
     }
 
     return near_point_set;
@@ -776,34 +848,18 @@ cata::optional<tripoint> zone_manager::get_nearest( const zone_type_id &type, co
         return cata::nullopt;
     }
 
-    tripoint nearest_pos = tripoint( INT_MIN, INT_MIN, INT_MIN );
-    int nearest_dist = range + 1;
-    const std::unordered_set<tripoint> &point_set = get_point_set( type, fac );
-    for( const tripoint &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
-        }
+    const auto indexes = get_indexes( type, fac );
+    cata::optional<tripoint> nearest_pos;
+    if( indexes.first ) {
+        nearest_pos = indexes.first->nearest( where, range );
     }
-
-    const std::unordered_set<tripoint> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
+    if( indexes.second ) {
+        const cata::optional<tripoint> nearest_vzone = indexes.second->nearest( where, range );
+        if( nearest_vzone && ( !nearest_pos ||
+                               square_dist( *nearest_vzone, where ) < square_dist( *nearest_pos, where ) ) ) {
+            nearest_pos = nearest_vzone;
         }
     }
-    if( nearest_dist > range ) {
-        return cata::nullopt;
-    }
     return nearest_pos;
 }
 
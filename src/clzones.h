@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "hash_utils.h"
 #include "memory_fast.h"
 #include "optional.h"
 #include "point.h"
@@ -338,6 +339,40 @@ class zone_data
         void deserialize( JsonIn &jsin );
 };
 
+/**
+ * Spatial index of the areas of the zones of one type and faction. Each zone rectangle is
+ * listed in the cells of a coarse grid it overlaps, so point and range queries only look at
+ * the zones nearby and never have to enumerate the tiles of whole zones.
+ */
+class zone_area_index
+{
+    public:
+        void add( const tripoint &start, const tripoint &end );
+        void clear();
+        bool empty() const {
+            return boxes.empty();
+        }
+        bool contains( const tripoint &p ) const;
+        /** Whether any tile on the z-level of @p where is within @p range of it. */
+        bool any_near( const tripoint &where, int range ) const;
+        /** Calls @p func once for each tile on the z-level of @p where within @p range of it. */
+        void for_each_near( const tripoint &where, int range,
+                            const std::function<void( const tripoint & )> &func ) const;
+        /** The tile with the least square distance to @p where, if any is within @p range. */
+        cata::optional<tripoint> nearest( const tripoint &where, int range ) const;
+
+    private:
+        struct box {
+            tripoint start;
+            tripoint end;
+        };
+        /** Indices of the boxes overlapping the given area, sorted and unique. */
+        std::vector<int> boxes_overlapping( const tripoint &start, const tripoint &end ) const;
+
+        std::vector<box> boxes;
+        std::unordered_map<tripoint, std::vector<int>> cells;
+};
+
 class zone_manager
 {
     public:
@@ -356,12 +391,14 @@ class zone_manager
         std::vector<zone_data> removed_vzones;
 
         std::map<zone_type_id, zone_type> types;
-        std::unordered_map<std::string, std::unordered_set<tripoint>> area_cache;
-        std::unordered_map<std::string, std::unordered_set<tripoint>> vzone_cache;
-        std::unordered_set<tripoint> get_point_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint> get_vzone_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
+        using area_index_key = std::pair<zone_type_id, faction_id>;
+        /** Areas of the enabled zones, see @ref cache_data */
+        std::unordered_map<area_index_key, zone_area_index, cata::tuple_hash> area_index;
+        /** Areas of the enabled vehicle zones, see @ref cache_vzones */
+        std::unordered_map<area_index_key, zone_area_index, cata::tuple_hash> vzone_index;
+        /** Both indexes of the type, either may be null. */
+        std::pair<const zone_area_index *, const zone_area_index *> get_indexes(
+            const zone_type_id &type, const faction_id &fac ) const;
 
         //Cache number of items already checked on each source tile when sorting
         std::unordered_map<tripoint, int> num_processed;
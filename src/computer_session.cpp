@@ -432,7 +432,7 @@ void computer_session::action_sample()
                 if( capa <= 0 ) {
                     continue;
                 }
-                sewage.charges = std::min( sewage.charges, capa );
+                sewage.set_charges( std::min( sewage.charges, capa ) );
                 if( elem.can_contain( sewage ) ) {
                     elem.put_in( sewage, item_pocket::pocket_type::CONTAINER );
                 }
@@ -689,7 +689,7 @@ ret_val<edible_rating> Character::can_eat( const item &food ) const
         return ret_val<edible_rating>::make_failure( _( "That doesn't look edible in its current form." ) );
     }
 
-    if( food.item_tags.count( "DIRTY" ) ) {
+    if( food.has_own_flag( "DIRTY" ) ) {
         return ret_val<edible_rating>::make_failure(
                    _( "This is full of dirt after being on the ground." ) );
     }
@@ -711,7 +711,7 @@ ret_val<edible_rating> Character::can_eat( const item &food ) const
             }
         }
     }
-    if( food.item_tags.count( flag_FROZEN ) && !food.has_flag( flag_EDIBLE_FROZEN ) &&
+    if( food.has_own_flag( flag_FROZEN ) && !food.has_flag( flag_EDIBLE_FROZEN ) &&
         !food.has_flag( flag_MELTS ) ) {
         if( edible ) {
             return ret_val<edible_rating>::make_failure(
@@ -1448,7 +1448,7 @@ bool Character::feed_reactor_with( item &it, item_pocket *const parent_pocket )
     if( parent_pocket ) {
         parent_pocket->unseal();
     }
-    it.charges -= 1;
+    it.set_charges( it.charges - 1 );
     mod_moves( -250 );
     return true;
 }
@@ -1526,7 +1526,7 @@ bool Character::feed_furnace_with( item &it, item_pocket *const parent_pocket )
     if( parent_pocket ) {
         parent_pocket->unseal();
     }
-    it.charges -= consumed_charges;
+    it.set_charges( it.charges - consumed_charges );
     mod_moves( -250 );
 
     return true;
@@ -1555,7 +1555,7 @@ bool Character::fuel_bionic_with( item &it, item_pocket *const parent_pocket )
         it.ammo_set( item_type, it.ammo_remaining() - loadable );
     } else {
         loadable = std::min( it.charges, get_fuel_capacity( item_type ) );
-        it.charges -= loadable;
+        it.set_charges( it.charges - loadable );
     }
 
     const std::string str_loaded  = get_value( item_type.str() );
@@ -1837,7 +1837,7 @@ static bool consume_med( item &target, player &you, item_pocket *const parent_po
     if( parent_pocket ) {
         parent_pocket->unseal();
     }
-    target.charges -= amount_used;
+    target.set_charges( target.charges - amount_used );
     return target.charges <= 0;
 }
 
@@ -26,6 +26,7 @@
 #include "color.h"
 #include "craft_command.h"
 #include "crafting_gui.h"
+#include "crafting_inventory_view.h"
 #include "debug.h"
 #include "enum_traits.h"
 #include "enums.h"
@@ -59,6 +60,7 @@
 #include "point.h"
 #include "proficiency.h"
 #include "recipe.h"
+#include "recipe_availability.h"
 #include "recipe_dictionary.h"
 #include "requirements.h"
 #include "ret_val.h"
@@ -502,9 +504,9 @@ std::vector<const item *> Character::get_eligible_containers_for_crafting() cons
 
 bool Character::can_make( const recipe *r, int batch_size )
 {
-    const inventory &crafting_inv = crafting_inventory();
-
-    if( has_recipe( r, crafting_inv, get_crafting_helpers() ) < 0 ) {
+    // Only recipes known from books need the full inventory.
+    if( r->skill_used && !knows_recipe( r ) &&
+        has_recipe( r, crafting_inventory(), get_crafting_helpers() ) < 0 ) {
         return false;
     }
 
@@ -513,7 +515,7 @@ bool Character::can_make( const recipe *r, int batch_size )
     }
 
     return r->deduped_requirements().can_make_with_inventory(
-               crafting_inv, r->get_component_filter(), batch_size );
+               crafting_view(), r->get_component_filter(), batch_size );
 }
 
 bool Character::can_start_craft( const recipe *rec, recipe_filter_flags flags, int batch_size )
@@ -526,9 +528,9 @@ bool Character::can_start_craft( const recipe *rec, recipe_filter_flags flags, i
         return false;
     }
 
-    const inventory &inv = crafting_inventory();
     return rec->deduped_requirements().can_make_with_inventory(
-               inv, rec->get_component_filter( flags ), batch_size, craft_flags::start_only );
+               crafting_view(), rec->get_component_filter( flags ), batch_size,
+               craft_flags::start_only );
 }
 
 const inventory &Character::crafting_inventory( bool clear_path )
@@ -578,9 +580,24 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
     return *cached_crafting_inventory;
 }
 
+const crafting_inventory_view &Character::crafting_view( const tripoint &src_pos, int radius,
+        bool clear_path )
+{
+    cached_crafting_view->update( *this, src_pos == tripoint_zero ? pos() : src_pos, radius,
+                                  clear_path );
+    return *cached_crafting_view;
+}
+
+recipe_availability_cache &Character::recipe_availability()
+{
+    cached_recipe_availability->update( crafting_view(), has_trait( trait_DEBUG_HS ) );
+    return *cached_recipe_availability;
+}
+
 void Character::invalidate_crafting_inventory()
 {
     cached_time = calendar::before_time_starts;
+    cached_crafting_view->invalidate();
 }
 
 void Character::make_craft( const recipe_id &id_to_make, int batch_size, const tripoint &loc )
@@ -622,7 +639,7 @@ static void set_components( std::list<item> &components, const std::list<item> &
             components.push_back( tmp );
             // This assumes all (count-by-charges) items of the same type have been merged into one,
             // which has a charges value that can be evenly divided by batch_size.
-            components.back().charges = tmp.charges / batch_size;
+            components.back().set_charges( tmp.charges / batch_size );
         } else {
             if( ( non_charges_counter + offset ) % batch_size == 0 ) {
                 components.push_back( tmp );
@@ -1121,10 +1138,10 @@ void item::inherit_flags( const item &parent, const recipe &making )
         }
         //If item is crafted from perfect-fit components, the result is perfectly fitted too
         if( parent.has_flag( flag_FIT ) ) {
-            item_tags.insert( flag_FIT );
+            set_flag( flag_FIT );
         }
     }
-    for( const std::string &f : parent.item_tags ) {
+    for( const std::string &f : parent.get_flags() ) {
         if( json_flag::get( f ).craft_inherit() ) {
             set_flag( f );
         }
@@ -1202,7 +1219,7 @@ void Character::complete_craft( item &craft, const tripoint &loc )
 
         //If item is crafted neither from poor-fit nor from perfect-fit components, and it can be refitted, the result is refitted by default
         if( newit.has_flag( flag_VARSIZE ) ) {
-            newit.item_tags.insert( flag_FIT );
+            newit.set_flag( flag_FIT );
         }
         food_contained.inherit_flags( used, making );
 
@@ -1338,7 +1355,7 @@ bool Character::can_continue_craft( item &craft )
         // continue_reqs are for all batches at once
         const int batch_size = 1;
 
-        if( !continue_reqs.can_make_with_inventory( crafting_inventory(), filter, batch_size ) ) {
+        if( !continue_reqs.can_make_with_inventory( crafting_view(), filter, batch_size ) ) {
             std::string buffer = _( "You don't have the required components to continue crafting!" );
             buffer += "\n";
             buffer += continue_reqs.list_missing();
@@ -1353,7 +1370,7 @@ bool Character::can_continue_craft( item &craft )
             return false;
         }
 
-        if( continue_reqs.can_make_with_inventory( crafting_inventory(), no_rotten_filter,
+        if( continue_reqs.can_make_with_inventory( crafting_view(), no_rotten_filter,
                 batch_size ) ) {
             filter = no_rotten_filter;
         } else {
@@ -1405,7 +1422,7 @@ bool Character::can_continue_craft( item &craft )
                 std::vector<std::vector<quality_requirement>>(),
                 std::vector<std::vector<item_comp>>() );
 
-        if( !tool_continue_reqs.can_make_with_inventory( crafting_inventory(), return_true<item> ) ) {
+        if( !tool_continue_reqs.can_make_with_inventory( crafting_view(), return_true<item> ) ) {
             std::string buffer = _( "You don't have the necessary tools to continue crafting!" );
             buffer += "\n";
             buffer += tool_continue_reqs.list_missing();
@@ -1705,7 +1722,7 @@ std::list<item> Character::consume_items( map &m, const comp_selection<item_comp
         std::list<item>::iterator b = ret.begin();
         b++;
         while( ret.size() > 1 ) {
-            ret.front().charges += b->charges;
+            ret.front().set_charges( ret.front().charges + b->charges );
             b = ret.erase( b );
         }
     }
@@ -2245,9 +2262,9 @@ void Character::complete_disassemble( item_location &target, const recipe &dis )
         // remove the charges that one would get from crafting it
         if( org_item.is_ammo() && !dis.has_flag( "UNCRAFT_BY_QUANTITY" ) ) {
             //subtract selected number of rounds to disassemble
-            org_item.charges -= activity.position;
+            org_item.set_charges( org_item.charges - activity.position );
         } else {
-            org_item.charges -= dis.create_result().charges;
+            org_item.set_charges( org_item.charges - dis.create_result().charges );
         }
     }
     // remove the item, except when it's counted by charges and still has some
@@ -2309,12 +2326,12 @@ void Character::complete_disassemble( item_location &target, const recipe &dis )
                 // they are added together on the map anyway and handle_liquid
                 // should only be called once to put it all into a container at once.
                 if( newit.count_by_charges() || is_liquid ) {
-                    newit.charges = compcount;
+                    newit.set_charges( compcount );
                     compcount = 1;
                 } else if( !newit.craft_has_charges() && newit.charges > 0 ) {
                     // tools that can be unloaded should be created unloaded,
                     // tools that can't be unloaded will keep their default charges.
-                    newit.charges = 0;
+                    newit.set_charges( 0 );
                 }
             }
 
@@ -2356,11 +2373,11 @@ void Character::complete_disassemble( item_location &target, const recipe &dis )
 
         // Refitted clothing disassembles into refitted components (when applicable)
         if( dis_item.has_flag( flag_FIT ) && act_item.has_flag( flag_VARSIZE ) ) {
-            act_item.item_tags.insert( flag_FIT );
+            act_item.set_flag( flag_FIT );
         }
 
         if( filthy ) {
-            act_item.item_tags.insert( "FILTHY" );
+            act_item.set_flag( "FILTHY" );
         }
 
         for( std::list<item>::iterator a = dis_item.components.begin(); a != dis_item.components.end();
@@ -2431,18 +2448,18 @@ void remove_ammo( item &dis_item, Character &p )
     }
     if( dis_item.is_gun() && !dis_item.ammo_current().is_null() ) {
         item ammodrop( dis_item.ammo_current(), calendar::turn );
-        ammodrop.charges = dis_item.charges;
+        ammodrop.set_charges( dis_item.charges );
         drop_or_handle( ammodrop, p );
-        dis_item.charges = 0;
+        dis_item.set_charges( 0 );
     }
     if( dis_item.is_tool() && dis_item.charges > 0 && !dis_item.ammo_current().is_null() ) {
         item ammodrop( dis_item.ammo_current(), calendar::turn );
-        ammodrop.charges = dis_item.charges;
+        ammodrop.set_charges( dis_item.charges );
         if( dis_item.ammo_current() == itype_plut_cell ) {
-            ammodrop.charges /= PLUTONIUM_CHARGES;
+            ammodrop.set_charges( ammodrop.charges / PLUTONIUM_CHARGES );
         }
         drop_or_handle( ammodrop, p );
-        dis_item.charges = 0;
+        dis_item.set_charges( 0 );
     }
 }
 
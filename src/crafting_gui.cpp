@@ -17,6 +17,7 @@
 #include "character.h"
 #include "color.h"
 #include "crafting.h"
+#include "crafting_inventory_view.h"
 #include "cursesdef.h"
 #include "input.h"
 #include "item.h"
@@ -26,6 +27,7 @@
 #include "output.h"
 #include "point.h"
 #include "recipe.h"
+#include "recipe_availability.h"
 #include "recipe_dictionary.h"
 #include "requirements.h"
 #include "string_formatter.h"
@@ -235,7 +237,7 @@ const recipe *select_crafting_recipe( int &batch_size )
 
     struct availability {
         availability( const recipe *r, int batch_size = 1 ) {
-            const inventory &inv = get_player_character().crafting_inventory();
+            const crafting_inventory_view &inv = get_player_character().crafting_view();
             auto all_items_filter = r->get_component_filter( recipe_filter_flags::none );
             auto no_rotten_filter = r->get_component_filter( recipe_filter_flags::no_rotten );
             const deduped_requirement_data &req = r->deduped_requirements();
@@ -249,6 +251,13 @@ const recipe *select_crafting_recipe( int &batch_size )
                                        inv, all_items_filter, batch_size, craft_flags::start_only );
             proficiency_maluses = r->proficiency_maluses( get_player_character() );
         }
+        availability( const recipe *r, const recipe_availability_cache::entry &cached ) {
+            has_proficiencies = r->character_has_required_proficiencies( get_player_character() );
+            can_craft = cached.can_craft && has_proficiencies;
+            can_craft_non_rotten = cached.can_craft_non_rotten;
+            apparently_craftable = cached.apparently_craftable;
+            proficiency_maluses = r->proficiency_maluses( get_player_character() );
+        }
         bool can_craft;
         bool can_craft_non_rotten;
         bool apparently_craftable;
@@ -715,9 +724,11 @@ const recipe *select_crafting_recipe( int &batch_size )
 
                 available.reserve( current.size() );
                 // cache recipe availability on first display
+                recipe_availability_cache &known = player_character.recipe_availability();
+                const crafting_inventory_view &inv = player_character.crafting_view();
                 for( const recipe *e : current ) {
                     if( !availability_cache.count( e ) ) {
-                        availability_cache.emplace( e, availability( e ) );
+                        availability_cache.emplace( e, availability( e, known.get( *e, inv ) ) );
                     }
                 }
 
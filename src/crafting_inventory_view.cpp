@@ -0,0 +1,242 @@
+#include "crafting_inventory_view.h"
+
+#include <algorithm>
+#include <climits>
+
+#include "bionics.h"
+#include "character.h"
+#include "map.h"
+#include "map_iterator.h"
+#include "map_selector.h"
+#include "optional.h"
+#include "pimpl.h"
+#include "units.h"
+#include "veh_type.h"
+#include "vehicle.h"
+#include "vehicle_selector.h"
+#include "vpart_position.h"
+
+static const trait_id trait_BURROW( "BURROW" );
+
+/** All live views, so that map item events can reach them. */
+static std::vector<crafting_inventory_view *> &all_views()
+{
+    static std::vector<crafting_inventory_view *> views;
+    return views;
+}
+
+/** Bumped whenever the gathered map items of every view have to be dropped. */
+static int map_items_generation_counter = 1;
+
+crafting_inventory_view::crafting_inventory_view()
+{
+    all_views().push_back( this );
+}
+
+crafting_inventory_view::crafting_inventory_view( const crafting_inventory_view & )
+    : crafting_inventory_view()
+{
+    // The copy gathers its own items when it is first used.
+}
+
+crafting_inventory_view &crafting_inventory_view::operator=( const crafting_inventory_view & )
+{
+    invalidate();
+    return *this;
+}
+
+crafting_inventory_view::~crafting_inventory_view()
+{
+    std::vector<crafting_inventory_view *> &views = all_views();
+    views.erase( std::remove( views.begin(), views.end(), this ), views.end() );
+}
+
+void crafting_inventory_view::invalidate()
+{
+    owner = nullptr;
+    refreshed_turn = calendar::before_time_starts;
+}
+
+void crafting_inventory_view::invalidate_map_items()
+{
+    ++map_items_generation_counter;
+}
+
+void crafting_inventory_view::update( Character &who, const tripoint &origin, int radius,
+                                      bool clear_path )
+{
+    if( owner != &who || this->origin != origin || this->radius != radius ||
+        this->clear_path != clear_path || map_items_generation != map_items_generation_counter ) {
+        this->origin = origin;
+        this->radius = radius;
+        this->clear_path = clear_path;
+        owner = &who;
+        gather_map_items( who );
+        refreshed_turn = calendar::before_time_starts;
+    }
+    if( !added_map_items.empty() ) {
+        const map &here = get_map();
+        for( const item_location &loc : added_map_items ) {
+            if( loc && is_crafting_map_item( here, loc.position(), *loc, &who ) ) {
+                map_items.push_back( loc );
+            }
+        }
+        added_map_items.clear();
+        binned = false;
+    }
+    if( refreshed_moves != who.moves || refreshed_turn != calendar::turn ) {
+        refresh_local_items( who );
+        refreshed_moves = who.moves;
+        refreshed_turn = calendar::turn;
+    }
+}
+
+bool crafting_inventory_view::covers( const tripoint &p ) const
+{
+    return reachable_set.count( p ) > 0;
+}
+
+void crafting_inventory_view::gather_map_items( Character &who )
+{
+    map &here = get_map();
+    reachable.clear();
+    if( clear_path ) {
+        here.reachable_flood_steps( reachable, origin, radius, 1, 100 );
+    } else {
+        for( const tripoint &p : here.points_in_radius( origin, radius ) ) {
+            reachable.emplace_back( p );
+        }
+    }
+    reachable_set = std::unordered_set<tripoint>( reachable.begin(), reachable.end() );
+
+    map_items.clear();
+    added_map_items.clear();
+    for( const tripoint &p : reachable ) {
+        const bool accessible = here.accessible_items( p );
+        for( item &it : here.i_at( p ) ) {
+            if( ( accessible || it.made_of( phase_id::LIQUID ) ) &&
+                is_crafting_map_item( here, p, it, &who ) ) {
+                map_items.emplace_back( map_cursor( p ), &it );
+            }
+        }
+        const optional_vpart_position vp = here.veh_at( p );
+        if( !vp ) {
+            continue;
+        }
+        const cata::optional<vpart_reference> cargo = vp.part_with_feature( "CARGO", true );
+        if( cargo ) {
+            vehicle &veh = vp->vehicle();
+            for( item &it : veh.get_items( cargo->part_index() ) ) {
+                map_items.emplace_back( vehicle_cursor( veh, cargo->part_index() ), &it );
+            }
+        }
+    }
+    map_items_generation = map_items_generation_counter;
+    binned = false;
+}
+
+void crafting_inventory_view::refresh_local_items( Character &who )
+{
+    map &here = get_map();
+    pseudo_items.clear();
+    for( const tripoint &p : reachable ) {
+        for_each_crafting_pseudo_item( here, p, [this]( item & it ) {
+            pseudo_items.push_back( it );
+        } );
+    }
+
+    own_items.clear();
+    for( const item_location &it : who.all_items_loc() ) {
+        // can't craft with containers that have items in them
+        if( !it->contents.empty_container() ) {
+            continue;
+        }
+        own_items.push_back( it );
+    }
+
+    for( const bionic &bio : *who.my_bionics ) {
+        const bionic_data &bio_data = bio.info();
+        if( ( !bio_data.activated || bio.powered ) &&
+            !bio_data.fake_item.is_empty() ) {
+            pseudo_items.emplace_back( bio.info().fake_item, calendar::turn,
+                                       units::to_kilojoule( who.get_power_level() ) );
+        }
+    }
+    if( who.has_trait( trait_BURROW ) ) {
+        pseudo_items.emplace_back( "pickaxe", calendar::turn );
+        pseudo_items.emplace_back( "shovel", calendar::turn );
+    }
+
+    // Drop the locations of map items that are gone.
+    map_items.erase( std::remove_if( map_items.begin(), map_items.end(),
+    []( const item_location & loc ) {
+        return !loc;
+    } ), map_items.end() );
+    binned = false;
+}
+
+void crafting_inventory_view::on_map_item_added( const tripoint &p, item &it )
+{
+    const map &here = get_map();
+    for( crafting_inventory_view *view : all_views() ) {
+        if( view->owner == nullptr || view->map_items_generation != map_items_generation_counter ||
+            !view->covers( p ) ) {
+            continue;
+        }
+        if( it.made_of( phase_id::LIQUID ) || here.accessible_items( p ) ) {
+            view->added_map_items.emplace_back( map_cursor( p ), &it );
+        }
+    }
+}
+
+void crafting_inventory_view::on_vehicle_item_added( vehicle &veh, int part, item &it )
+{
+    if( !veh.part_flag( part, "CARGO" ) ) {
+        return;
+    }
+    const tripoint p = veh.global_part_pos3( part );
+    for( crafting_inventory_view *view : all_views() ) {
+        if( view->owner == nullptr || view->map_items_generation != map_items_generation_counter ||
+            !view->covers( p ) ) {
+            continue;
+        }
+        view->map_items.emplace_back( vehicle_cursor( veh, part ), &it );
+        view->binned = false;
+    }
+}
+
+const item_reference_bin &crafting_inventory_view::get_binned_items() const
+{
+    if( binned ) {
+        return binned_items;
+    }
+
+    binned_items.clear();
+    // HACK: references can only be taken from non-const items.
+    crafting_inventory_view *this_nonconst = const_cast<crafting_inventory_view *>( this );
+    this_nonconst->visit_items( [this]( item * e ) {
+        binned_items[ e->typeId() ].push_back( e->get_safe_reference() );
+        return VisitResponse::NEXT;
+    } );
+
+    binned = true;
+    return binned_items;
+}
+
+bool crafting_inventory_view::has_tools( const itype_id &it, int quantity,
+        const std::function<bool( const item & )> &filter ) const
+{
+    return has_amount( it, quantity, true, filter );
+}
+
+bool crafting_inventory_view::has_components( const itype_id &it, int quantity,
+        const std::function<bool( const item & )> &filter ) const
+{
+    return has_amount( it, quantity, false, filter );
+}
+
+bool crafting_inventory_view::has_charges( const itype_id &it, int quantity,
+        const std::function<bool( const item & )> &filter ) const
+{
+    return charges_of( it, INT_MAX, filter ) >= quantity;
+}
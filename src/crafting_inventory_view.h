@@ -0,0 +1,99 @@
+#pragma once
+#ifndef CATA_SRC_CRAFTING_INVENTORY_VIEW_H
+#define CATA_SRC_CRAFTING_INVENTORY_VIEW_H
+
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "calendar.h"
+#include "inventory.h"
+#include "item.h"
+#include "item_location.h"
+#include "point.h"
+#include "safe_reference.h"
+#include "type_id.h"
+#include "visitable.h"
+
+class Character;
+class vehicle;
+
+using item_reference_bin = std::unordered_map<itype_id, std::vector<safe_reference<item>>>;
+
+/**
+ * The items a character can craft with, without copying them: the items within reach on the
+ * map and in vehicle cargo plus the character's own items are referred to by item_locations,
+ * only pseudo items (furniture and vehicle tools, fire, bionics) are owned by the view.
+ *
+ * The map items are gathered once for an area and then kept up to date from the map's item
+ * events. They are gathered again when the area changes or the map invalidated them.
+ */
+class crafting_inventory_view : public visitable<crafting_inventory_view>
+{
+    public:
+        friend visitable<crafting_inventory_view>;
+
+        crafting_inventory_view();
+        crafting_inventory_view( const crafting_inventory_view & );
+        crafting_inventory_view &operator=( const crafting_inventory_view & );
+        ~crafting_inventory_view();
+
+        /**
+         * Points the view at the items @p who can use around @p origin. Map items are only
+         * gathered again if needed, pseudo items and the items of @p who are refreshed when
+         * the character acted or the turn changed since the last call.
+         */
+        void update( Character &who, const tripoint &origin, int radius, bool clear_path );
+        /** Forces the next @ref update to gather everything again. */
+        void invalidate();
+
+        bool has_tools( const itype_id &it, int quantity,
+                        const std::function<bool( const item & )> &filter = return_true<item> ) const;
+        bool has_components( const itype_id &it, int quantity,
+                             const std::function<bool( const item & )> &filter = return_true<item> ) const;
+        bool has_charges( const itype_id &it, int quantity,
+                          const std::function<bool( const item & )> &filter = return_true<item> ) const;
+
+        /**
+         * Returns the visitable items binned by their itype, see inventory::get_binned_items.
+         * Items that were destroyed since have a null reference.
+         */
+        const item_reference_bin &get_binned_items() const;
+
+        /** Called by the reality bubble map when an item was placed at @p p. */
+        static void on_map_item_added( const tripoint &p, item &it );
+        /** Called by a vehicle when an item was placed in one of its parts. */
+        static void on_vehicle_item_added( vehicle &veh, int part, item &it );
+        /** Makes all views gather their map items again, e.g. when terrain changed. */
+        static void invalidate_map_items();
+
+    private:
+        void gather_map_items( Character &who );
+        void refresh_local_items( Character &who );
+        /** Whether the point is one of those the map items were gathered from. */
+        bool covers( const tripoint &p ) const;
+
+        tripoint origin = tripoint_min;
+        int radius = -1;
+        bool clear_path = true;
+        /** Only compared against, the character may have been moved since. */
+        const Character *owner = nullptr;
+        int map_items_generation = 0;
+        int refreshed_moves = 0;
+        time_point refreshed_turn = calendar::before_time_starts;
+
+        std::vector<tripoint> reachable;
+        std::unordered_set<tripoint> reachable_set;
+        std::vector<item_location> map_items;
+        /** Map items added since the last update, not yet checked against the owner. */
+        std::vector<item_location> added_map_items;
+        std::vector<item_location> own_items;
+        std::list<item> pseudo_items;
+
+        mutable bool binned = false;
+        mutable item_reference_bin binned_items;
+};
+
+#endif // CATA_SRC_CRAFTING_INVENTORY_VIEW_H
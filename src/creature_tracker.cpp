@@ -6,6 +6,7 @@
 #include <string>
 #include <utility>
 
+#include "avatar.h"
 #include "debug.h"
 #include "mongroup.h"
 #include "monster.h"
@@ -19,14 +20,63 @@ Creature_tracker::Creature_tracker() = default;
 
 Creature_tracker::~Creature_tracker() = default;
 
-shared_ptr_fast<monster> Creature_tracker::find( const tripoint &pos ) const
+// Index into a layer of the location grid, -1 if the point is outside the reality bubble.
+static int bubble_index( const tripoint &pos )
+{
+    if( pos.x < 0 || pos.y < 0 || pos.x >= MAPSIZE_X || pos.y >= MAPSIZE_Y ||
+        pos.z < -OVERMAP_DEPTH || pos.z > OVERMAP_HEIGHT ) {
+        return -1;
+    }
+    return pos.x + pos.y * MAPSIZE_X;
+}
+
+const shared_ptr_fast<monster> &Creature_tracker::location_entry( const tripoint &pos ) const
+{
+    static const shared_ptr_fast<monster> none;
+    const int index = bubble_index( pos );
+    if( index < 0 ) {
+        const auto iter = monsters_outside_bubble.find( pos );
+        return iter != monsters_outside_bubble.end() ? iter->second : none;
+    }
+    const std::vector<shared_ptr_fast<monster>> &layer = monsters_by_location[pos.z + OVERMAP_DEPTH];
+    return layer.empty() ? none : layer[index];
+}
+
+void Creature_tracker::set_location_entry( const tripoint &pos,
+        const shared_ptr_fast<monster> &critter )
 {
-    const auto iter = monsters_by_location.find( pos );
-    if( iter != monsters_by_location.end() ) {
-        const shared_ptr_fast<monster> &mon_ptr = iter->second;
-        if( !mon_ptr->is_dead() ) {
-            return mon_ptr;
+    const int index = bubble_index( pos );
+    if( index < 0 ) {
+        if( critter ) {
+            monsters_outside_bubble[pos] = critter;
+        } else {
+            monsters_outside_bubble.erase( pos );
         }
+        return;
+    }
+    std::vector<shared_ptr_fast<monster>> &layer = monsters_by_location[pos.z + OVERMAP_DEPTH];
+    if( layer.empty() ) {
+        if( !critter ) {
+            return;
+        }
+        layer.resize( MAPSIZE_X * MAPSIZE_Y );
+    }
+    layer[index] = critter;
+}
+
+void Creature_tracker::clear_location_map()
+{
+    for( std::vector<shared_ptr_fast<monster>> &layer : monsters_by_location ) {
+        std::fill( layer.begin(), layer.end(), nullptr );
+    }
+    monsters_outside_bubble.clear();
+}
+
+shared_ptr_fast<monster> Creature_tracker::find( const tripoint &pos ) const
+{
+    const shared_ptr_fast<monster> &mon_ptr = location_entry( pos );
+    if( mon_ptr && !mon_ptr->is_dead() ) {
+        return mon_ptr;
     }
     return nullptr;
 }
@@ -54,6 +104,7 @@ shared_ptr_fast<monster> Creature_tracker::from_temporary_id( const int id )
 
 bool Creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
 {
+    avatar::invalidate_visible_creatures();
     assert( critter_ptr );
     monster &critter = *critter_ptr;
 
@@ -85,7 +136,7 @@ bool Creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
     }
 
     monsters_list.emplace_back( critter_ptr );
-    monsters_by_location[critter.pos()] = critter_ptr;
+    set_location_entry( critter.pos(), critter_ptr );
     add_to_faction_map( critter_ptr );
     return true;
 }
@@ -97,10 +148,23 @@ void Creature_tracker::add_to_faction_map( const shared_ptr_fast<monster> &critt
 
     // Only 1 faction per mon at the moment.
     if( critter.friendly == 0 ) {
-        monster_faction_map_[ critter.faction ].insert( critter_ptr );
+        monster_faction_map_[ critter.faction ].push_back( &critter );
     } else {
         static const mfaction_str_id playerfaction( "player" );
-        monster_faction_map_[ playerfaction ].insert( critter_ptr );
+        monster_faction_map_[ playerfaction ].push_back( &critter );
+    }
+}
+
+void Creature_tracker::remove_from_faction_map( const monster &critter )
+{
+    for( auto &pair : monster_faction_map_ ) {
+        std::vector<monster *> &members = pair.second;
+        const auto iter = std::find( members.begin(), members.end(), &critter );
+        if( iter != members.end() ) {
+            *iter = members.back();
+            members.pop_back();
+            return;
+        }
     }
 }
 
@@ -111,6 +175,7 @@ size_t Creature_tracker::size() const
 
 bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_pos )
 {
+    avatar::invalidate_visible_creatures();
     if( critter.is_dead() ) {
         // find ignores dead critters anyway, changing their position in the
         // monsters_by_location map is useless.
@@ -135,8 +200,8 @@ bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_p
         return ptr.get() == &critter;
     } );
     if( iter != monsters_list.end() ) {
-        monsters_by_location.erase( critter.pos() );
-        monsters_by_location[new_pos] = *iter;
+        set_location_entry( critter.pos(), nullptr );
+        set_location_entry( new_pos, *iter );
         return true;
     } else {
         const tripoint &old_pos = critter.pos();
@@ -153,25 +218,33 @@ bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_p
 
 void Creature_tracker::remove_from_location_map( const monster &critter )
 {
-    const auto pos_iter = monsters_by_location.find( critter.pos() );
-    if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
-        monsters_by_location.erase( pos_iter );
+    if( location_entry( critter.pos() ).get() == &critter ) {
+        set_location_entry( critter.pos(), nullptr );
         return;
     }
 
     // When it's not in the map at its current location, it might still be there under,
     // another location, so look for it.
-    const auto iter = std::find_if( monsters_by_location.begin(), monsters_by_location.end(),
-    [&]( const decltype( monsters_by_location )::value_type & v ) {
+    for( std::vector<shared_ptr_fast<monster>> &layer : monsters_by_location ) {
+        for( shared_ptr_fast<monster> &entry : layer ) {
+            if( entry.get() == &critter ) {
+                entry = nullptr;
+                return;
+            }
+        }
+    }
+    const auto iter = std::find_if( monsters_outside_bubble.begin(), monsters_outside_bubble.end(),
+    [&]( const decltype( monsters_outside_bubble )::value_type & v ) {
         return v.second.get() == &critter;
     } );
-    if( iter != monsters_by_location.end() ) {
-        monsters_by_location.erase( iter );
+    if( iter != monsters_outside_bubble.end() ) {
+        monsters_outside_bubble.erase( iter );
     }
 }
 
 void Creature_tracker::remove( const monster &critter )
 {
+    avatar::invalidate_visible_creatures();
     const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
     [&]( const shared_ptr_fast<monster> &ptr ) {
         return ptr.get() == &critter;
@@ -181,15 +254,7 @@ void Creature_tracker::remove( const monster &critter )
         return;
     }
 
-    for( auto &pair : monster_faction_map_ ) {
-        const auto fac_iter = pair.second.find( *iter );
-        if( fac_iter != pair.second.end() ) {
-            // Need to do this manually because the shared pointer containing critter is kept valid
-            // within removed_ and so the weak pointer in monster_faction_map_ is also valid.
-            pair.second.erase( fac_iter );
-            break;
-        }
-    }
+    remove_from_faction_map( critter );
     remove_from_location_map( critter );
     removed_.push_back( *iter );
     monsters_list.erase( iter );
@@ -197,44 +262,36 @@ void Creature_tracker::remove( const monster &critter )
 
 void Creature_tracker::clear()
 {
+    avatar::invalidate_visible_creatures();
     monsters_list.clear();
-    monsters_by_location.clear();
+    clear_location_map();
     monster_faction_map_.clear();
     removed_.clear();
 }
 
 void Creature_tracker::rebuild_cache()
 {
-    monsters_by_location.clear();
+    avatar::invalidate_visible_creatures();
+    clear_location_map();
     monster_faction_map_.clear();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
-        monsters_by_location[mon_ptr->pos()] = mon_ptr;
+        set_location_entry( mon_ptr->pos(), mon_ptr );
         add_to_faction_map( mon_ptr );
     }
 }
 
 void Creature_tracker::swap_positions( monster &first, monster &second )
 {
+    avatar::invalidate_visible_creatures();
     if( first.pos() == second.pos() ) {
         return;
     }
 
     // Either of them may be invalid!
-    const auto first_iter = monsters_by_location.find( first.pos() );
-    const auto second_iter = monsters_by_location.find( second.pos() );
-    // implied: first_iter != second_iter
-
-    shared_ptr_fast<monster> first_ptr;
-    if( first_iter != monsters_by_location.end() ) {
-        first_ptr = first_iter->second;
-        monsters_by_location.erase( first_iter );
-    }
-
-    shared_ptr_fast<monster> second_ptr;
-    if( second_iter != monsters_by_location.end() ) {
-        second_ptr = second_iter->second;
-        monsters_by_location.erase( second_iter );
-    }
+    const shared_ptr_fast<monster> first_ptr = location_entry( first.pos() );
+    const shared_ptr_fast<monster> second_ptr = location_entry( second.pos() );
+    set_location_entry( first.pos(), nullptr );
+    set_location_entry( second.pos(), nullptr );
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
     tripoint temp = second.pos();
@@ -243,10 +300,10 @@ void Creature_tracker::swap_positions( monster &first, monster &second )
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
-        monsters_by_location[first.pos()] = first_ptr;
+        set_location_entry( first.pos(), first_ptr );
     }
     if( second_ptr ) {
-        monsters_by_location[second.pos()] = second_ptr;
+        set_location_entry( second.pos(), second_ptr );
     }
 }
 
@@ -276,10 +333,12 @@ bool Creature_tracker::kill_marked_for_death()
 
 void Creature_tracker::remove_dead()
 {
+    avatar::invalidate_visible_creatures();
     // Can't use game::all_monsters() as it would not contain *dead* monsters.
     for( auto iter = monsters_list.begin(); iter != monsters_list.end(); ) {
         const monster &critter = **iter;
         if( critter.is_dead() ) {
+            remove_from_faction_map( critter );
             remove_from_location_map( critter );
             iter = monsters_list.erase( iter );
         } else {
@@ -2,12 +2,13 @@
 #ifndef CATA_SRC_CREATURE_TRACKER_H
 #define CATA_SRC_CREATURE_TRACKER_H
 
+#include <array>
 #include <cstddef>
 #include <memory>
-#include <set>
 #include <unordered_map>
 #include <vector>
 
+#include "game_constants.h"
 #include "int_id.h"
 #include "memory_fast.h"
 #include "point.h"
@@ -22,18 +23,13 @@ class Creature_tracker
     private:
 
         void add_to_faction_map( const shared_ptr_fast<monster> &critter );
+        void remove_from_faction_map( const monster &critter );
 
-        class weak_ptr_comparator
-        {
-            public:
-                bool operator()( const weak_ptr_fast<monster> &lhs,
-                                 const weak_ptr_fast<monster> &rhs ) const {
-                    return lhs.lock().get() < rhs.lock().get();
-                }
-        };
-
-        std::unordered_map<mfaction_id, std::set<weak_ptr_fast<monster>, weak_ptr_comparator>>
-                monster_faction_map_;
+        /**
+         * Members of each monster faction. The monsters are owned by @ref monsters_list (or
+         * @ref removed_) for as long as they are listed here.
+         */
+        std::unordered_map<mfaction_id, std::vector<monster *>> monster_faction_map_;
 
         /**
          * Creatures that get removed via @ref remove are stored here until the end of the turn.
@@ -94,7 +90,17 @@ class Creature_tracker
 
     private:
         std::vector<shared_ptr_fast<monster>> monsters_list;
-        std::unordered_map<tripoint, shared_ptr_fast<monster>> monsters_by_location;
+        /**
+         * Monsters by location: a grid over the reality bubble with one layer per z-level,
+         * allocated on first use, and a map for the rare monster outside of the bubble.
+         */
+        std::array<std::vector<shared_ptr_fast<monster>>, OVERMAP_LAYERS> monsters_by_location;
+        std::unordered_map<tripoint, shared_ptr_fast<monster>> monsters_outside_bubble;
+        /** The entry at @p pos, which is null if there is none. */
+        const shared_ptr_fast<monster> &location_entry( const tripoint &pos ) const;
+        /** Sets (or with nullptr clears) the entry at @p pos. */
+        void set_location_entry( const tripoint &pos, const shared_ptr_fast<monster> &critter );
+        void clear_location_map();
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
 };
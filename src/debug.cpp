@@ -96,6 +96,24 @@ bool debug_has_error_been_observed()
     return error_observed;
 }
 
+/** Collects the debugmsgs raised during capture_debugmsg_during, if set. */
+static std::string *captured_debugmsgs = nullptr;
+
+std::string capture_debugmsg_during( const std::function<void()> &func )
+{
+    std::string *const outer = captured_debugmsgs;
+    std::string messages;
+    captured_debugmsgs = &messages;
+    try {
+        func();
+    } catch( ... ) {
+        captured_debugmsgs = outer;
+        throw;
+    }
+    captured_debugmsgs = outer;
+    return messages;
+}
+
 bool debug_mode = false;
 
 namespace
@@ -112,6 +130,11 @@ void realDebugmsg( const char *filename, const char *line, const char *funcname,
     assert( line != nullptr );
     assert( funcname != nullptr );
 
+    if( captured_debugmsgs != nullptr ) {
+        *captured_debugmsgs += text + "\n";
+        return;
+    }
+
     DebugLog( D_ERROR, D_MAIN ) << filename << ":" << line << " [" << funcname << "] "
                                 << text << std::flush;
 
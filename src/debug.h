@@ -2,6 +2,9 @@
 #ifndef CATA_SRC_DEBUG_H
 #define CATA_SRC_DEBUG_H
 
+#include <functional>
+#include <string>
+
 #include "string_formatter.h"
 
 /**
@@ -197,6 +200,12 @@ void limitDebugClass( int );
  */
 bool debug_has_error_been_observed();
 
+/**
+ * Runs @p func and returns the messages of the debugmsgs it raised, one per line.
+ * They are neither reported nor logged, for tests that expect an error.
+ */
+std::string capture_debugmsg_during( const std::function<void()> &func );
+
 // Debug Only                                                       {{{1
 // ---------------------------------------------------------------------
 
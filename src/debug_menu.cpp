@@ -79,6 +79,7 @@
 #include "player.h"
 #include "point.h"
 #include "popup.h"
+#include "profiler.h"
 #include "recipe_dictionary.h"
 #include "rng.h"
 #include "stomach.h"
@@ -182,6 +183,7 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
         case debug_menu::debug_menu_index::TEST_MAP_EXTRA_DISTRIBUTION: return "TEST_MAP_EXTRA_DISTRIBUTION";
         case debug_menu::debug_menu_index::NESTED_MAPGEN: return "NESTED_MAPGEN";
         case debug_menu::debug_menu_index::VEHICLE_BATTERY_CHARGE: return "VEHICLE_BATTERY_CHARGE";
+        case debug_menu::debug_menu_index::PROFILER: return "PROFILER";
         // *INDENT-ON*
         case debug_menu::debug_menu_index::last:
             break;
@@ -255,6 +257,7 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( debug_menu_index::DISPLAY_RADIATION, true, 'R', _( "Toggle display radiation" ) ) },
             { uilist_entry( debug_menu_index::SHOW_MUT_CAT, true, 'm', _( "Show mutation category levels" ) ) },
             { uilist_entry( debug_menu_index::BENCHMARK, true, 'b', _( "Draw benchmark (X seconds)" ) ) },
+            { uilist_entry( debug_menu_index::PROFILER, true, 'P', _( "Toggle turn profiler" ) ) },
             { uilist_entry( debug_menu_index::TRAIT_GROUP, true, 't', _( "Test trait group" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_PATH, true, 'n', _( "Toggle NPC pathfinding on map" ) ) },
             { uilist_entry( debug_menu_index::PRINT_FACTION_INFO, true, 'f', _( "Print faction info to console" ) ) },
@@ -1223,6 +1226,7 @@ void debug()
         debug_menu_index::GAME_REPORT,
         debug_menu_index::ENABLE_ACHIEVEMENTS,
         debug_menu_index::BENCHMARK,
+        debug_menu_index::PROFILER,
         debug_menu_index::SHOW_MSG,
     };
     bool should_disable_achievements = action && !non_cheaty_options.count( *action );
@@ -1795,6 +1799,24 @@ void debug()
         }
         break;
 
+        case debug_menu_index::PROFILER: {
+#if defined(CATA_PROFILER)
+            if( !profiler::enabled() ) {
+                profiler::enable();
+                add_msg( m_info, _( "Profiler started, the time of each zone is shown every turn." ) );
+            } else {
+                profiler::disable();
+                const std::string path = PATH_INFO::profile_trace();
+                if( profiler::write_trace( path ) ) {
+                    popup( _( "Profiler stopped, trace written to %s" ), path );
+                }
+            }
+#else
+            popup( _( "This binary was not compiled with profiler support." ) );
+#endif
+        }
+        break;
+
         case debug_menu_index::OM_TELEPORT:
             debug_menu::teleport_overmap();
             break;
@@ -80,6 +80,7 @@ enum class debug_menu_index : int {
     TEST_MAP_EXTRA_DISTRIBUTION,
     NESTED_MAPGEN,
     VEHICLE_BATTERY_CHARGE,
+    PROFILER,
     last
 };
 
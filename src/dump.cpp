@@ -127,7 +127,7 @@ bool game::dump_stats( const std::string &what, dump_mode mode,
                 item obj( e );
                 if( bp == num_bp || obj.covers( convert_bp( bp ).id() ) ) {
                     if( obj.has_flag( flag_VARSIZE ) ) {
-                        obj.item_tags.insert( "FIT" );
+                        obj.set_flag( "FIT" );
                     }
                     dump( obj );
                 }
@@ -7,9 +7,7 @@
 #include <limits>
 #include <map>
 #include <memory>
-#include <queue>
 #include <random>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -151,6 +149,128 @@ static float gurney_spherical( const double charge, const double mass )
                                          -0.5 ) * TYPICAL_GURNEY_CONSTANT );
 }
 
+namespace
+{
+
+/**
+ * Flood fill state of a single blast, kept in dense arrays over the reality bubble.
+ * Z-levels are allocated when the blast first reaches them.
+ */
+class blast_grid
+{
+    public:
+        static constexpr float unreached = std::numeric_limits<float>::max();
+
+        bool is_closed( const tripoint &p ) const {
+            const layer *l = get_layer( p.z );
+            return l != nullptr && l->closed[index( p )];
+        }
+        void close( const tripoint &p ) {
+            at_layer( p.z ).closed[index( p )] = true;
+            closed_points.push_back( p );
+        }
+
+        float dist( const tripoint &p ) const {
+            const layer *l = get_layer( p.z );
+            return l != nullptr ? l->dist[index( p )] : unreached;
+        }
+        void set_dist( const tripoint &p, float d ) {
+            at_layer( p.z ).dist[index( p )] = d;
+        }
+
+        /**
+         * Index into the pending bash list, @ref not_bashed if the blast didn't get to
+         * bash the tile yet or @ref bashed_now if it was bashed right away.
+         */
+        int bash_index( const tripoint &p ) const {
+            const layer *l = get_layer( p.z );
+            return l != nullptr ? l->bash[index( p )] : not_bashed;
+        }
+        void set_bash_index( const tripoint &p, int i ) {
+            at_layer( p.z ).bash[index( p )] = i;
+        }
+        static constexpr int not_bashed = -1;
+        static constexpr int bashed_now = -2;
+
+        /** Closed points, in the order the flood fill reached them. */
+        std::vector<tripoint> closed_points;
+
+    private:
+        struct layer {
+            std::vector<bool> closed = std::vector<bool>( MAPSIZE_X * MAPSIZE_Y, false );
+            std::vector<float> dist = std::vector<float>( MAPSIZE_X * MAPSIZE_Y, unreached );
+            std::vector<int> bash = std::vector<int>( MAPSIZE_X * MAPSIZE_Y, not_bashed );
+        };
+
+        static size_t index( const tripoint &p ) {
+            return p.x + p.y * MAPSIZE_X;
+        }
+        const layer *get_layer( int z ) const {
+            return layers[z + OVERMAP_DEPTH].get();
+        }
+        layer &at_layer( int z ) {
+            std::unique_ptr<layer> &l = layers[z + OVERMAP_DEPTH];
+            if( !l ) {
+                l = std::make_unique<layer>();
+            }
+            return *l;
+        }
+
+        std::array<std::unique_ptr<layer>, OVERMAP_LAYERS> layers;
+};
+
+constexpr float blast_grid::unreached;
+constexpr int blast_grid::not_bashed;
+
+/**
+ * Dial's bucket queue with unit-wide buckets. Every step of the blast adds at least one
+ * tile of distance, so a pop never has to look back at an earlier bucket and tiles
+ * sharing a bucket cannot affect each other's distance.
+ */
+class blast_queue
+{
+    public:
+        void push( float dist, const tripoint &p ) {
+            const size_t b = static_cast<size_t>( dist );
+            if( b >= buckets.size() ) {
+                buckets.resize( b + 1 );
+            }
+            buckets[b].emplace_back( dist, p );
+        }
+        bool pop( std::pair<float, tripoint> &out ) {
+            for( ; current < buckets.size(); ++current ) {
+                std::vector<std::pair<float, tripoint>> &bucket = buckets[current];
+                if( !bucket.empty() ) {
+                    out = bucket.back();
+                    bucket.pop_back();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        std::vector<std::vector<std::pair<float, tripoint>>> buckets;
+        size_t current = 0;
+};
+
+/** A horizontal bash of a blast, without floor bashing. */
+struct pending_bash {
+    tripoint p;
+    float force;
+    bool done;
+};
+
+} // namespace
+
+static void apply_bash( map &here, pending_bash &b )
+{
+    if( !b.done ) {
+        b.done = true;
+        here.bash( b.p, b.force, true, false, false );
+    }
+}
+
 // (C1001) Compiler Internal Error on Visual Studio 2015 with Update 2
 static void do_blast( const tripoint &p, const float power,
                       const float distance_factor, const bool fire )
@@ -167,37 +287,54 @@ static void do_blast( const tripoint &p, const float power,
     static const int z_offset[10] = { 0, 0,  0, 0,  0,  0,  0, 0, 1, -1 };
     map &here = get_map();
     const size_t max_index = here.has_zlevels() ? 10 : 8;
+    if( !here.inbounds( p ) ) {
+        return;
+    }
 
-    here.bash( p, fire ? power : ( 2 * power ), true, false, false );
-
-    std::priority_queue< std::pair<float, tripoint>, std::vector< std::pair<float, tripoint> >, pair_greater_cmp_first >
-    open;
-    std::set<tripoint> closed;
-    std::set<tripoint> bashed{ p };
-    std::map<tripoint, float> dist_map;
-    open.push( std::make_pair( 0.0f, p ) );
-    dist_map[p] = 0.0f;
+    // Bashes are collected and applied after the flood fill. The exceptions are bashes
+    // that decide whether the blast can go on: walls it reaches and floors between z-levels.
+    // Either way the map caches are only marked dirty once the whole blast is done.
+    here.defer_cache_invalidation();
+    blast_grid grid;
+    std::vector<pending_bash> bashes;
+    const auto add_bash = [&]( const tripoint & pt, float force ) {
+        grid.set_bash_index( pt, bashes.size() );
+        bashes.push_back( { pt, force, false } );
+    };
+
+    add_bash( p, fire ? power : ( 2 * power ) );
+
+    blast_queue open;
+    open.push( 0.0f, p );
+    grid.set_dist( p, 0.0f );
     // Find all points to blast
-    while( !open.empty() ) {
-        // Add some random factor to effective distance to make it look cooler
-        const float distance = open.top().first * rng_float( 1.0f, 1.2f );
-        const tripoint pt = open.top().second;
-        open.pop();
-
-        if( closed.count( pt ) != 0 ) {
+    std::pair<float, tripoint> top;
+    while( open.pop( top ) ) {
+        const tripoint pt = top.second;
+        if( grid.is_closed( pt ) || top.first > grid.dist( pt ) ) {
+            // Already done, or a better path to this tile was found after this one was queued
             continue;
         }
+        // Add some random factor to effective distance to make it look cooler
+        const float distance = top.first * rng_float( 1.0f, 1.2f );
 
-        closed.insert( pt );
+        grid.close( pt );
 
         const float force = power * std::pow( distance_factor, distance );
         if( force <= 1.0f ) {
             continue;
         }
 
-        if( here.impassable( pt ) && pt != p ) {
-            // Don't propagate further
-            continue;
+        if( pt != p && here.impassable( pt ) ) {
+            // The blast may have knocked this wall down already
+            const int bash_index = grid.bash_index( pt );
+            if( bash_index >= 0 ) {
+                apply_bash( here, bashes[bash_index] );
+            }
+            if( here.impassable( pt ) ) {
+                // Don't propagate further
+                continue;
+            }
         }
 
         // Those will be used for making "shaped charges"
@@ -205,7 +342,8 @@ static void do_blast( const tripoint &p, const float power,
         int empty_neighbors = 0;
         for( size_t i = 0; i < 8; i++ ) {
             tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
-            if( closed.count( dest ) == 0 && here.valid_move( pt, dest, false, true ) ) {
+            if( here.inbounds( dest ) && !grid.is_closed( dest ) &&
+                here.valid_move( pt, dest, false, true ) ) {
                 empty_neighbors++;
             }
         }
@@ -214,12 +352,11 @@ static void do_blast( const tripoint &p, const float power,
         // Iterate over all neighbors. Bash all of them, propagate to some
         for( size_t i = 0; i < max_index; i++ ) {
             tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
-            if( closed.count( dest ) != 0 || !here.inbounds( dest ) ) {
+            if( !here.inbounds( dest ) || grid.is_closed( dest ) ) {
                 continue;
             }
 
-            if( bashed.count( dest ) == 0 ) {
-                bashed.insert( dest );
+            if( grid.bash_index( dest ) == blast_grid::not_bashed ) {
                 // Up to 200% bonus for shaped charge
                 // But not if the explosion is fiery, then only half the force and no bonus
                 const float bash_force = !fire ?
@@ -227,14 +364,17 @@ static void do_blast( const tripoint &p, const float power,
                                          force / 2;
                 if( z_offset[i] == 0 ) {
                     // Horizontal - no floor bashing
-                    here.bash( dest, bash_force, true, false, false );
-                } else if( z_offset[i] > 0 ) {
-                    // Should actually bash through the floor first, but that's not really possible yet
-                    here.bash( dest, bash_force, true, false, true );
-                } else if( !here.valid_move( pt, dest, false, true ) ) {
-                    // Only bash through floor if it doesn't exist
-                    // Bash the current tile's floor, not the one's below
-                    here.bash( pt, bash_force, true, false, true );
+                    add_bash( dest, bash_force );
+                } else {
+                    grid.set_bash_index( dest, blast_grid::bashed_now );
+                    if( z_offset[i] > 0 ) {
+                        // Should actually bash through the floor first, but that's not really possible yet
+                        here.bash( dest, bash_force, true, false, true );
+                    } else if( !here.valid_move( pt, dest, false, true ) ) {
+                        // Only bash through floor if it doesn't exist
+                        // Bash the current tile's floor, not the one's below
+                        here.bash( pt, bash_force, true, false, true );
+                    }
                 }
             }
 
@@ -248,13 +388,23 @@ static void do_blast( const tripoint &p, const float power,
                 next_dist += zlev_dist;
             }
 
-            if( dist_map.count( dest ) == 0 || dist_map[dest] > next_dist ) {
-                open.push( std::make_pair( next_dist, dest ) );
-                dist_map[dest] = next_dist;
+            if( grid.dist( dest ) > next_dist ) {
+                open.push( next_dist, dest );
+                grid.set_dist( dest, next_dist );
             }
         }
     }
 
+    for( pending_bash &b : bashes ) {
+        apply_bash( here, b );
+    }
+    here.flush_cache_invalidation();
+
+    // Same order as the sets this used to be kept in, so the damage rolls below come out
+    // in a stable order.
+    std::vector<tripoint> &closed = grid.closed_points;
+    std::sort( closed.begin(), closed.end() );
+
     // Draw the explosion
     std::map<tripoint, nc_color> explosion_colors;
     for( const tripoint &pt : closed ) {
@@ -262,7 +412,7 @@ static void do_blast( const tripoint &p, const float power,
             continue;
         }
 
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+        const float force = power * std::pow( distance_factor, grid.dist( pt ) );
         nc_color col = c_red;
         if( force < 10 ) {
             col = c_white;
@@ -276,7 +426,7 @@ static void do_blast( const tripoint &p, const float power,
     draw_custom_explosion( get_player_character().pos(), explosion_colors );
 
     for( const tripoint &pt : closed ) {
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+        const float force = power * std::pow( distance_factor, grid.dist( pt ) );
         if( force < 1.0f ) {
             // Too weak to matter
             continue;
@@ -759,8 +909,8 @@ void emp_blast( const tripoint &p )
         // TODO: More effects?
         //e-handcuffs effects
         if( player_character.weapon.typeId() == itype_e_handcuffs && player_character.weapon.charges > 0 ) {
-            player_character.weapon.item_tags.erase( "NO_UNWIELD" );
-            player_character.weapon.charges = 0;
+            player_character.weapon.unset_flag( "NO_UNWIELD" );
+            player_character.weapon.set_charges( 0 );
             player_character.weapon.active = false;
             add_msg( m_good, _( "The %s on your wrists spark briefly, then release your hands!" ),
                      player_character.weapon.tname() );
@@ -769,7 +919,7 @@ void emp_blast( const tripoint &p )
     // Drain any items of their battery charge
     for( item &it : here.i_at( p2 ) ) {
         if( it.is_tool() && it.ammo_current() == itype_battery ) {
-            it.charges = 0;
+            it.set_charges( 0 );
         }
     }
     // TODO: Drain NPC energy reserves
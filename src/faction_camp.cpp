@@ -2348,7 +2348,7 @@ static std::pair<size_t, std::string> farm_action( const tripoint_abs_omt &omt_t
                         std::list<item> used_seed;
                         if( tmp_seed->count_by_charges() ) {
                             used_seed.push_back( *tmp_seed );
-                            tmp_seed->charges -= 1;
+                            tmp_seed->set_charges( tmp_seed->charges - 1 );
                             if( tmp_seed->charges > 0 ) {
                                 seed_inv.push_back( tmp_seed );
                             }
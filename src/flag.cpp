@@ -1,24 +1,136 @@
 #include "flag.h"
 
+#include <cstddef>
+#include <deque>
 #include <unordered_map>
 #include <utility>
 
 #include "debug.h"
 #include "json.h"
 
-static std::unordered_map<std::string, json_flag> json_flags_all;
+namespace
+{
+// Flags are interned on first use and keep their id for the lifetime of the program,
+// so ids resolved during static initialization remain valid across data reloads.
+// Deques keep references to existing flags valid while new ones are interned.
+struct json_flag_registry {
+    std::deque<json_flag> flags;
+    std::deque<flag_str_id> str_ids;
+    std::unordered_map<std::string, int> ids;
+};
+} // namespace
+
+static json_flag_registry &json_flags_all()
+{
+    static json_flag_registry registry;
+    return registry;
+}
+
+template<>
+const json_flag &int_id<json_flag>::obj() const;
+
+/** @relates string_id */
+template<>
+int_id<json_flag> string_id<json_flag>::id() const
+{
+    json_flag_registry &reg = json_flags_all();
+    const int cid = get_cid().to_i();
+    if( cid >= 0 && static_cast<size_t>( cid ) < reg.flags.size() && reg.flags[cid].id_ == str() ) {
+        return int_id<json_flag>( cid );
+    }
+    if( reg.flags.empty() ) {
+        // The null flag always has id 0
+        reg.flags.push_back( json_flag() );
+        reg.str_ids.emplace_back( std::string(), 0 );
+        reg.ids.emplace( std::string(), 0 );
+    }
+    auto iter = reg.ids.find( str() );
+    if( iter == reg.ids.end() ) {
+        const int new_id = static_cast<int>( reg.flags.size() );
+        reg.flags.push_back( json_flag( str() ) );
+        reg.str_ids.emplace_back( str(), new_id );
+        iter = reg.ids.emplace( str(), new_id ).first;
+    }
+    const int_id<json_flag> result( iter->second );
+    set_cid( result );
+    return result;
+}
+
+/** @relates string_id */
+template<>
+const json_flag &string_id<json_flag>::obj() const
+{
+    return id().obj();
+}
+
+/** @relates string_id */
+template<>
+const flag_str_id &string_id<json_flag>::NULL_ID()
+{
+    static const flag_str_id null_id( std::string(), 0 );
+    return null_id;
+}
+
+/** @relates int_id */
+template<>
+int_id<json_flag>::int_id( const string_id<json_flag> &id ) : _id( id.id().to_i() )
+{
+}
+
+/** @relates int_id */
+template<>
+const json_flag &int_id<json_flag>::obj() const
+{
+    json_flag_registry &reg = json_flags_all();
+    if( reg.flags.empty() ) {
+        flag_str_id::NULL_ID().id();
+    }
+    if( _id < 0 || static_cast<size_t>( _id ) >= reg.flags.size() ) {
+        debugmsg( "invalid flag id %d", _id );
+        return reg.flags.front();
+    }
+    return reg.flags[_id];
+}
+
+/** @relates int_id */
+template<>
+const string_id<json_flag> &int_id<json_flag>::id() const
+{
+    return obj().id_.empty() ? flag_str_id::NULL_ID() : json_flags_all().str_ids[_id];
+}
+
+/** @relates int_id */
+template<>
+bool int_id<json_flag>::is_valid() const
+{
+    return obj().defined_;
+}
+
+/** @relates string_id */
+template<>
+bool string_id<json_flag>::is_valid() const
+{
+    return id().is_valid();
+}
 
 const json_flag &json_flag::get( const std::string &id )
 {
-    static json_flag null_flag;
-    auto iter = json_flags_all.find( id );
-    return iter != json_flags_all.end() ? iter->second : null_flag;
+    const json_flag &f = lookup( id ).obj();
+    return f.defined_ ? f : flag_id().obj();
+}
+
+flag_id json_flag::lookup( const std::string &id )
+{
+    const json_flag_registry &reg = json_flags_all();
+    const auto iter = reg.ids.find( id );
+    return iter != reg.ids.end() ? flag_id( iter->second ) : flag_id();
 }
 
 void json_flag::load( const JsonObject &jo )
 {
     auto id = jo.get_string( "id" );
-    auto &f = json_flags_all.emplace( id, json_flag( id ) ).first->second;
+    json_flag &f = json_flags_all().flags[flag_str_id( id ).id().to_i()];
+    f.defined_ = true;
 
     jo.read( "info", f.info_ );
     jo.read( "conflicts", f.conflicts_ );
@@ -34,10 +146,9 @@ void json_flag::load( const JsonObject &jo )
 
 void json_flag::check_consistency()
 {
-    for( const auto &e : json_flags_all ) {
-        const auto &f = e.second;
+    for( const json_flag &f : json_flags_all().flags ) {
         for( const std::string &conflicting : f.conflicts_ ) {
-            if( !json_flags_all.count( conflicting ) ) {
+            if( !json_flag::get( conflicting ) ) {
                 debugmsg( "flag definition %s specifies unknown conflicting field %s",
                           f.id(), conflicting );
             }
@@ -47,5 +158,24 @@ void json_flag::check_consistency()
 
 void json_flag::reset()
 {
-    json_flags_all.clear();
+    for( json_flag &f : json_flags_all().flags ) {
+        f = json_flag( f.id_ );
+    }
+}
+
+void flag_bitset::set( const flag_id &f )
+{
+    const size_t i = f.to_i();
+    if( i / 64 >= bits.size() ) {
+        bits.resize( i / 64 + 1, 0 );
+    }
+    bits[i / 64] |= uint64_t( 1 ) << ( i % 64 );
+}
+
+void flag_bitset::reset( const flag_id &f )
+{
+    const size_t i = f.to_i();
+    if( i / 64 < bits.size() ) {
+        bits[i / 64] &= ~( uint64_t( 1 ) << ( i % 64 ) );
+    }
 }
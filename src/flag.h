@@ -2,19 +2,29 @@
 #ifndef CATA_SRC_FLAG_H
 #define CATA_SRC_FLAG_H
 
+#include <cstddef>
+#include <cstdint>
 #include <set>
 #include <string>
+#include <vector>
+
+#include "type_id.h"
 
 class JsonObject;
 
 class json_flag
 {
         friend class DynamicDataLoader;
+        friend class int_id<json_flag>;
+        friend class string_id<json_flag>;
 
     public:
         /** Fetches flag definition (or null flag if not found) */
         static const json_flag &get( const std::string &id );
 
+        /** Id of flag @p id if it was ever interned, the null id otherwise; never interns it */
+        static flag_id lookup( const std::string &id );
+
         /** Get identifier of flag as specified in JSON */
         const std::string &id() const {
             return id_;
@@ -51,7 +61,9 @@ class json_flag
         }
 
     private:
-        const std::string id_;
+        std::string id_;
+        /** Whether the flag was defined in JSON, rather than only referenced by its id */
+        bool defined_ = false;
         std::string info_;
         std::set<std::string> conflicts_;
         bool inherit_ = true;
@@ -67,8 +79,29 @@ class json_flag
         /** Check consistency of all loaded flags */
         static void check_consistency();
 
-        /** Clear all loaded flags (invalidating any pointers) */
+        /** Clear all loaded flag definitions; interned flag ids stay valid */
         static void reset();
 };
 
+/**
+ * Set of flags backed by a bitset indexed by @ref flag_id.
+ * Mirrors string flag sets whose membership is tested in hot paths.
+ */
+class flag_bitset
+{
+    public:
+        bool test( const flag_id &f ) const {
+            const size_t i = f.to_i();
+            return i / 64 < bits.size() && ( ( bits[i / 64] >> ( i % 64 ) ) & 1 );
+        }
+        void set( const flag_id &f );
+        void reset( const flag_id &f );
+        void clear() {
+            bits.clear();
+        }
+
+    private:
+        std::vector<uint64_t> bits;
+};
+
 #endif // CATA_SRC_FLAG_H
@@ -128,6 +128,7 @@
 #include "player_activity.h"
 #include "popup.h"
 #include "profession.h"
+#include "profiler.h"
 #include "recipe.h"
 #include "recipe_dictionary.h"
 #include "ret_val.h"
@@ -262,6 +263,15 @@ static const trap_str_id tr_unfinished_construction( "tr_unfinished_construction
 
 static const faction_id faction_your_followers( "your_followers" );
 
+static const option_handle<bool> option_AUTOSAFEMODE( "AUTOSAFEMODE" );
+static const option_handle<int> option_AUTOSAFEMODETURNS( "AUTOSAFEMODETURNS" );
+static const option_handle<bool> option_AUTOSAVE( "AUTOSAVE" );
+static const option_handle<int> option_AUTOSAVE_TURNS( "AUTOSAVE_TURNS" );
+static const option_handle<bool> option_FORCE_REDRAW( "FORCE_REDRAW" );
+static const option_handle<int> option_SAFEMODEIGNORETURNS( "SAFEMODEIGNORETURNS" );
+static const option_handle<int> option_SAFEMODEPROXIMITY( "SAFEMODEPROXIMITY" );
+static const option_handle<bool> option_VEHICLE_DIR_INDICATOR( "VEHICLE_DIR_INDICATOR" );
+
 #if defined(__ANDROID__)
 extern std::map<std::string, std::list<input_event>> quick_shortcuts_map;
 extern bool add_best_key_for_action_to_quick_shortcuts( action_id action,
@@ -643,6 +653,7 @@ void game::setup()
     // reset follower list
     follower_ids.clear();
     scent.reset();
+    clear_loot_sort_plans();
 
     remoteveh_cache_time = calendar::before_time_starts;
     remoteveh_cache = nullptr;
@@ -949,6 +960,9 @@ void game::load_npcs()
     for( const auto &npc : just_added ) {
         npc->on_load();
     }
+    if( !just_added.empty() ) {
+        avatar::invalidate_visible_creatures();
+    }
 
     npcs_dirty = false;
 }
@@ -960,6 +974,7 @@ void game::unload_npcs()
     }
 
     active_npc.clear();
+    avatar::invalidate_visible_creatures();
 }
 
 void game::reload_npcs()
@@ -1280,6 +1295,7 @@ bool game::cleanup_at_end()
 
     MAPBUFFER.reset();
     overmap_buffer.clear();
+    clear_loot_sort_plans();
 
 #if defined(__ANDROID__)
     quick_shortcuts_map.clear();
@@ -1455,8 +1471,8 @@ bool game::do_turn()
     u.update_body();
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( option_AUTOSAVE &&
+        calendar::once_every( 1_turns * option_AUTOSAVE_TURNS.get() ) &&
         !u.is_dead_state() ) {
         autosave();
     }
@@ -1592,7 +1608,7 @@ bool game::do_turn()
     update_stair_monsters();
     mon_info_update();
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( u.moves < 0 && option_FORCE_REDRAW ) {
         ui_manager::redraw();
         refresh_display();
     }
@@ -1662,6 +1678,7 @@ bool game::do_turn()
     // reset player noise
     u.volume = 0;
 
+    profiler::end_turn();
     return false;
 }
 
@@ -2902,6 +2919,7 @@ bool game::load( const std::string &world )
 
 bool game::load( const save_t &name )
 {
+    CATA_PROFILE_ZONE( "load" );
     background_pane background;
     static_popup popup;
     popup.message( "%s", _( "Please wait…\nLoading the save…" ) );
@@ -3185,6 +3203,7 @@ spell_events &game::spell_events_subscriber()
 
 bool game::save()
 {
+    CATA_PROFILE_ZONE( "save" );
     std::chrono::seconds time_since_load =
         std::chrono::duration_cast<std::chrono::seconds>(
             std::chrono::steady_clock::now() - time_of_last_load );
@@ -3612,6 +3631,29 @@ void game::draw()
     wnoutrefresh( w_terrain );
 
     draw_panels( true );
+    if( profiler::enabled() ) {
+        draw_profiler_overlay();
+    }
+}
+
+void game::draw_profiler_overlay()
+{
+    const std::vector<std::pair<std::string, double>> &zones = profiler::last_turn();
+    int width = utf8_width( _( "Last turn" ) );
+    for( const std::pair<std::string, double> &zone : zones ) {
+        width = std::max( width, utf8_width( zone.first ) + 10 );
+    }
+    const int height = std::min( static_cast<int>( zones.size() ) + 1, TERMY );
+    const bool sidebar_right = get_option<std::string>( "SIDEBAR_POSITION" ) == "right";
+    catacurses::window w = catacurses::newwin( height, width,
+                           point( sidebar_right ? 0 : TERMX - width, 0 ) );
+    werase( w );
+    mvwprintz( w, point_zero, c_light_red, _( "Last turn" ) );
+    for( int i = 0; i + 1 < height; ++i ) {
+        mvwprintz( w, point( 0, i + 1 ), c_light_gray, zones[i].first );
+        right_print( w, i + 1, 0, c_white, string_format( "%.2f ms", zones[i].second ) );
+    }
+    wnoutrefresh( w );
 }
 
 void game::draw_panels( bool force_draw )
@@ -3760,7 +3802,7 @@ void game::draw_ter( const tripoint &center, const bool looking, const bool draw
 
 cata::optional<tripoint> game::get_veh_dir_indicator_location( bool next ) const
 {
-    if( !get_option<bool>( "VEHICLE_DIR_INDICATOR" ) ) {
+    if( !option_VEHICLE_DIR_INDICATOR ) {
         return cata::nullopt;
     }
     const optional_vpart_position vp = m.veh_at( u.pos() );
@@ -4083,9 +4125,9 @@ Creature *game::is_hostile_very_close()
 
 Creature *game::is_hostile_within( int distance )
 {
-    for( auto &critter : u.get_visible_creatures( distance ) ) {
-        if( u.attitude_to( *critter ) == Creature::Attitude::HOSTILE ) {
-            return critter;
+    for( const visible_creature &seen : u.visible_creatures() ) {
+        if( seen.distance <= distance && seen.attitude == Creature::Attitude::HOSTILE ) {
+            return seen.critter;
         }
     }
 
@@ -4303,7 +4345,7 @@ void game::mon_info( const catacurses::window &w, int hor_padding )
 void game::mon_info_update( )
 {
     int newseen = 0;
-    const int safe_proxy_dist = get_option<int>( "SAFEMODEPROXIMITY" );
+    const int safe_proxy_dist = option_SAFEMODEPROXIMITY;
     const int iProxyDist = ( safe_proxy_dist <= 0 ) ? MAX_VIEW_DISTANCE :
                            safe_proxy_dist;
 
@@ -4330,12 +4372,14 @@ void game::mon_info_update( )
     static int previous_turn = 0;
     // TODO: change current_turn to time_point
     const int current_turn = to_turns<int>( calendar::turn - calendar::turn_zero );
-    const int sm_ignored_turns = get_option<int>( "SAFEMODEIGNORETURNS" );
-
-    for( Creature *c : u.get_visible_creatures( MAPSIZE_X ) ) {
-        monster *m = dynamic_cast<monster *>( c );
-        npc *p = dynamic_cast<npc *>( c );
-        const direction dir_to_mon = direction_from( view.xy(), point( c->posx(), c->posy() ) );
+    const int sm_ignored_turns = option_SAFEMODEIGNORETURNS;
+
+    for( const visible_creature &seen : u.visible_creatures() ) {
+        const Creature *c = seen.critter;
+        monster *m = seen.mon;
+        npc *p = seen.guy;
+        const direction dir_to_mon = view.xy() == u.pos().xy() ? seen.dir :
+                                     direction_from( view.xy(), point( c->posx(), c->posy() ) );
         const int mx = POSX + ( c->posx() - view.x );
         const int my = POSY + ( c->posy() - view.y );
         int index = 8;
@@ -4399,7 +4443,7 @@ void game::mon_info_update( )
             monster &critter = *m;
 
             const monster_attitude matt = critter.attitude( &u );
-            const int mon_dist = rl_dist( u.pos(), critter.pos() );
+            const int mon_dist = seen.distance;
             safemode_state = get_safemode().check_monster( critter.name(), critter.attitude_to( u ), mon_dist );
 
             if( ( !safemode_empty && safemode_state == rule_state::BLACKLISTED ) || ( safemode_empty &&
@@ -4435,7 +4479,7 @@ void game::mon_info_update( )
         } else if( p != nullptr ) {
             //Safe mode NPC check
 
-            const int npc_dist = rl_dist( u.pos(), p->pos() );
+            const int npc_dist = seen.distance;
             safemode_state = get_safemode().check_monster( get_safemode().npc_type_name(), p->attitude_to( u ),
                              npc_dist );
 
@@ -4478,10 +4522,10 @@ void game::mon_info_update( )
         if( safe_mode == SAFE_MODE_ON ) {
             set_safe_mode( SAFE_MODE_STOP );
         }
-    } else if( current_turn > previous_turn && get_option<bool>( "AUTOSAFEMODE" ) &&
+    } else if( current_turn > previous_turn && option_AUTOSAFEMODE &&
                newseen == 0 ) { // Auto-safe mode, but only if it's a new turn
         turnssincelastmon += current_turn - previous_turn;
-        if( turnssincelastmon >= get_option<int>( "AUTOSAFEMODETURNS" ) && safe_mode == SAFE_MODE_OFF ) {
+        if( turnssincelastmon >= option_AUTOSAFEMODETURNS && safe_mode == SAFE_MODE_OFF ) {
             set_safe_mode( SAFE_MODE_ON );
             add_msg( m_info, _( "Safe mode ON!" ) );
         }
@@ -4532,6 +4576,7 @@ void game::cleanup_dead()
 
 void game::monmove()
 {
+    CATA_PROFILE_ZONE( "monmove" );
     cleanup_dead();
 
     for( monster &critter : all_monsters() ) {
@@ -7526,7 +7571,8 @@ void game::reset_item_list_state( const catacurses::window &window, int height,
 
 void game::list_items_monsters()
 {
-    std::vector<Creature *> mons = u.get_visible_creatures( current_daylight_level( calendar::turn ) );
+    std::vector<Creature *> mons = u.visible_creatures_in_range( current_daylight_level(
+                                       calendar::turn ) );
     // whole reality bubble
     const std::vector<map_item_stack> items = find_nearby_items( 60 );
 
@@ -11256,6 +11302,7 @@ point game::update_map( int &x, int &y )
             //Remove the npc from the active list. It remains in the overmap list.
             ( *it )->on_unload();
             it = active_npc.erase( it );
+            avatar::invalidate_visible_creatures();
         } else {
             it++;
         }
@@ -11288,6 +11335,9 @@ point game::update_map( int &x, int &y )
     // This call will generate new monsters in addition to loading, so it's placed after NPC loading
     m.spawn_monsters( false ); // Static monsters
 
+    // Have the overmaps around us generated before anything needs them
+    overmap_buffer.pregenerate_around( project_to<coords::om>( u.global_omt_location().xy() ) );
+
     // Update what parts of the world map we can see
     update_overmap_seen();
 
@@ -11878,13 +11928,13 @@ void game::process_artifact( item &it, player &p )
                     case ARTC_TIME:
                         // Once per hour
                         if( calendar::once_every( 1_hours ) ) {
-                            it.charges++;
+                            it.set_charges( it.charges + 1 );
                         }
                         break;
                     case ARTC_SOLAR:
                         if( calendar::once_every( 10_minutes ) &&
                             is_in_sunlight( p.pos() ) ) {
-                            it.charges++;
+                            it.set_charges( it.charges + 1 );
                         }
                         break;
                     // Artifacts can inflict pain even on Deadened folks.
@@ -11894,14 +11944,14 @@ void game::process_artifact( item &it, player &p )
                         if( calendar::once_every( 1_minutes ) ) {
                             add_msg( m_bad, _( "You suddenly feel sharp pain for no reason." ) );
                             p.mod_pain_noresist( 3 * rng( 1, 3 ) );
-                            it.charges++;
+                            it.set_charges( it.charges + 1 );
                         }
                         break;
                     case ARTC_HP:
                         if( calendar::once_every( 1_minutes ) ) {
                             add_msg( m_bad, _( "You feel your body decaying." ) );
                             p.hurtall( 1, nullptr );
-                            it.charges++;
+                            it.set_charges( it.charges + 1 );
                         }
                         break;
                     case ARTC_FATIGUE:
@@ -11909,7 +11959,7 @@ void game::process_artifact( item &it, player &p )
                             add_msg( m_bad, _( "You feel fatigue seeping into your body." ) );
                             u.mod_fatigue( 3 * rng( 1, 3 ) );
                             u.mod_stamina( -90 * rng( 1, 3 ) * rng( 1, 3 ) * rng( 2, 3 ) );
-                            it.charges++;
+                            it.set_charges( it.charges + 1 );
                         }
                         break;
                     // Portals are energetic enough to charge the item.
@@ -11920,7 +11970,7 @@ void game::process_artifact( item &it, player &p )
                             if( m.tr_at( dest ) == tr_portal ) {
                                 add_msg( m_good, _( "The portal collapses!" ) );
                                 m.remove_trap( dest );
-                                it.charges++;
+                                it.set_charges( it.charges + 1 );
                                 break;
                             }
                         }
@@ -19,6 +19,7 @@
 #include "character.h"
 #include "color.h"
 #include "compatibility.h"
+#include "crafting_inventory_view.h"
 #include "cursesdef.h"
 #include "damage.h"
 #include "debug.h"
@@ -1295,12 +1296,12 @@ void game_menus::inv::insert_items( avatar &you, item_location &holster )
             }
         } else {
             item item_copy( it );
-            item_copy.charges = holstered_item.second;
+            item_copy.set_charges( holstered_item.second );
 
             if( holster.parents_can_contain_recursive( &item_copy ) ) {
                 success = holster->put_in( item_copy, item_pocket::pocket_type::CONTAINER ).success();
                 if( success ) {
-                    it.charges -= holstered_item.second;
+                    it.set_charges( it.charges - holstered_item.second );
                 }
             }
         }
@@ -1961,7 +1962,7 @@ class bionic_sterilize_preset : public inventory_selector_preset
             if( loc.get_item()->has_flag( flag_NO_PACKED ) ) {
                 return  _( "You should put this CBM in an autoclave pouch to keep it sterile." );
             }
-            if( !reqs.can_make_with_inventory( p.crafting_inventory(), is_crafting_component ) ) {
+            if( !reqs.can_make_with_inventory( p.crafting_view(), is_crafting_component ) ) {
                 return _( "You need at least 2L of water." );
             }
 
@@ -336,7 +336,7 @@ static bool perform_liquid_transfer( item &liquid, const tripoint *const source_
     switch( target.dest_opt ) {
         case LD_CONSUME:
             player_character.assign_activity( player_activity( consume_activity_actor( liquid ) ) );
-            liquid.charges--;
+            liquid.set_charges( liquid.charges - 1 );
             transfer_ok = true;
             break;
         case LD_ITEM: {
@@ -385,7 +385,7 @@ static bool perform_liquid_transfer( item &liquid, const tripoint *const source_
                     iexamine::pour_into_keg( target.pos, liquid );
                 } else {
                     here.add_item_or_charges( target.pos, liquid );
-                    liquid.charges = 0;
+                    liquid.set_charges( 0 );
                 }
                 player_character.mod_moves( -100 );
             }
@@ -29,6 +29,7 @@
 #include "coordinate_conversions.h"
 #include "coordinates.h"
 #include "craft_command.h"
+#include "crafting_inventory_view.h"
 #include "creature.h"
 #include "cursesdef.h"
 #include "damage.h"
@@ -262,7 +263,7 @@ void iexamine::cvdmachine( player &p, const tripoint & )
     qty = std::max( 1, qty );
     auto reqs = *requirement_id( "cvd_diamond" ) * qty;
 
-    if( !reqs.can_make_with_inventory( p.crafting_inventory(), is_crafting_component ) ) {
+    if( !reqs.can_make_with_inventory( p.crafting_view(), is_crafting_component ) ) {
         popup( "%s", reqs.list_missing() );
         return;
     }
@@ -277,7 +278,7 @@ void iexamine::cvdmachine( player &p, const tripoint & )
     p.invalidate_crafting_inventory();
 
     // Apply flag to item
-    loc->item_tags.insert( "DIAMOND" );
+    loc->set_flag( "DIAMOND" );
     add_msg( m_good, _( "You apply a diamond coating to your %s" ), loc->type_name() );
     p.mod_moves( -to_turns<int>( 10_seconds ) );
 }
@@ -315,7 +316,7 @@ void iexamine::nanofab( player &p, const tripoint &examp )
     auto qty = std::max( 1, new_item.volume() / 250_ml );
     auto reqs = *requirement_id( "nanofabricator" ) * qty;
 
-    if( !reqs.can_make_with_inventory( p.crafting_inventory(), is_crafting_component ) ) {
+    if( !reqs.can_make_with_inventory( p.crafting_view(), is_crafting_component ) ) {
         popup( "%s", reqs.list_missing() );
         return;
     }
@@ -330,7 +331,7 @@ void iexamine::nanofab( player &p, const tripoint &examp )
     p.invalidate_crafting_inventory();
 
     if( new_item.is_armor() && new_item.has_flag( flag_VARSIZE ) ) {
-        new_item.item_tags.insert( "FIT" );
+        new_item.set_flag( "FIT" );
     }
 
     here.add_item_or_charges( spawn_point, new_item );
@@ -2193,10 +2194,10 @@ std::list<item> iexamine::get_harvest_items( const itype &type, const int plant_
     const auto add = [&]( const itype_id & id, const int count ) {
         item new_item( id, calendar::turn );
         if( new_item.count_by_charges() && count > 0 ) {
-            new_item.charges *= count;
-            new_item.charges /= seed_data.fruit_div;
+            new_item.set_charges( new_item.charges * count );
+            new_item.set_charges( new_item.charges / seed_data.fruit_div );
             if( new_item.charges <= 0 ) {
-                new_item.charges = 1;
+                new_item.set_charges( 1 );
             }
             result.push_back( new_item );
         } else if( count > 0 ) {
@@ -2487,7 +2488,7 @@ void iexamine::kiln_empty( player &p, const tripoint &examp )
     here.i_clear( examp );
     here.furn_set( examp, next_kiln_type );
     item result( "unfinished_charcoal", calendar::turn );
-    result.charges = char_charges;
+    result.set_charges( char_charges );
     here.add_item( examp, result );
     add_msg( _( "You fire the charcoal kiln." ) );
 }
@@ -2544,7 +2545,7 @@ void iexamine::kiln_full( player &, const tripoint &examp )
     }
 
     item result( "charcoal", calendar::turn );
-    result.charges = char_type->charges_per_volume( total_volume );
+    result.set_charges( char_type->charges_per_volume( total_volume ) );
     here.add_item( examp, result );
     here.furn_set( examp, next_kiln_type );
     add_msg( _( "It has finished burning, yielding %d charcoal." ), result.charges );
@@ -2618,7 +2619,7 @@ void iexamine::arcfurnace_empty( player &p, const tripoint &examp )
     here.i_clear( examp );
     here.furn_set( examp, next_arcfurnace_type );
     item result( "unfinished_cac2", calendar::turn );
-    result.charges = char_charges;
+    result.set_charges( char_charges );
     here.add_item( examp, result );
     add_msg( _( "You turn on the furnace." ) );
 }
@@ -2673,7 +2674,7 @@ void iexamine::arcfurnace_full( player &, const tripoint &examp )
     }
 
     item result( "chem_carbide", calendar::turn );
-    result.charges = char_type->charges_per_volume( total_volume );
+    result.set_charges( char_type->charges_per_volume( total_volume ) );
     here.add_item( examp, result );
     here.furn_set( examp, next_arcfurnace_type );
     add_msg( _( "It has finished burning, yielding %d calcium carbide." ), result.charges );
@@ -2718,7 +2719,7 @@ void iexamine::autoclave_empty( player &p, const tripoint &examp )
     }
     auto reqs = *requirement_id( "autoclave" );
 
-    if( !reqs.can_make_with_inventory( p.crafting_inventory(), is_crafting_component ) ) {
+    if( !reqs.can_make_with_inventory( p.crafting_view(), is_crafting_component ) ) {
         popup( "%s", reqs.list_missing() );
         return;
     }
@@ -2998,10 +2999,10 @@ void iexamine::fvat_empty( player &p, const tripoint &examp )
     if( to_deposit ) {
         item brew( brew_type, 0 );
         int charges_held = p.charges_of( brew_type );
-        brew.charges = charges_on_ground;
+        brew.set_charges( charges_on_ground );
         for( int i = 0; i < charges_held && !vat_full; i++ ) {
             p.use_charges( brew_type, 1 );
-            brew.charges++;
+            brew.set_charges( brew.charges + 1 );
             if( brew.volume() >= vat_volume ) {
                 vat_full = true;
             }
@@ -3206,12 +3207,12 @@ void iexamine::keg( player &p, const tripoint &examp )
         int charges_held = p.charges_of( drink_type );
         item drink( drink_type, 0 );
         drink.set_relative_rot( drink_rot[ drink_index ] );
-        drink.charges = 0;
+        drink.set_charges( 0 );
         bool keg_full = false;
         Character &player_character = get_player_character();
         for( int i = 0; i < charges_held && !keg_full; i++ ) {
             player_character.use_charges( drink.typeId(), 1 );
-            drink.charges++;
+            drink.set_charges( drink.charges + 1 );
             keg_full = drink.volume() >= keg_cap;
         }
         if( keg_full ) {
@@ -3263,7 +3264,7 @@ void iexamine::keg( player &p, const tripoint &examp )
                     return; // They didn't actually drink
                 }
                 p.assign_activity( player_activity( consume_activity_actor( drink ) ) );
-                drink.charges--;
+                drink.set_charges( drink.charges - 1 );
                 if( drink.charges == 0 ) {
                     add_msg( _( "You squeeze the last drops of %1$s from the %2$s." ),
                              drink_tname, keg_name );
@@ -3319,7 +3320,7 @@ bool iexamine::pour_into_keg( const tripoint &pos, item &liquid )
     map_stack stack = here.i_at( pos );
     if( stack.empty() ) {
         here.add_item( pos, liquid );
-        here.i_at( pos ).only_item().charges = 0; // Will be set later
+        here.i_at( pos ).only_item().set_charges( 0 ); // Will be set later
     } else if( stack.only_item().typeId() != liquid.typeId() ) {
         add_msg( _( "The %s already contains some %s, you can't add a different liquid to it." ),
                  keg_name, item::nname( stack.only_item().typeId() ) );
@@ -3334,8 +3335,8 @@ bool iexamine::pour_into_keg( const tripoint &pos, item &liquid )
 
     add_msg( _( "You pour %1$s into the %2$s." ), liquid.tname(), keg_name );
     while( liquid.charges > 0 && drink.volume() < keg_cap ) {
-        drink.charges++;
-        liquid.charges--;
+        drink.set_charges( drink.charges + 1 );
+        liquid.set_charges( liquid.charges - 1 );
     }
     return true;
 }
@@ -3904,7 +3905,7 @@ void iexamine::reload_furniture( player &p, const tripoint &examp )
     map_stack items = here.i_at( examp );
     for( auto &itm : items ) {
         if( itm.type == ammo ) {
-            itm.charges += amount;
+            itm.set_charges( itm.charges + amount );
             amount = 0;
             break;
         }
@@ -4186,7 +4187,7 @@ bool iexamine::toPumpFuel( const tripoint &src, const tripoint &dst, int units )
                 return false;
             }
 
-            item_it->charges -= units;
+            item_it->set_charges( item_it->charges - units );
 
             item liq_d( item_it->type, calendar::turn, units );
 
@@ -4422,7 +4423,7 @@ void iexamine::pay_gas( player &p, const tripoint &examp )
         if( amount >= 0 ) {
             sounds::sound( p.pos(), 6, sounds::sound_t::activity, _( "Glug Glug Glug" ), true, "tool",
                            "gaspump" );
-            cashcard->charges += amount * pricePerUnit / 1000.0f;
+            cashcard->set_charges( cashcard->charges + amount * pricePerUnit / 1000.0f );
             add_msg( m_info, _( "Your cash cards now hold %s." ),
                      format_money( p.charges_of( itype_cash_card ) ) );
             p.moves -= to_moves<int>( 5_seconds );
@@ -5193,7 +5194,7 @@ static void smoker_activate( player &p, const tripoint &examp )
     if( charcoal->charges == char_charges ) {
         here.i_rem( examp, charcoal );
     } else {
-        charcoal->charges -= char_charges;
+        charcoal->set_charges( charcoal->charges - char_charges );
     }
     item result( "fake_smoke_plume", calendar::turn );
     result.item_counter = to_turns<int>( 6_hours );
@@ -606,6 +606,7 @@ void DynamicDataLoader::finalize_loaded_data( loading_ui &ui )
                 }
             },
             { _( "Monster groups" ), &MonsterGroupManager::FinalizeMonsterGroups },
+            { _( "Mapgen programs" ), &compile_mapgen },
             { _( "Monster factions" ), &monfactions::finalize },
             { _( "Factions" ), &npc_factions::finalize },
             { _( "Move modes" ), &move_mode::finalize },
@@ -44,10 +44,11 @@ static const itype_id itype_tramadol( "tramadol" );
 static const itype_id itype_oxycodone( "oxycodone" );
 static const itype_id itype_water( "water" );
 
-static const std::string flag_LEAK_ALWAYS( "LEAK_ALWAYS" );
-static const std::string flag_LEAK_DAM( "LEAK_DAM" );
-static const std::string flag_WATERPROOF( "WATERPROOF" );
-static const std::string flag_WATERPROOF_GUN( "WATERPROOF_GUN" );
+static const flag_id flag_LEAK_ALWAYS( "LEAK_ALWAYS" );
+static const flag_id flag_LEAK_DAM( "LEAK_DAM" );
+static const flag_id flag_TREE( "TREE" );
+static const flag_id flag_WATERPROOF( "WATERPROOF" );
+static const flag_id flag_WATERPROOF_GUN( "WATERPROOF_GUN" );
 
 struct itype;
 
@@ -371,7 +372,7 @@ void inventory::restack( Character &p )
         for( invstack::iterator other = iter; other != items.end(); ++other ) {
             if( iter != other && iter->front().stacks_with( other->front() ) ) {
                 if( other->front().count_by_charges() ) {
-                    iter->front().charges += other->front().charges;
+                    iter->front().set_charges( iter->front().charges + other->front().charges );
                 } else {
                     iter->splice( iter->begin(), *other );
                 }
@@ -445,172 +446,174 @@ void inventory::form_from_map( map &m, const tripoint &origin, int range, const
     form_from_map( m, reachable_pts, pl, assign_invlet );
 }
 
+void for_each_crafting_pseudo_item( map &m, const tripoint &p,
+                                    const std::function<void( item & )> &func )
+{
+    // a temporary hack while trees are terrain
+    if( m.ter( p )->has_flag( flag_TREE ) ) {
+        item tree_pseudo( "butchery_tree_pseudo" );
+        tree_pseudo.set_flag( "PSEUDO" );
+        func( tree_pseudo );
+    }
+    if( m.has_furn( p ) ) {
+        const furn_t &f = m.furn( p ).obj();
+        const itype *type = f.crafting_pseudo_item_type();
+        if( type != nullptr ) {
+            const itype *ammo = f.crafting_ammo_item_type();
+            item furn_item( type, calendar::turn, 0 );
+            if( furn_item.contents.has_pocket_type( item_pocket::pocket_type::MAGAZINE ) ) {
+                // NOTE: This only works if the pseudo item has a MAGAZINE pocket, not a MAGAZINE_WELL!
+                item furn_ammo( ammo, calendar::turn, count_charges_in_list( ammo, m.i_at( p ) ) );
+                furn_item.put_in( furn_ammo, item_pocket::pocket_type::MAGAZINE );
+            }
+            furn_item.set_flag( "PSEUDO" );
+            func( furn_item );
+        }
+    }
+    // Kludges for now!
+    if( m.has_nearby_fire( p, 0 ) ) {
+        item fire( "fire", 0 );
+        fire.set_charges( 1 );
+        func( fire );
+    }
+    // Handle any water from infinite map sources.
+    item water = m.water_from( p );
+    if( !water.is_null() ) {
+        func( water );
+    }
+
+    // WARNING: The part below has a bug that's currently quite minor
+    // When a vehicle has multiple faucets in range, available water is
+    //  multiplied by the number of faucets.
+    // Same thing happens for all other tools and resources, but not cargo
+    const optional_vpart_position vp = m.veh_at( p );
+    if( !vp ) {
+        return;
+    }
+    vehicle *const veh = &vp->vehicle();
+
+    //Adds faucet to kitchen stuff; may be horribly wrong to do such....
+    //ShouldBreak into own variable
+    const cata::optional<vpart_reference> kpart = vp.part_with_feature( "KITCHEN", true );
+    const cata::optional<vpart_reference> faupart = vp.part_with_feature( "FAUCET", true );
+    const cata::optional<vpart_reference> weldpart = vp.part_with_feature( "WELDRIG", true );
+    const cata::optional<vpart_reference> craftpart = vp.part_with_feature( "CRAFTRIG", true );
+    const cata::optional<vpart_reference> forgepart = vp.part_with_feature( "FORGE", true );
+    const cata::optional<vpart_reference> kilnpart = vp.part_with_feature( "KILN", true );
+    const cata::optional<vpart_reference> chempart = vp.part_with_feature( "CHEMLAB", true );
+
+    if( faupart ) {
+        for( const auto &it : veh->fuels_left() ) {
+            item fuel( it.first, 0 );
+            if( fuel.made_of( phase_id::LIQUID ) ) {
+                fuel.set_charges( it.second );
+                func( fuel );
+            }
+        }
+    }
+    const auto item_with_battery = []( const std::string & id, const int qty ) {
+        item it( id );
+        item it_batt( it.magazine_default() );
+        it_batt.ammo_set( it_batt.ammo_default(), qty );
+        it.put_in( it_batt, item_pocket::pocket_type::MAGAZINE_WELL );
+        it.set_flag( "PSEUDO" );
+        return it;
+    };
+    int veh_battery = veh->fuel_left( itype_id( "battery" ), true );
+    if( kpart ) {
+        item hotplate = item_with_battery( "hotplate", veh_battery );
+        func( hotplate );
+
+        item pot( "pot", 0 );
+        pot.set_flag( "PSEUDO" );
+        func( pot );
+        item pan( "pan", 0 );
+        pan.set_flag( "PSEUDO" );
+        func( pan );
+    }
+    if( weldpart ) {
+        item welder = item_with_battery( "welder", veh_battery );
+        func( welder );
+        item soldering_iron = item_with_battery( "soldering_iron", veh_battery );
+        func( soldering_iron );
+    }
+    if( craftpart ) {
+        item vac_sealer = item_with_battery( "vac_sealer", veh_battery );
+        func( vac_sealer );
+
+        item dehydrator = item_with_battery( "dehydrator", veh_battery );
+        func( dehydrator );
+
+        item food_processor = item_with_battery( "food_processor", veh_battery );
+        func( food_processor );
+
+        item press = item( "press" );
+        press.set_flag( "PSEUDO" );
+        func( press );
+    }
+    if( forgepart ) {
+        item forge = item_with_battery( "forge", veh_battery );
+        func( forge );
+    }
+    if( kilnpart ) {
+        item kiln = item_with_battery( "kiln", veh_battery );
+        func( kiln );
+    }
+    if( chempart ) {
+        item chemistry_set = item_with_battery( "chemistry_set", veh_battery );
+        func( chemistry_set );
+
+        item electrolysis_kit = item_with_battery( "electrolysis_kit", veh_battery );
+        func( electrolysis_kit );
+    }
+}
+
+bool is_crafting_map_item( const map &m, const tripoint &p, const item &it, const Character *pl )
+{
+    if( !it.made_of( phase_id::LIQUID ) ) {
+        // if it's *the* player requesting this from from map inventory
+        // then don't allow items owned by another faction to be factored into recipe components etc.
+        return !pl || it.is_owned_by( *pl, true );
+    }
+    // kludge that can probably be done better to check specifically for toilet water to use in
+    // crafting
+    if( m.furn( p ).obj().examine == &iexamine::toilet ) {
+        return it.typeId() == itype_water && it.charges > 0;
+    }
+    // keg-kludge
+    return m.furn( p ).obj().examine == &iexamine::keg;
+}
+
 void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Character *pl,
                                bool assign_invlet )
 {
     items.clear();
     for( const tripoint &p : pts ) {
-        // a temporary hack while trees are terrain
-        if( m.ter( p )->has_flag( "TREE" ) ) {
-            item tree_pseudo( "butchery_tree_pseudo" );
-            tree_pseudo.item_tags.insert( "PSEUDO" );
-            add_item( tree_pseudo );
-        }
-        if( m.has_furn( p ) ) {
-            const furn_t &f = m.furn( p ).obj();
-            const itype *type = f.crafting_pseudo_item_type();
-            if( type != nullptr ) {
-                const itype *ammo = f.crafting_ammo_item_type();
-                item furn_item( type, calendar::turn, 0 );
-                if( furn_item.contents.has_pocket_type( item_pocket::pocket_type::MAGAZINE ) ) {
-                    // NOTE: This only works if the pseudo item has a MAGAZINE pocket, not a MAGAZINE_WELL!
-                    item furn_ammo( ammo, calendar::turn, count_charges_in_list( ammo, m.i_at( p ) ) );
-                    furn_item.put_in( furn_ammo, item_pocket::pocket_type::MAGAZINE );
-                }
-                furn_item.item_tags.insert( "PSEUDO" );
-                add_item( furn_item );
-            }
-        }
+        for_each_crafting_pseudo_item( m, p, [this]( item & it ) {
+            add_item( it );
+        } );
         if( m.accessible_items( p ) ) {
             for( item &i : m.i_at( p ) ) {
-                // if it's *the* player requesting this from from map inventory
-                // then don't allow items owned by another faction to be factored into recipe components etc.
-                if( pl && !i.is_owned_by( *pl, true ) ) {
-                    continue;
-                }
-                if( !i.made_of( phase_id::LIQUID ) ) {
+                if( !i.made_of( phase_id::LIQUID ) && is_crafting_map_item( m, p, i, pl ) ) {
                     add_item( i, false, assign_invlet );
                 }
             }
         }
-        // Kludges for now!
-        if( m.has_nearby_fire( p, 0 ) ) {
-            item fire( "fire", 0 );
-            fire.charges = 1;
-            add_item( fire );
-        }
-        // Handle any water from infinite map sources.
-        item water = m.water_from( p );
-        if( !water.is_null() ) {
-            add_item( water );
-        }
-        // kludge that can probably be done better to check specifically for toilet water to use in
-        // crafting
-        if( m.furn( p ).obj().examine == &iexamine::toilet ) {
-            // get water charges at location
-            map_stack toilet = m.i_at( p );
-            auto water = toilet.end();
-            for( auto candidate = toilet.begin(); candidate != toilet.end(); ++candidate ) {
-                if( candidate->typeId() == itype_water ) {
-                    water = candidate;
-                    break;
-                }
-            }
-            if( water != toilet.end() && water->charges > 0 ) {
-                add_item( *water );
+        for( item &i : m.i_at( p ) ) {
+            if( i.made_of( phase_id::LIQUID ) && is_crafting_map_item( m, p, i, pl ) ) {
+                add_item( i );
             }
         }
 
-        // keg-kludge
-        if( m.furn( p ).obj().examine == &iexamine::keg ) {
-            map_stack liq_contained = m.i_at( p );
-            for( auto &i : liq_contained ) {
-                if( i.made_of( phase_id::LIQUID ) ) {
-                    add_item( i );
-                }
-            }
-        }
-
-        // WARNING: The part below has a bug that's currently quite minor
-        // When a vehicle has multiple faucets in range, available water is
-        //  multiplied by the number of faucets.
-        // Same thing happens for all other tools and resources, but not cargo
         const optional_vpart_position vp = m.veh_at( p );
         if( !vp ) {
             continue;
         }
-        vehicle *const veh = &vp->vehicle();
-
-        //Adds faucet to kitchen stuff; may be horribly wrong to do such....
-        //ShouldBreak into own variable
-        const cata::optional<vpart_reference> kpart = vp.part_with_feature( "KITCHEN", true );
-        const cata::optional<vpart_reference> faupart = vp.part_with_feature( "FAUCET", true );
-        const cata::optional<vpart_reference> weldpart = vp.part_with_feature( "WELDRIG", true );
-        const cata::optional<vpart_reference> craftpart = vp.part_with_feature( "CRAFTRIG", true );
-        const cata::optional<vpart_reference> forgepart = vp.part_with_feature( "FORGE", true );
-        const cata::optional<vpart_reference> kilnpart = vp.part_with_feature( "KILN", true );
-        const cata::optional<vpart_reference> chempart = vp.part_with_feature( "CHEMLAB", true );
         const cata::optional<vpart_reference> cargo = vp.part_with_feature( "CARGO", true );
-
         if( cargo ) {
-            const auto items = veh->get_items( cargo->part_index() );
+            const auto items = vp->vehicle().get_items( cargo->part_index() );
             *this += std::list<item>( items.begin(), items.end() );
         }
-
-        if( faupart ) {
-            for( const auto &it : veh->fuels_left() ) {
-                item fuel( it.first, 0 );
-                if( fuel.made_of( phase_id::LIQUID ) ) {
-                    fuel.charges = it.second;
-                    add_item( fuel );
-                }
-            }
-        }
-        const auto item_with_battery = []( const std::string & id, const int qty ) {
-            item it( id );
-            item it_batt( it.magazine_default() );
-            it_batt.ammo_set( it_batt.ammo_default(), qty );
-            it.put_in( it_batt, item_pocket::pocket_type::MAGAZINE_WELL );
-            it.item_tags.insert( "PSEUDO" );
-            return it;
-        };
-        int veh_battery = veh->fuel_left( itype_id( "battery" ), true );
-        if( kpart ) {
-            item hotplate = item_with_battery( "hotplate", veh_battery );
-            add_item( hotplate );
-
-            item pot( "pot", 0 );
-            pot.item_tags.insert( "PSEUDO" );
-            add_item( pot );
-            item pan( "pan", 0 );
-            pan.item_tags.insert( "PSEUDO" );
-            add_item( pan );
-        }
-        if( weldpart ) {
-            item welder = item_with_battery( "welder", veh_battery );
-            add_item( welder );
-            item soldering_iron = item_with_battery( "soldering_iron", veh_battery );
-            add_item( soldering_iron );
-        }
-        if( craftpart ) {
-            item vac_sealer = item_with_battery( "vac_sealer", veh_battery );
-            add_item( vac_sealer );
-
-            item dehydrator = item_with_battery( "dehydrator", veh_battery );
-            add_item( dehydrator );
-
-            item food_processor = item_with_battery( "food_processor", veh_battery );
-            add_item( food_processor );
-
-            item press = item( "press" );
-            press.item_tags.insert( "PSEUDO" );
-            add_item( press );
-        }
-        if( forgepart ) {
-            item forge = item_with_battery( "forge", veh_battery );
-            add_item( forge );
-        }
-        if( kilnpart ) {
-            item kiln = item_with_battery( "kiln", veh_battery );
-            add_item( kiln );
-        }
-        if( chempart ) {
-            item chemistry_set = item_with_battery( "chemistry_set", veh_battery );
-            add_item( chemistry_set );
-
-            item electrolysis_kit = item_with_battery( "electrolysis_kit", veh_battery );
-            add_item( electrolysis_kit );
-        }
     }
     pts.clear();
 }
@@ -946,7 +949,7 @@ void for_each_item_in_both(
         int num_to_count = other_it->second;
         if( representative.count_by_charges() ) {
             item copy = representative;
-            copy.charges = std::min( copy.charges, num_to_count );
+            copy.set_charges( std::min( copy.charges, num_to_count ) );
             f( copy );
         } else {
             for( const auto &elem_stack_iter : elem ) {
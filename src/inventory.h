@@ -247,4 +247,13 @@ class inventory : public visitable<inventory>
         mutable itype_bin binned_items;
 };
 
+/**
+ * Calls @p func with each pseudo item the tile at @p p provides for crafting: furniture and
+ * vehicle tools, fire and water sources.
+ */
+void for_each_crafting_pseudo_item( map &m, const tripoint &p,
+                                    const std::function<void( item & )> &func );
+/** Whether the item lying at @p p can be crafted with by @p pl (if any). */
+bool is_crafting_map_item( const map &m, const tripoint &p, const item &it, const Character *pl );
+
 #endif // CATA_SRC_INVENTORY_H
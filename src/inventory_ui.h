@@ -238,7 +238,7 @@ class inventory_holster_preset : public inventory_selector_preset
         /** Does this entry satisfy the basic preset conditions? */
         bool is_shown( const item_location &contained ) const override {
             item item_copy( *contained );
-            item_copy.charges = 1;
+            item_copy.set_charges( 1 );
             return holster->contents.can_contain( item_copy ).success() && !holster->has_item( *contained ) &&
                    !contained->is_bucket_nonempty() && holster.parents_can_contain_recursive( &item_copy );
         }
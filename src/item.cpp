@@ -161,115 +161,118 @@ static const trait_id trait_SMALL2( "SMALL2" );
 static const trait_id trait_TOLERANCE( "TOLERANCE" );
 static const trait_id trait_WOOLALLERGY( "WOOLALLERGY" );
 
-static const std::string flag_ALWAYS_TWOHAND( "ALWAYS_TWOHAND" );
-static const std::string flag_AURA( "AURA" );
-static const std::string flag_BELTED( "BELTED" );
-static const std::string flag_BIPOD( "BIPOD" );
-static const std::string flag_BYPRODUCT( "BYPRODUCT" );
-static const std::string flag_CABLE_SPOOL( "CABLE_SPOOL" );
-static const std::string flag_CANNIBALISM( "CANNIBALISM" );
-static const std::string flag_CHARGEDIM( "CHARGEDIM" );
-static const std::string flag_COLD( "COLD" );
-static const std::string flag_COLLAPSIBLE_STOCK( "COLLAPSIBLE_STOCK" );
-static const std::string flag_CONDUCTIVE( "CONDUCTIVE" );
-static const std::string flag_CONSUMABLE( "CONSUMABLE" );
-static const std::string flag_CORPSE( "CORPSE" );
-static const std::string flag_DANGEROUS( "DANGEROUS" );
+static const flag_id flag_ALWAYS_TWOHAND( "ALWAYS_TWOHAND" );
+static const flag_id flag_AURA( "AURA" );
+static const flag_id flag_BELTED( "BELTED" );
+static const flag_id flag_BIPOD( "BIPOD" );
+static const flag_id flag_BYPRODUCT( "BYPRODUCT" );
+static const flag_id flag_CABLE_SPOOL( "CABLE_SPOOL" );
+static const flag_id flag_CANNIBALISM( "CANNIBALISM" );
+static const flag_id flag_CHARGEDIM( "CHARGEDIM" );
+static const flag_id flag_COLD( "COLD" );
+static const flag_id flag_COLLAPSIBLE_STOCK( "COLLAPSIBLE_STOCK" );
+static const flag_id flag_CONDUCTIVE( "CONDUCTIVE" );
+static const flag_id flag_CONSUMABLE( "CONSUMABLE" );
+static const flag_id flag_CORPSE( "CORPSE" );
+static const flag_id flag_DANGEROUS( "DANGEROUS" );
 static const std::string flag_DEEP_WATER( "DEEP_WATER" );
-static const std::string flag_DIAMOND( "DIAMOND" );
-static const std::string flag_DISABLE_SIGHTS( "DISABLE_SIGHTS" );
-static const std::string flag_ETHEREAL_ITEM( "ETHEREAL_ITEM" );
-static const std::string flag_FAKE_MILL( "FAKE_MILL" );
-static const std::string flag_FAKE_SMOKE( "FAKE_SMOKE" );
-static const std::string flag_FIELD_DRESS( "FIELD_DRESS" );
-static const std::string flag_FIELD_DRESS_FAILED( "FIELD_DRESS_FAILED" );
-static const std::string flag_FILTHY( "FILTHY" );
-static const std::string flag_FIRE_100( "FIRE_100" );
-static const std::string flag_FIRE_20( "FIRE_20" );
-static const std::string flag_FIRE_50( "FIRE_50" );
-static const std::string flag_FIRE_TWOHAND( "FIRE_TWOHAND" );
-static const std::string flag_FIT( "FIT" );
+static const flag_id flag_DIAMOND( "DIAMOND" );
+static const flag_id flag_DIRTY( "DIRTY" );
+static const flag_id flag_DISABLE_SIGHTS( "DISABLE_SIGHTS" );
+static const flag_id flag_ETHEREAL_ITEM( "ETHEREAL_ITEM" );
+static const flag_id flag_FAKE_MILL( "FAKE_MILL" );
+static const flag_id flag_FAKE_SMOKE( "FAKE_SMOKE" );
+static const flag_id flag_FIELD_DRESS( "FIELD_DRESS" );
+static const flag_id flag_FIELD_DRESS_FAILED( "FIELD_DRESS_FAILED" );
+static const flag_id flag_FILTHY( "FILTHY" );
+static const flag_id flag_FIRE_100( "FIRE_100" );
+static const flag_id flag_FIRE_20( "FIRE_20" );
+static const flag_id flag_FIRE_50( "FIRE_50" );
+static const flag_id flag_FIRE_TWOHAND( "FIRE_TWOHAND" );
+static const flag_id flag_FIT( "FIT" );
 static const std::string flag_FLAMMABLE( "FLAMMABLE" );
 static const std::string flag_FLAMMABLE_ASH( "FLAMMABLE_ASH" );
-static const std::string flag_FREEZERBURN( "FREEZERBURN" );
-static const std::string flag_FROZEN( "FROZEN" );
-static const std::string flag_GIBBED( "GIBBED" );
-static const std::string flag_HELMET_COMPAT( "HELMET_COMPAT" );
-static const std::string flag_HIDDEN_HALLU( "HIDDEN_HALLU" );
-static const std::string flag_HIDDEN_POISON( "HIDDEN_POISON" );
-static const std::string flag_HOT( "HOT" );
-static const std::string flag_IRREMOVABLE( "IRREMOVABLE" );
-static const std::string flag_BURNOUT( "BURNOUT" );
-static const std::string flag_IS_ARMOR( "IS_ARMOR" );
-static const std::string flag_IS_PET_ARMOR( "IS_PET_ARMOR" );
-static const std::string flag_IS_UPS( "IS_UPS" );
-static const std::string flag_LEAK_ALWAYS( "LEAK_ALWAYS" );
-static const std::string flag_LEAK_DAM( "LEAK_DAM" );
+static const flag_id flag_FREEZERBURN( "FREEZERBURN" );
+static const flag_id flag_FROZEN( "FROZEN" );
+static const flag_id flag_GIBBED( "GIBBED" );
+static const flag_id flag_HELMET_COMPAT( "HELMET_COMPAT" );
+static const flag_id flag_HIDDEN_HALLU( "HIDDEN_HALLU" );
+static const flag_id flag_HIDDEN_POISON( "HIDDEN_POISON" );
+static const flag_id flag_HOT( "HOT" );
+static const flag_id flag_IRREMOVABLE( "IRREMOVABLE" );
+static const flag_id flag_BURNOUT( "BURNOUT" );
+static const flag_id flag_IS_ARMOR( "IS_ARMOR" );
+static const flag_id flag_IS_PET_ARMOR( "IS_PET_ARMOR" );
+static const flag_id flag_IS_UPS( "IS_UPS" );
+static const flag_id flag_LEAK_ALWAYS( "LEAK_ALWAYS" );
+static const flag_id flag_LEAK_DAM( "LEAK_DAM" );
 static const std::string flag_LIQUID( "LIQUID" );
 static const std::string flag_LIQUIDCONT( "LIQUIDCONT" );
-static const std::string flag_LITCIG( "LITCIG" );
-static const std::string flag_MAG_BELT( "MAG_BELT" );
-static const std::string flag_MELTS( "MELTS" );
-static const std::string flag_MUSHY( "MUSHY" );
-static const std::string flag_NANOFAB_TEMPLATE( "NANOFAB_TEMPLATE" );
-static const std::string flag_NEEDS_UNFOLD( "NEEDS_UNFOLD" );
-static const std::string flag_NEVER_JAMS( "NEVER_JAMS" );
-static const std::string flag_NONCONDUCTIVE( "NONCONDUCTIVE" );
+static const flag_id flag_LITCIG( "LITCIG" );
+static const flag_id flag_MAGIC_FOCUS( "MAGIC_FOCUS" );
+static const flag_id flag_MAG_BELT( "MAG_BELT" );
+static const flag_id flag_MELTS( "MELTS" );
+static const flag_id flag_MUSHY( "MUSHY" );
+static const flag_id flag_NANOFAB_TEMPLATE( "NANOFAB_TEMPLATE" );
+static const flag_id flag_NEEDS_UNFOLD( "NEEDS_UNFOLD" );
+static const flag_id flag_NEVER_JAMS( "NEVER_JAMS" );
+static const flag_id flag_NONCONDUCTIVE( "NONCONDUCTIVE" );
 static const std::string flag_NO_DISPLAY( "NO_DISPLAY" );
-static const std::string flag_NO_DROP( "NO_DROP" );
-static const std::string flag_NO_PACKED( "NO_PACKED" );
-static const std::string flag_NO_PARASITES( "NO_PARASITES" );
-static const std::string flag_NO_RELOAD( "NO_RELOAD" );
-static const std::string flag_NO_REPAIR( "NO_REPAIR" );
-static const std::string flag_NO_SALVAGE( "NO_SALVAGE" );
-static const std::string flag_NO_STERILE( "NO_STERILE" );
-static const std::string flag_NO_UNLOAD( "NO_UNLOAD" );
-static const std::string flag_OUTER( "OUTER" );
-static const std::string flag_OVERSIZE( "OVERSIZE" );
-static const std::string flag_PERSONAL( "PERSONAL" );
-static const std::string flag_PROCESSING( "PROCESSING" );
-static const std::string flag_PROCESSING_RESULT( "PROCESSING_RESULT" );
-static const std::string flag_PULPED( "PULPED" );
-static const std::string flag_PUMP_ACTION( "PUMP_ACTION" );
-static const std::string flag_PUMP_RAIL_COMPATIBLE( "PUMP_RAIL_COMPATIBLE" );
-static const std::string flag_QUARTERED( "QUARTERED" );
-static const std::string flag_RADIOACTIVE( "RADIOACTIVE" );
-static const std::string flag_RADIOSIGNAL_1( "RADIOSIGNAL_1" );
-static const std::string flag_RADIOSIGNAL_2( "RADIOSIGNAL_2" );
-static const std::string flag_RADIOSIGNAL_3( "RADIOSIGNAL_3" );
-static const std::string flag_RADIO_ACTIVATION( "RADIO_ACTIVATION" );
-static const std::string flag_RADIO_INVOKE_PROC( "RADIO_INVOKE_PROC" );
-static const std::string flag_RADIO_MOD( "RADIO_MOD" );
-static const std::string flag_RAIN_PROTECT( "RAIN_PROTECT" );
-static const std::string flag_REACH3( "REACH3" );
-static const std::string flag_REACH_ATTACK( "REACH_ATTACK" );
-static const std::string flag_RECHARGE( "RECHARGE" );
-static const std::string flag_REDUCED_BASHING( "REDUCED_BASHING" );
-static const std::string flag_REDUCED_WEIGHT( "REDUCED_WEIGHT" );
-static const std::string flag_RELOAD_AND_SHOOT( "RELOAD_AND_SHOOT" );
-static const std::string flag_RELOAD_EJECT( "RELOAD_EJECT" );
-static const std::string flag_RELOAD_ONE( "RELOAD_ONE" );
-static const std::string flag_REVIVE_SPECIAL( "REVIVE_SPECIAL" );
+static const flag_id flag_NO_DROP( "NO_DROP" );
+static const flag_id flag_NO_PACKED( "NO_PACKED" );
+static const flag_id flag_NO_PARASITES( "NO_PARASITES" );
+static const flag_id flag_NO_RELOAD( "NO_RELOAD" );
+static const flag_id flag_NO_REPAIR( "NO_REPAIR" );
+static const flag_id flag_NO_SALVAGE( "NO_SALVAGE" );
+static const flag_id flag_NO_STERILE( "NO_STERILE" );
+static const flag_id flag_NO_UNLOAD( "NO_UNLOAD" );
+static const flag_id flag_OUTER( "OUTER" );
+static const flag_id flag_OVERSIZE( "OVERSIZE" );
+static const flag_id flag_PERSONAL( "PERSONAL" );
+static const flag_id flag_PROCESSING( "PROCESSING" );
+static const flag_id flag_PROCESSING_RESULT( "PROCESSING_RESULT" );
+static const flag_id flag_PULPED( "PULPED" );
+static const flag_id flag_PUMP_ACTION( "PUMP_ACTION" );
+static const flag_id flag_PUMP_RAIL_COMPATIBLE( "PUMP_RAIL_COMPATIBLE" );
+static const flag_id flag_QUARTERED( "QUARTERED" );
+static const flag_id flag_RADIOACTIVE( "RADIOACTIVE" );
+static const flag_id flag_RADIOSIGNAL_1( "RADIOSIGNAL_1" );
+static const flag_id flag_RADIOSIGNAL_2( "RADIOSIGNAL_2" );
+static const flag_id flag_RADIOSIGNAL_3( "RADIOSIGNAL_3" );
+static const flag_id flag_RADIO_ACTIVATION( "RADIO_ACTIVATION" );
+static const flag_id flag_RADIO_INVOKE_PROC( "RADIO_INVOKE_PROC" );
+static const flag_id flag_RADIO_MOD( "RADIO_MOD" );
+static const flag_id flag_RAIN_PROTECT( "RAIN_PROTECT" );
+static const flag_id flag_REACH3( "REACH3" );
+static const flag_id flag_REACH_ATTACK( "REACH_ATTACK" );
+static const flag_id flag_RECHARGE( "RECHARGE" );
+static const flag_id flag_REDUCED_BASHING( "REDUCED_BASHING" );
+static const flag_id flag_REDUCED_WEIGHT( "REDUCED_WEIGHT" );
+static const flag_id flag_RELOAD_AND_SHOOT( "RELOAD_AND_SHOOT" );
+static const flag_id flag_RELOAD_EJECT( "RELOAD_EJECT" );
+static const flag_id flag_RELOAD_ONE( "RELOAD_ONE" );
+static const flag_id flag_REVIVE_SPECIAL( "REVIVE_SPECIAL" );
 static const std::string flag_SILENT( "SILENT" );
-static const std::string flag_SKINNED( "SKINNED" );
-static const std::string flag_SKINTIGHT( "SKINTIGHT" );
-static const std::string flag_SLOW_WIELD( "SLOW_WIELD" );
-static const std::string flag_SPEEDLOADER( "SPEEDLOADER" );
+static const flag_id flag_SKINNED( "SKINNED" );
+static const flag_id flag_SKINTIGHT( "SKINTIGHT" );
+static const flag_id flag_SLOW_WIELD( "SLOW_WIELD" );
+static const flag_id flag_SPEEDLOADER( "SPEEDLOADER" );
 static const std::string flag_SPLINT( "SPLINT" );
 static const std::string flag_TOURNIQUET( "TOURNIQUET" );
-static const std::string flag_STR_DRAW( "STR_DRAW" );
-static const std::string flag_TOBACCO( "TOBACCO" );
-static const std::string flag_UNARMED_WEAPON( "UNARMED_WEAPON" );
-static const std::string flag_UNDERSIZE( "UNDERSIZE" );
-static const std::string flag_USES_BIONIC_POWER( "USES_BIONIC_POWER" );
-static const std::string flag_USE_UPS( "USE_UPS" );
-static const std::string flag_VARSIZE( "VARSIZE" );
-static const std::string flag_VEHICLE( "VEHICLE" );
-static const std::string flag_WAIST( "WAIST" );
-static const std::string flag_WATERPROOF_GUN( "WATERPROOF_GUN" );
-static const std::string flag_WATER_EXTINGUISH( "WATER_EXTINGUISH" );
-static const std::string flag_WET( "WET" );
-static const std::string flag_WIND_EXTINGUISH( "WIND_EXTINGUISH" );
+static const flag_id flag_STR_DRAW( "STR_DRAW" );
+static const flag_id flag_TOBACCO( "TOBACCO" );
+static const flag_id flag_UNARMED_WEAPON( "UNARMED_WEAPON" );
+static const flag_id flag_UNDERSIZE( "UNDERSIZE" );
+static const flag_id flag_USES_BIONIC_POWER( "USES_BIONIC_POWER" );
+static const flag_id flag_USE_UPS( "USE_UPS" );
+static const flag_id flag_VARSIZE( "VARSIZE" );
+static const flag_id flag_VEHICLE( "VEHICLE" );
+static const flag_id flag_WAIST( "WAIST" );
+static const flag_id flag_WATERPROOF_GUN( "WATERPROOF_GUN" );
+static const flag_id flag_WATER_EXTINGUISH( "WATER_EXTINGUISH" );
+static const flag_id flag_WET( "WET" );
+static const flag_id flag_WIND_EXTINGUISH( "WIND_EXTINGUISH" );
+static const flag_id flag_wooled( "wooled" );
 
 static const matec_id RAPID( "RAPID" );
 
@@ -385,7 +388,7 @@ item::item( const itype *type, time_point turn, int qty ) : type( type ), bday(
     if( type->gun ) {
         for( const itype_id &mod : type->gun->built_in_mods ) {
             item it( mod, turn, qty );
-            it.item_tags.insert( "IRREMOVABLE" );
+            it.set_flag( flag_IRREMOVABLE );
             put_in( it, item_pocket::pocket_type::MOD );
         }
         for( const itype_id &mod : type->gun->default_mods ) {
@@ -478,7 +481,7 @@ item::item( const recipe *rec, int qty, std::list<item> items, std::vector<item_
     }
 
     for( item &component : components ) {
-        for( const std::string &f : component.item_tags ) {
+        for( const std::string &f : component.get_flags() ) {
             if( json_flag::get( f ).craft_inherit() ) {
                 set_flag( f );
             }
@@ -511,7 +514,7 @@ item item::make_corpse( const mtype_id &mt, time_point turn, const std::string &
 
     if( result.corpse->has_flag( MF_REVIVES ) ) {
         if( one_in( 20 ) ) {
-            result.item_tags.insert( "REVIVE_SPECIAL" );
+            result.set_flag( flag_REVIVE_SPECIAL );
         }
         result.set_var( "upgrade_time", std::to_string( upgrade_time ) );
     }
@@ -529,6 +532,7 @@ item item::make_corpse( const mtype_id &mt, time_point turn, const std::string &
 
 item &item::convert( const itype_id &new_type )
 {
+    contents.invalidate_outer_totals();
     type = find_type( new_type );
     item_contents new_contents = item_contents( type->pockets );
     new_contents.combine( contents );
@@ -627,7 +631,7 @@ item &item::ammo_set( const itype_id &ammo, int qty )
         if( magazine_integral() ) {
             if( is_tool() ) {
                 curammo = nullptr;
-                charges = std::min( qty, ammo_capacity( ammo_type ) );
+                set_charges( std::min( qty, ammo_capacity( ammo_type ) ) );
             } else if( is_gun() ) {
                 const item temp_ammo( ammo_default(), calendar::turn, std::min( qty, ammo_capacity( ammo_type ) ) );
                 put_in( temp_ammo, item_pocket::pocket_type::MAGAZINE );
@@ -649,8 +653,8 @@ item &item::ammo_set( const itype_id &ammo, int qty )
         ammo_unset();
         item set_ammo( ammo, calendar::turn, std::min( qty, ammo_capacity( ammo_type ) ) );
         if( has_flag( flag_NO_UNLOAD ) ) {
-            set_ammo.item_tags.insert( "NO_DROP" );
-            set_ammo.item_tags.insert( "IRREMOVABLE" );
+            set_ammo.set_flag( flag_NO_DROP );
+            set_ammo.set_flag( flag_IRREMOVABLE );
         }
         put_in( set_ammo, item_pocket::pocket_type::MAGAZINE );
 
@@ -700,12 +704,12 @@ item &item::ammo_unset()
         // do nothing
     } else if( is_magazine() ) {
         if( is_money() ) { // charges are set wrong on cash cards.
-            charges = 0;
+            set_charges( 0 );
         }
         contents.clear_items();
     } else if( magazine_integral() ) {
         curammo = nullptr;
-        charges = 0;
+        set_charges( 0 );
         if( is_gun() ) {
             contents.clear_items();
         }
@@ -746,8 +750,8 @@ item item::split( int qty )
         return item();
     }
     item res = *this;
-    res.charges = qty;
-    charges -= qty;
+    res.set_charges( qty );
+    set_charges( charges - qty );
     return res;
 }
 
@@ -993,7 +997,7 @@ bool item::combine( const item &rhs )
     } else if( !stacks_with( rhs, true ) ) {
         return false;
     }
-    charges += rhs.charges;
+    set_charges( charges + rhs.charges );
     return true;
 }
 
@@ -1035,6 +1039,9 @@ bool item::stacks_with( const item &rhs, bool check_components ) const
     if( item_vars != rhs.item_vars ) {
         return false;
     }
+    if( weight_override != rhs.weight_override || volume_override != rhs.volume_override ) {
+        return false;
+    }
     if( goes_bad() && rhs.goes_bad() ) {
         // Stack items that fall into the same "bucket" of freshness.
         // Distant buckets are larger than near ones.
@@ -1080,7 +1087,7 @@ bool item::merge_charges( const item &rhs )
     }
     // Prevent overflow when either item has "near infinite" charges.
     if( charges >= INFINITE_CHARGES / 2 || rhs.charges >= INFINITE_CHARGES / 2 ) {
-        charges = INFINITE_CHARGES;
+        set_charges( INFINITE_CHARGES );
         return true;
     }
     // We'll just hope that the item counter represents the same thing for both items
@@ -1088,7 +1095,7 @@ bool item::merge_charges( const item &rhs )
         item_counter = ( static_cast<double>( item_counter ) * charges + static_cast<double>
                          ( rhs.item_counter ) * rhs.charges ) / ( charges + rhs.charges );
     }
-    charges += rhs.charges;
+    set_charges( charges + rhs.charges );
     return true;
 }
 
@@ -1192,6 +1199,18 @@ void item::clear_vars()
     item_vars.clear();
 }
 
+void item::set_weight_override( const cata::optional<units::mass> &weight )
+{
+    weight_override = weight;
+    contents.invalidate_outer_totals();
+}
+
+void item::set_volume_override( const cata::optional<units::volume> &volume )
+{
+    volume_override = volume;
+    contents.invalidate_outer_totals();
+}
+
 // TODO: Get rid of, handle multiple types gracefully
 static int get_ranged_pierce( const common_ranged_data &ranged )
 {
@@ -1631,7 +1650,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         } else if( idescription != item_vars.end() ) {
             info.push_back( iteminfo( "DESCRIPTION", idescription->second ) );
         } else {
-            if( has_flag( "MAGIC_FOCUS" ) ) {
+            if( has_flag( flag_MAGIC_FOCUS ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
                                           _( "This item is a <info>magical focus</info>.  "
                                              "You can cast spells with it in your hand." ) ) );
@@ -3748,7 +3767,7 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
     avatar &player_character = get_avatar();
     if( parts->test( iteminfo_parts::DESCRIPTION_ALLERGEN ) ) {
         if( is_armor() && player_character.has_trait( trait_WOOLALLERGY ) &&
-            ( made_of( material_id( "wool" ) ) || item_tags.count( "wooled" ) ) ) {
+            ( made_of( material_id( "wool" ) ) || has_own_flag( flag_wooled ) ) ) {
             info.push_back( iteminfo( "DESCRIPTION",
                                       _( "* This clothing will give you an <bad>allergic "
                                          "reaction</bad>." ) ) );
@@ -4155,9 +4174,9 @@ nc_color item::color_in_inventory() const
     } else if( has_flag( flag_LITCIG ) ) {
         ret = c_red;
     } else if( is_armor() && player_character.has_trait( trait_WOOLALLERGY ) &&
-               ( made_of( material_id( "wool" ) ) || item_tags.count( "wooled" ) ) ) {
+               ( made_of( material_id( "wool" ) ) || has_own_flag( flag_wooled ) ) ) {
         ret = c_red;
-    } else if( is_filthy() || item_tags.count( "DIRTY" ) ) {
+    } else if( is_filthy() || has_own_flag( flag_DIRTY ) ) {
         ret = c_brown;
     } else if( is_bionic() ) {
         if( !player_character.has_bionic( type->bionic->id ) ) {
@@ -4354,7 +4373,8 @@ int item::on_wield_cost( const player &p ) const
             d /= std::max( p.get_skill_level( melee_skill() ), 1 );
         }
 
-        int penalty = get_var( "volume", volume() / units::legacy_volume_factor ) * d;
+        int penalty = ( volume_override ? *volume_override : volume() ) /
+                      units::legacy_volume_factor * d;
         mv += penalty;
     }
 
@@ -4470,6 +4490,7 @@ void item::on_pickup( Character &p )
 
 void item::on_contents_changed()
 {
+    contents.invalidate_outer_totals();
     contents.update_open_pockets();
     cached_relative_encumbrance.reset();
     encumbrance_update_ = true;
@@ -4615,7 +4636,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
     if( has_flag( flag_ETHEREAL_ITEM ) ) {
         tagtext += string_format( _( " (%s turns)" ), get_var( "ethereal" ) );
     } else if( goes_bad() || is_food() ) {
-        if( item_tags.count( "DIRTY" ) ) {
+        if( has_own_flag( flag_DIRTY ) ) {
             tagtext += _( " (dirty)" );
         } else if( rotten() ) {
             tagtext += _( " (rotten)" );
@@ -4952,11 +4973,10 @@ units::mass item::weight( bool, bool integral ) const
     }
 
     units::mass ret;
-    std::string local_str_mass = integral ? get_var( "integral_weight" ) : get_var( "weight" );
-    if( local_str_mass.empty() ) {
-        ret = integral ? type->integral_weight : type->weight;
+    if( integral ) {
+        ret = type->integral_weight;
     } else {
-        ret = units::from_milligram( std::stoll( local_str_mass ) );
+        ret = weight_override ? *weight_override : type->weight;
     }
 
     if( has_flag( flag_REDUCED_WEIGHT ) ) {
@@ -5001,7 +5021,7 @@ units::mass item::weight( bool, bool integral ) const
     // if this is an ammo belt add the weight of any implicitly contained linkages
     if( type->magazine && type->magazine->linkage ) {
         item links( *type->magazine->linkage );
-        links.charges = ammo_remaining();
+        links.set_charges( ammo_remaining() );
         ret += links.weight();
     }
 
@@ -5110,10 +5130,9 @@ units::volume item::volume( bool integral ) const
         return ret;
     }
 
-    const int local_volume = get_var( "volume", -1 );
     units::volume ret;
-    if( local_volume >= 0 ) {
-        ret = local_volume * units::legacy_volume_factor;
+    if( volume_override ) {
+        ret = *volume_override;
     } else if( integral ) {
         ret = type->integral_volume;
     } else {
@@ -5144,8 +5163,8 @@ units::volume item::volume( bool integral ) const
         // TODO: implement stock_length property for guns
         if( has_flag( flag_COLLAPSIBLE_STOCK ) ) {
             // consider only the base size of the gun (without mods)
-            int tmpvol = get_var( "volume",
-                                  ( type->volume - type->gun->barrel_volume ) / units::legacy_volume_factor );
+            const int tmpvol = ( volume_override ? *volume_override :
+                                 type->volume - type->gun->barrel_volume ) / units::legacy_volume_factor;
             if( tmpvol <= 3 ) {
                 // intentional NOP
             } else if( tmpvol <= 5 ) {
@@ -5295,6 +5314,8 @@ int item::current_reach_range( const Character &guy ) const
 void item::unset_flags()
 {
     item_tags.clear();
+    item_tag_bits.clear();
+    contents.invalidate_outer_totals();
 }
 
 bool item::has_fault( const fault_id &fault ) const
@@ -5302,11 +5323,9 @@ bool item::has_fault( const fault_id &fault ) const
     return faults.count( fault );
 }
 
-bool item::has_flag( const std::string &f ) const
+bool item::has_flag( const flag_id &f ) const
 {
-    bool ret = false;
-
-    if( json_flag::get( f ).inherit() ) {
+    if( f->inherit() ) {
         for( const item *e : is_gun() ? gunmods() : toolmods() ) {
             // gunmods fired separately do not contribute to base gun flags
             if( !e->is_gun() && e->has_flag( f ) ) {
@@ -5315,15 +5334,15 @@ bool item::has_flag( const std::string &f ) const
         }
     }
 
-    // other item type flags
-    ret = type->item_tags.count( f );
-    if( ret ) {
-        return ret;
-    }
+    // other item type flags, then item specific flags
+    return type->has_flag( f ) || item_tag_bits.test( f );
+}
 
-    // now check for item specific flags
-    ret = item_tags.count( f );
-    return ret;
+bool item::has_flag( const std::string &f ) const
+{
+    // Flags that were never interned can't be set on any item or type
+    const flag_id id = json_flag::lookup( f );
+    return id != flag_id() && has_flag( id );
 }
 
 bool item::has_any_flag( const std::vector<std::string> &flags ) const
@@ -5337,16 +5356,47 @@ bool item::has_any_flag( const std::vector<std::string> &flags ) const
     return false;
 }
 
+bool item::has_own_flag( const flag_id &f ) const
+{
+    return item_tag_bits.test( f );
+}
+
+bool item::has_own_flag( const std::string &f ) const
+{
+    const flag_id id = json_flag::lookup( f );
+    return id != flag_id() && has_own_flag( id );
+}
+
+const cata::flat_set<std::string> &item::get_flags() const
+{
+    return item_tags;
+}
+
+item &item::set_flag( const flag_id &flag )
+{
+    item_tags.insert( flag.id().str() );
+    item_tag_bits.set( flag );
+    contents.invalidate_outer_totals();
+    return *this;
+}
+
 item &item::set_flag( const std::string &flag )
 {
-    item_tags.insert( flag );
+    return set_flag( flag_id( flag ) );
+}
+
+item &item::unset_flag( const flag_id &flag )
+{
+    item_tags.erase( flag.id().str() );
+    item_tag_bits.reset( flag );
+    contents.invalidate_outer_totals();
     return *this;
 }
 
 item &item::unset_flag( const std::string &flag )
 {
-    item_tags.erase( flag );
-    return *this;
+    const flag_id id = json_flag::lookup( flag );
+    return id != flag_id() ? unset_flag( id ) : *this;
 }
 
 item &item::set_flag_recursive( const std::string &flag )
@@ -5655,7 +5705,7 @@ void item::calc_rot( int temp, const float spoil_modifier,
         return;
     }
 
-    if( item_tags.count( "FROZEN" ) ) {
+    if( has_own_flag( flag_FROZEN ) ) {
         return;
     }
 
@@ -5664,11 +5714,11 @@ void item::calc_rot( int temp, const float spoil_modifier,
     if( is_corpse() && has_flag( flag_FIELD_DRESS ) ) {
         factor *= 0.75;
     }
-    if( item_tags.count( "MUSHY" ) ) {
+    if( has_own_flag( flag_MUSHY ) ) {
         factor *= 3.0;
     }
 
-    if( item_tags.count( "COLD" ) ) {
+    if( has_own_flag( flag_COLD ) ) {
         temp = std::min( temperatures::fridge, temp );
     }
 
@@ -5686,7 +5736,7 @@ void item::calc_rot( int temp, const float spoil_modifier,
 
 void item::calc_rot_while_processing( time_duration processing_duration )
 {
-    if( !item_tags.count( "PROCESSING" ) ) {
+    if( !has_own_flag( flag_PROCESSING ) ) {
         debugmsg( "calc_rot_while_processing called on non smoking item: %s", tname() );
         return;
     }
@@ -6221,7 +6271,7 @@ bool item::mod_damage( int qty, damage_type dt )
     bool destroy = false;
 
     if( count_by_charges() ) {
-        charges -= std::min( type->stack_size * qty / itype::damage_scale, charges );
+        set_charges( charges - std::min( type->stack_size * qty / itype::damage_scale, charges ) );
         destroy |= charges == 0;
     }
 
@@ -6691,6 +6741,7 @@ void item::set_mtype( const mtype *const m )
         return;
     }
     corpse = m;
+    contents.invalidate_outer_totals();
 }
 
 bool item::is_ammo_container() const
@@ -7042,7 +7093,7 @@ bool item::can_contain_partial( const item &it ) const
 {
     item i_copy = it;
     if( i_copy.count_by_charges() ) {
-        i_copy.charges = 1;
+        i_copy.set_charges( 1 );
     }
     return can_contain( i_copy );
 }
@@ -7499,10 +7550,10 @@ int item::ammo_consume( int qty, const tripoint &pos )
             qty = std::min( qty, charges );
             Character &player_character = get_player_character();
             if( has_flag( flag_USES_BIONIC_POWER ) ) {
-                charges = units::to_kilojoule( player_character.get_power_level() );
+                set_charges( units::to_kilojoule( player_character.get_power_level() ) );
                 player_character.mod_power_level( units::from_kilojoule( -qty ) );
             }
-            charges -= qty;
+            set_charges( charges - qty );
             if( charges == 0 ) {
                 curammo = nullptr;
             }
@@ -7547,7 +7598,7 @@ itype_id item::ammo_current() const
     const itype *ammo = ammo_data();
     if( ammo ) {
         return ammo->get_id();
-    } else if( has_flag( "USE_UPS" ) ) {
+    } else if( has_flag( flag_USE_UPS ) ) {
         return itype_battery;
     }
 
@@ -7583,7 +7634,7 @@ itype_id item::ammo_default( bool conversion ) const
         if( !res.is_empty() ) {
             return res;
         }
-    } else if( has_flag( "USE_UPS" ) ) {
+    } else if( has_flag( flag_USE_UPS ) ) {
         return itype_battery;
     }
 
@@ -8074,23 +8125,24 @@ bool item::reload( Character &u, item_location ammo, int qty )
             curammo = ammo->contents.first_ammo().type;
             qty = std::min( qty, ammo->ammo_remaining() );
             item ammo_copy( ammo->contents.first_ammo() );
-            ammo_copy.charges = qty;
+            ammo_copy.set_charges( qty );
             put_in( ammo_copy, item_pocket::pocket_type::MAGAZINE );
             ammo->ammo_consume( qty, tripoint_zero );
         } else if( ammo->ammo_type() == ammo_plutonium ) {
             curammo = ammo->type;
-            ammo->charges -= qty;
+            ammo->set_charges( ammo->charges - qty );
 
             // any excess is wasted rather than overfilling the item
             item plut( *ammo );
-            plut.charges = std::min( qty * PLUTONIUM_CHARGES, ammo_capacity( ammo_plutonium ) );
+            plut.set_charges( std::min( qty * PLUTONIUM_CHARGES,
+                                        ammo_capacity( ammo_plutonium ) ) );
             put_in( plut, item_pocket::pocket_type::MAGAZINE );
         } else {
             curammo = ammo->type;
             qty = std::min( qty, ammo->charges );
             item item_copy( *ammo );
-            ammo->charges -= qty;
-            item_copy.charges = qty;
+            ammo->set_charges( ammo->charges - qty );
+            item_copy.set_charges( qty );
             put_in( item_copy, item_pocket::pocket_type::MAGAZINE );
         }
     } else if( is_watertight_container() ) {
@@ -8193,10 +8245,10 @@ bool item::burn( fire_data &frd )
 
     if( count_by_charges() ) {
         if( type->volume == 0_ml ) {
-            charges = 0;
+            set_charges( 0 );
         } else {
-            charges -= roll_remainder( burn_added * units::legacy_volume_factor * type->stack_size /
-                                       ( 3.0 * type->volume ) );
+            set_charges( charges - roll_remainder( burn_added * units::legacy_volume_factor *
+                                                   type->stack_size / ( 3.0 * type->volume ) ) );
         }
 
         return charges <= 0;
@@ -8207,6 +8259,7 @@ bool item::burn( fire_data &frd )
         if( active && mt != nullptr && burnt + burn_added > mt->hp &&
             !mt->burn_into.is_null() && mt->burn_into.is_valid() ) {
             corpse = &get_mtype()->burn_into.obj();
+            contents.invalidate_outer_totals();
             // Delay rezing
             set_age( 0_turns );
             burnt = 0;
@@ -8465,31 +8518,31 @@ void item::set_item_specific_energy( const float new_specific_energy )
     // Warm = over temperatures::warm
     // Cold = below temperatures::cold
     // Frozen = Over 50% frozen
-    if( item_tags.count( "FROZEN" ) ) {
-        item_tags.erase( "FROZEN" );
+    if( has_own_flag( flag_FROZEN ) ) {
+        unset_flag( flag_FROZEN );
         if( freeze_percentage < 0.5 ) {
             // Item melts and becomes mushy
             current_phase = type->phase;
             apply_freezerburn();
         }
-    } else if( item_tags.count( "COLD" ) ) {
-        item_tags.erase( "COLD" );
-    } else if( item_tags.count( "HOT" ) ) {
-        item_tags.erase( "HOT" );
+    } else if( has_own_flag( flag_COLD ) ) {
+        unset_flag( flag_COLD );
+    } else if( has_own_flag( flag_HOT ) ) {
+        unset_flag( flag_HOT );
     }
     if( new_item_temperature > temp_to_kelvin( temperatures::hot ) ) {
-        item_tags.insert( "HOT" );
+        set_flag( flag_HOT );
     } else if( freeze_percentage > 0.5 ) {
-        item_tags.insert( "FROZEN" );
+        set_flag( flag_FROZEN );
         current_phase = phase_id::SOLID;
         // If below freezing temp AND the food may have parasites AND food does not have "NO_PARASITES" tag then add the "NO_PARASITES" tag.
         if( is_food() && new_item_temperature < freezing_temperature && get_comestible()->parasites > 0 ) {
-            if( !( item_tags.count( "NO_PARASITES" ) ) ) {
-                item_tags.insert( "NO_PARASITES" );
+            if( !has_own_flag( flag_NO_PARASITES ) ) {
+                set_flag( flag_NO_PARASITES );
             }
         }
     } else if( new_item_temperature < temp_to_kelvin( temperatures::cold ) ) {
-        item_tags.insert( "COLD" );
+        set_flag( flag_COLD );
     }
     temperature = std::lround( 100000 * new_item_temperature );
     specific_energy = std::lround( 100000 * new_specific_energy );
@@ -8542,31 +8595,31 @@ void item::set_item_temperature( float new_temperature )
         freeze_percentage = ( completely_liquid_specific_energy - new_specific_energy ) /
                             ( completely_liquid_specific_energy - completely_frozen_specific_energy );
     }
-    if( item_tags.count( "FROZEN" ) ) {
-        item_tags.erase( "FROZEN" );
+    if( has_own_flag( flag_FROZEN ) ) {
+        unset_flag( flag_FROZEN );
         if( freeze_percentage < 0.5 ) {
             // Item melts and becomes mushy
             current_phase = type->phase;
             apply_freezerburn();
         }
-    } else if( item_tags.count( "COLD" ) ) {
-        item_tags.erase( "COLD" );
-    } else if( item_tags.count( "HOT" ) ) {
-        item_tags.erase( "HOT" );
+    } else if( has_own_flag( flag_COLD ) ) {
+        unset_flag( flag_COLD );
+    } else if( has_own_flag( flag_HOT ) ) {
+        unset_flag( flag_HOT );
     }
     if( new_temperature > temp_to_kelvin( temperatures::hot ) ) {
-        item_tags.insert( "HOT" );
+        set_flag( flag_HOT );
     } else if( freeze_percentage > 0.5 ) {
-        item_tags.insert( "FROZEN" );
+        set_flag( flag_FROZEN );
         current_phase = phase_id::SOLID;
         // If below freezing temp AND the food may have parasites AND food does not have "NO_PARASITES" tag then add the "NO_PARASITES" tag.
         if( is_food() && new_temperature < freezing_temperature && get_comestible()->parasites > 0 ) {
-            if( !( item_tags.count( "NO_PARASITES" ) ) ) {
-                item_tags.insert( "NO_PARASITES" );
+            if( !has_own_flag( flag_NO_PARASITES ) ) {
+                set_flag( flag_NO_PARASITES );
             }
         }
     } else if( new_temperature < temp_to_kelvin( temperatures::cold ) ) {
-        item_tags.insert( "COLD" );
+        set_flag( flag_COLD );
     }
     reset_temp_check();
 }
@@ -8579,7 +8632,7 @@ int item::fill_with( const item &contained, const int amount )
 
     item contained_item( contained );
     const bool count_by_charges = contained.count_by_charges();
-    contained_item.charges = count_by_charges ? 1 : -1;
+    contained_item.set_charges( count_by_charges ? 1 : -1 );
     item_location loc;
     item_pocket *pocket = nullptr;
 
@@ -8588,7 +8641,7 @@ int item::fill_with( const item &contained, const int amount )
         if( count_by_charges || pocket == nullptr ||
             !pocket->can_contain( contained_item ).success() ) {
             if( count_by_charges ) {
-                contained_item.charges = 1;
+                contained_item.set_charges( 1 );
             }
             pocket = best_pocket( contained_item, loc ).second;
         }
@@ -8596,9 +8649,11 @@ int item::fill_with( const item &contained, const int amount )
             break;
         }
         if( count_by_charges ) {
-            contained_item.charges = std::min( { amount - num_contained,
-                                                 contained_item.charges_per_volume( pocket->remaining_volume() ),
-                                                 contained_item.charges_per_weight( pocket->remaining_weight() ) } );
+            const int fitting = std::min( { amount - num_contained,
+                                            contained_item.charges_per_volume( pocket->remaining_volume() ),
+                                            contained_item.charges_per_weight( pocket->remaining_weight() )
+                                          } );
+            contained_item.set_charges( fitting );
         }
         if( !pocket->insert_item( contained_item ).success() ) {
             if( count_by_charges ) {
@@ -8631,7 +8686,7 @@ void item::set_countdown( int num_turns )
         debugmsg( "Tried to set countdown on an item with ammo." );
         return;
     }
-    charges = num_turns;
+    set_charges( num_turns );
 }
 
 bool item::use_charges( const itype_id &what, int &qty, std::list<item> &used,
@@ -8828,7 +8883,7 @@ bool item::detonate( const tripoint &p, std::vector<item> &drops )
         charges_remaining -= rounds_exploded;
         if( charges_remaining > 0 ) {
             item temp_item = *this;
-            temp_item.charges = charges_remaining;
+            temp_item.set_charges( charges_remaining );
             drops.push_back( temp_item );
         }
 
@@ -8970,8 +9025,8 @@ void item::apply_freezerburn()
     if( !has_flag( flag_FREEZERBURN ) ) {
         return;
     }
-    if( !item_tags.count( "MUSHY" ) ) {
-        item_tags.insert( "MUSHY" );
+    if( !has_own_flag( flag_MUSHY ) ) {
+        set_flag( flag_MUSHY );
     }
 }
 
@@ -9030,8 +9085,8 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos,
     if( now - time > 1_hours ) {
         // This code is for items that were left out of reality bubble for long time
 
-        const weather_generator &wgen = get_weather().get_cur_weather_gen();
-        const unsigned int seed = g->get_seed();
+        weather_manager &weather = get_weather();
+        const tripoint abs_pos = get_map().getabs( pos );
         int local_mod = g->new_game ? 0 : get_map().get_temperature( pos );
 
         int enviroment_mod;
@@ -9047,17 +9102,24 @@ bool item::process_temperature_rot( float insulation, const tripoint &pos,
             local_mod += 5; // body heat increases inventory temperature
         }
 
-        // Process the past of this item in 1h chunks until there is less than 1h left.
-        time_duration time_delta = 1_hours;
+        // Use weather if above ground, use map temp if below
+        const bool use_weather = pos.z >= 0 && flag != temperature_flag::ROOT_CELLAR;
 
+        // Process the past of this item in 1h chunks until there is less than 1h left.
         while( now - time > 1_hours ) {
+            time_duration time_delta = 1_hours;
+            if( !use_weather && now - time > 2_days + 1_hours &&
+                time >= calendar::start_of_cataclysm ) {
+                // Item temperature isn't tracked this far back and the environment doesn't
+                // change, so the rot of all those hours can be added in one go.
+                time_delta = to_hours<int>( now - 2_days - time ) * 1_hours;
+            }
             time += time_delta;
 
             // Get the environment temperature
-            // Use weather if above ground, use map temp if below
             double env_temperature = 0;
-            if( pos.z >= 0 && flag != temperature_flag::ROOT_CELLAR ) {
-                double weather_temperature = wgen.get_weather_temperature( pos, time, seed );
+            if( use_weather ) {
+                double weather_temperature = weather.get_past_weather_temperature( abs_pos, time );
                 env_temperature = weather_temperature + enviroment_mod + local_mod;
             } else {
                 env_temperature = AVERAGE_ANNUAL_TEMPERATURE + enviroment_mod + local_mod;
@@ -9264,31 +9326,31 @@ void item::calc_temp( const int temp, const float insulation, const time_duratio
     // Warm = over temperatures::warm
     // Cold = below temperatures::cold
     // Frozen = Over 50% frozen
-    if( item_tags.count( "FROZEN" ) ) {
-        item_tags.erase( "FROZEN" );
+    if( has_own_flag( flag_FROZEN ) ) {
+        unset_flag( flag_FROZEN );
         if( freeze_percentage < 0.5 ) {
             // Item melts and becomes mushy
             current_phase = type->phase;
             apply_freezerburn();
         }
-    } else if( item_tags.count( "COLD" ) ) {
-        item_tags.erase( "COLD" );
-    } else if( item_tags.count( "HOT" ) ) {
-        item_tags.erase( "HOT" );
+    } else if( has_own_flag( flag_COLD ) ) {
+        unset_flag( flag_COLD );
+    } else if( has_own_flag( flag_HOT ) ) {
+        unset_flag( flag_HOT );
     }
     if( new_item_temperature > temp_to_kelvin( temperatures::hot ) ) {
-        item_tags.insert( "HOT" );
+        set_flag( flag_HOT );
     } else if( freeze_percentage > 0.5 ) {
-        item_tags.insert( "FROZEN" );
+        set_flag( flag_FROZEN );
         current_phase = phase_id::SOLID;
         // If below freezing temp AND the food may have parasites AND food does not have "NO_PARASITES" tag then add the "NO_PARASITES" tag.
         if( is_food() && new_item_temperature < freezing_temperature && get_comestible()->parasites > 0 ) {
-            if( !( item_tags.count( "NO_PARASITES" ) ) ) {
-                item_tags.insert( "NO_PARASITES" );
+            if( !has_own_flag( flag_NO_PARASITES ) ) {
+                set_flag( flag_NO_PARASITES );
             }
         }
     } else if( new_item_temperature < temp_to_kelvin( temperatures::cold ) ) {
-        item_tags.insert( "COLD" );
+        set_flag( flag_COLD );
     }
     temperature = std::lround( 100000 * new_item_temperature );
     specific_energy = std::lround( 100000 * new_specific_energy );
@@ -9303,9 +9365,9 @@ float item::get_item_thermal_energy() const
 
 void item::heat_up()
 {
-    item_tags.erase( "COLD" );
-    item_tags.erase( "FROZEN" );
-    item_tags.insert( "HOT" );
+    unset_flag( flag_COLD );
+    unset_flag( flag_FROZEN );
+    set_flag( flag_HOT );
     current_phase = type->phase;
     // Set item temperature to 60 C (333.15 K, 122 F)
     // Also set the energy to match
@@ -9317,9 +9379,9 @@ void item::heat_up()
 
 void item::cold_up()
 {
-    item_tags.erase( "HOT" );
-    item_tags.erase( "FROZEN" );
-    item_tags.insert( "COLD" );
+    unset_flag( flag_HOT );
+    unset_flag( flag_FROZEN );
+    set_flag( flag_COLD );
     current_phase = type->phase;
     // Set item temperature to 3 C (276.15 K, 37.4 F)
     // Also set the energy to match
@@ -9680,7 +9742,7 @@ bool item::process_cable( player *carrier, const tripoint &pos )
 
     int distance = rl_dist( pos, *source );
     int max_charges = type->maximum_charges();
-    charges = max_charges - distance;
+    set_charges( max_charges - distance );
 
     if( charges < 1 ) {
         if( carrier->has_item( *this ) ) {
@@ -9701,7 +9763,7 @@ void item::reset_cable( player *p )
     erase_var( "source_y" );
     erase_var( "source_z" );
     active = false;
-    charges = max_charges;
+    set_charges( max_charges );
 
     if( p != nullptr ) {
         p->add_msg_if_player( m_info, _( "You reel in the cable." ) );
@@ -9733,7 +9795,7 @@ bool item::process_wet( player * /*carrier*/, const tripoint & /*pos*/ )
         if( is_tool() && type->tool->revert_to ) {
             convert( *type->tool->revert_to );
         }
-        item_tags.erase( "WET" );
+        unset_flag( flag_WET );
         active = false;
     }
     // Always return true so our caller will bail out instead of processing us as a tool.
@@ -9915,14 +9977,21 @@ void item::mod_charges( int mod )
         debugmsg( "Tried to remove %s by charges, but item is not counted by charges.", tname() );
     } else if( mod < 0 && charges + mod < 0 ) {
         debugmsg( "Tried to remove charges that do not exist, removing maximum available charges instead." );
-        charges = 0;
+        set_charges( 0 );
     } else if( mod > 0 && charges >= INFINITE_CHARGES - mod ) {
-        charges = INFINITE_CHARGES - 1; // Highly unlikely, but finite charges should not become infinite.
+        // Highly unlikely, but finite charges should not become infinite.
+        set_charges( INFINITE_CHARGES - 1 );
     } else {
-        charges += mod;
+        set_charges( charges + mod );
     }
 }
 
+void item::set_charges( int qty )
+{
+    charges = qty;
+    contents.invalidate_outer_totals();
+}
+
 bool item::has_effect_when_wielded( art_effect_passive effect ) const
 {
     if( !type->artifact ) {
@@ -10183,8 +10252,8 @@ bool item::on_drop( const tripoint &pos, map &m )
     // dropping liquids, even currently frozen ones, on the ground makes them
     // dirty
     if( made_of_from_type( phase_id::LIQUID ) && !m.has_flag( flag_LIQUIDCONT, pos ) &&
-        !item_tags.count( "DIRTY" ) ) {
-        item_tags.insert( "DIRTY" );
+        !has_own_flag( flag_DIRTY ) ) {
+        set_flag( flag_DIRTY );
     }
 
     avatar &player_character = get_avatar();
@@ -10315,7 +10384,7 @@ const cata::value_ptr<islot_comestible> &item::get_comestible() const
 bool item::has_clothing_mod() const
 {
     for( const clothing_mod &cm : clothing_mods::get_all() ) {
-        if( item_tags.count( cm.flag ) > 0 ) {
+        if( has_own_flag( cm.flag ) ) {
             return true;
         }
     }
@@ -10336,7 +10405,7 @@ void item::update_clothing_mod_val()
                                     type );
         float tmp = 0.0f;
         for( const clothing_mod &cm : clothing_mods::get_all_with( type ) ) {
-            if( item_tags.count( cm.flag ) > 0 ) {
+            if( has_own_flag( cm.flag ) ) {
                 tmp += cm.get_mod_val( type, *this );
             }
         }
@@ -18,6 +18,7 @@
 #include "cata_utility.h"
 #include "craft_command.h"
 #include "enums.h"
+#include "flag.h"
 #include "flat_set.h"
 #include "gun_mode.h"
 #include "io_tags.h"
@@ -788,6 +789,12 @@ class item : public visitable<item>
          */
         void mod_charges( int mod );
 
+        /**
+         * Set the charges of this item and mark the pockets containing it as changed.
+         * All writes to @ref charges should go through here.
+         */
+        void set_charges( int qty );
+
         /**
          * Accumulate rot of the item since last rot calculation.
          * This function should not be called directly. since it does not have all the needed checks or temperature calculations.
@@ -1431,6 +1438,15 @@ class item : public visitable<item>
         void clear_vars();
         /*@}*/
 
+        /**
+         * Replaces the weight or volume of the item type for this item, e.g. for a folded
+         * vehicle or a captured monster. cata::nullopt goes back to the type's value.
+         */
+        /*@{*/
+        void set_weight_override( const cata::optional<units::mass> &weight );
+        void set_volume_override( const cata::optional<units::volume> &volume );
+        /*@}*/
+
         /**
          * @name Item flags
          *
@@ -1443,13 +1459,23 @@ class item : public visitable<item>
          * Gun mods that are attached to guns also contribute their flags to the gun item.
          */
         /*@{*/
+        bool has_flag( const flag_id &flag ) const;
         bool has_flag( const std::string &flag ) const;
         bool has_any_flag( const std::vector<std::string> &flags ) const;
 
+        /** Whether the item itself has the flag, ignoring its type and any attached mods */
+        bool has_own_flag( const flag_id &flag ) const;
+        bool has_own_flag( const std::string &flag ) const;
+
+        /** The item specific flags, not including those of its type */
+        const cata::flat_set<std::string> &get_flags() const;
+
         /** Idempotent filter setting an item specific flag. */
+        item &set_flag( const flag_id &flag );
         item &set_flag( const std::string &flag );
 
         /** Idempotent filter removing an item specific flag */
+        item &unset_flag( const flag_id &flag );
         item &unset_flag( const std::string &flag );
 
         /** Idempotent filter recursively setting an item specific flag on this item and its components. */
@@ -2222,12 +2248,15 @@ class item : public visitable<item>
         std::list<item> components;
         /** What faults (if any) currently apply to this item */
         std::set<fault_id> faults;
-        cata::flat_set<std::string> item_tags; // generic item specific flags
 
     private:
+        cata::flat_set<std::string> item_tags; // generic item specific flags
+        flag_bitset item_tag_bits; // mirrors item_tags for membership tests
         safe_reference_anchor anchor;
         const itype *curammo = nullptr;
         std::map<std::string, std::string> item_vars;
+        cata::optional<units::mass> weight_override;
+        cata::optional<units::volume> volume_override;
         const mtype *corpse = nullptr;
         std::string corpse_name;       // Name of the late lamented
         std::set<matec_id> techniques; // item specific techniques
@@ -2255,6 +2284,11 @@ class item : public visitable<item>
         // any relic data specific to this item
         cata::value_ptr<relic> relic_data;
     public:
+        /**
+         * Read freely, but write through @ref set_charges so containers notice. Only the
+         * constructors and deserialization set it directly, as they run before the item
+         * is in a pocket.
+         */
         int charges = 0;
         units::energy energy = 0_mJ; // Amount of energy currently stored in a battery
 
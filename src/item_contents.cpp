@@ -196,6 +196,47 @@ item_contents::item_contents( const std::vector<pocket_data> &pockets )
     for( const pocket_data &data : pockets ) {
         contents.push_back( item_pocket( &data ) );
     }
+    adopt_pockets();
+}
+
+item_contents::item_contents( const item_contents &rhs ) : contents( rhs.contents )
+{
+    adopt_pockets();
+}
+
+item_contents::item_contents( item_contents &&rhs ) : contents( std::move( rhs.contents ) )
+{
+    adopt_pockets();
+}
+
+item_contents &item_contents::operator=( const item_contents &rhs )
+{
+    contents = rhs.contents;
+    adopt_pockets();
+    invalidate_outer_totals();
+    return *this;
+}
+
+item_contents &item_contents::operator=( item_contents &&rhs )
+{
+    contents = std::move( rhs.contents );
+    adopt_pockets();
+    invalidate_outer_totals();
+    return *this;
+}
+
+void item_contents::adopt_pockets()
+{
+    for( item_pocket &pocket : contents ) {
+        pocket.owner = this;
+    }
+}
+
+void item_contents::invalidate_outer_totals()
+{
+    if( outer != nullptr ) {
+        outer->invalidate_totals();
+    }
 }
 bool item_contents::empty_real() const
 {
@@ -1158,6 +1199,8 @@ void item_contents::update_modified_pockets(
     for( const pocket_data *container_pocket : container_pockets ) {
         contents.push_back( item_pocket( container_pocket ) );
     }
+    adopt_pockets();
+    invalidate_outer_totals();
 
 }
 
@@ -1282,7 +1325,7 @@ int item_contents::remaining_capacity_for_liquid( const item &liquid ) const
 {
     int charges_of_liquid = 0;
     item liquid_copy = liquid;
-    liquid_copy.charges = 1;
+    liquid_copy.set_charges( 1 );
     for( const item_pocket &pocket : contents ) {
         if( !pocket.is_type( item_pocket::pocket_type::CONTAINER ) ) {
             continue;
@@ -38,6 +38,18 @@ class item_contents
         item_contents() = default;
         // used for loading itype
         item_contents( const std::vector<pocket_data> &pockets );
+        // copies are not in the pocket the original is in
+        item_contents( const item_contents &rhs );
+        item_contents( item_contents &&rhs );
+        item_contents &operator=( const item_contents &rhs );
+        item_contents &operator=( item_contents &&rhs );
+
+        /**
+         * Marks the cached totals of the pocket the owning item is in, and of the pockets
+         * containing that, out of date. Called when the weight or volume of the owning item
+         * changes.
+         */
+        void invalidate_outer_totals();
 
         /**
           * returns an item_location and pointer to the best pocket that can contain the item @it
@@ -260,11 +272,17 @@ class item_contents
         //called by all_items_ptr to recursively get all items without duplicating items in nested pockets
         std::list<item *> all_items_top_recursive( item_pocket::pocket_type pk_type );
 
+        /** Points the pockets at this object, after they were added, copied or moved. */
+        void adopt_pockets();
+
         std::list<item_pocket> contents;
+        /** The pocket the owning item is in, maintained by that pocket. */
+        item_pocket *outer = nullptr;
 
         struct item_contents_helper;
 
         friend struct item_contents_helper;
+        friend class item_pocket;
 };
 
 #endif // CATA_SRC_ITEM_CONTENTS_H
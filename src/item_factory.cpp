@@ -472,6 +472,11 @@ void Item_factory::finalize_pre( itype &obj )
                                          ( obj.volume / obj.stack_size ) : obj.volume;
         obj.longest_side = units::default_length_from_volume<int>( effective_volume );
     }
+
+    obj.item_tag_bits.clear();
+    for( const std::string &tag : obj.item_tags ) {
+        obj.item_tag_bits.set( flag_id( flag_str_id( tag ) ) );
+    }
 }
 
 void Item_factory::register_cached_uses( const itype &obj )
@@ -2906,17 +2911,18 @@ void Item_factory::migrate_item( const itype_id &id, item &obj )
 {
     auto iter = migrations.find( id );
     if( iter != migrations.end() ) {
-        std::copy( iter->second.flags.begin(), iter->second.flags.end(), std::inserter( obj.item_tags,
-                   obj.item_tags.begin() ) );
+        for( const std::string &flag : iter->second.flags ) {
+            obj.set_flag( flag );
+        }
         if( iter->second.charges > 0 ) {
-            obj.charges = iter->second.charges;
+            obj.set_charges( iter->second.charges );
         }
 
         for( const migration::content &it : iter->second.contents ) {
             int count = it.count;
             item content( it.id, obj.birthday(), 1 );
             if( content.count_by_charges() ) {
-                content.charges = count;
+                content.set_charges( count );
                 count = 1;
             }
             for( ; count > 0; --count ) {
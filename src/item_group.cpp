@@ -85,7 +85,7 @@ item Single_item_creator::create_single( const time_point &birthday, RecursionLi
         return item( null_item_id, birthday );
     }
     if( one_in( 3 ) && tmp.has_flag( flag_VARSIZE ) ) {
-        tmp.item_tags.insert( "FIT" );
+        tmp.set_flag( "FIT" );
     }
     if( modifier ) {
         modifier->modify( tmp );
@@ -337,7 +337,7 @@ void Item_modifier::modify( item &new_item ) const
         ch = charges_min == charges_max ? charges_min : rng( charges_min,
                 charges_max );
     } else if( !cont.is_null() && new_item.made_of( phase_id::LIQUID ) ) {
-        new_item.charges = std::max( 1, max_capacity );
+        new_item.set_charges( std::max( 1, max_capacity ) );
     }
 
     if( ch != -1 ) {
@@ -345,7 +345,7 @@ void Item_modifier::modify( item &new_item ) const
             // food, ammo
             // count_by_charges requires that charges is at least 1. It makes no sense to
             // spawn a "water (0)" item.
-            new_item.charges = std::max( 1, ch );
+            new_item.set_charges( std::max( 1, ch ) );
         } else if( new_item.is_tool() ) {
             if( !new_item.magazine_default().is_null() ) {
                 item mag( new_item.magazine_default() );
@@ -358,7 +358,7 @@ void Item_modifier::modify( item &new_item ) const
                           new_item.typeId().c_str() );
             }
         } else if( new_item.type->can_have_charges() ) {
-            new_item.charges = ch;
+            new_item.set_charges( ch );
         }
     }
 
@@ -380,10 +380,11 @@ void Item_modifier::modify( item &new_item ) const
         }
         // Make sure the item is in valid state
         if( new_item.magazine_integral() ) {
-            new_item.charges = std::min( new_item.charges,
-                                         new_item.ammo_capacity( item_controller->find_template( new_item.ammo_default() )->ammo->type ) );
+            new_item.set_charges( std::min( new_item.charges,
+                                            new_item.ammo_capacity( item_controller->find_template(
+                                                    new_item.ammo_default() )->ammo->type ) ) );
         } else {
-            new_item.charges = 0;
+            new_item.set_charges( 0 );
         }
     }
 
@@ -149,6 +149,48 @@ void resealable_data::load( const JsonObject &jo )
     optional( jo, was_loaded, "spoil_multiplier", spoil_multiplier, 1.0f );
 }
 
+item_pocket::item_pocket( const item_pocket &rhs ) : settings( rhs.settings ),
+    _saved_type( rhs._saved_type ), _saved_sealed( rhs._saved_sealed ), data( rhs.data ),
+    contents( rhs.contents ), _sealed( rhs._sealed ), totals( rhs.totals )
+{
+    adopt_contents();
+}
+
+item_pocket::item_pocket( item_pocket &&rhs ) : settings( std::move( rhs.settings ) ),
+    _saved_type( rhs._saved_type ), _saved_sealed( rhs._saved_sealed ), data( rhs.data ),
+    contents( std::move( rhs.contents ) ), _sealed( rhs._sealed ), totals( rhs.totals )
+{
+    rhs.totals = cached_totals();
+    adopt_contents();
+}
+
+item_pocket &item_pocket::operator=( const item_pocket &rhs )
+{
+    settings = rhs.settings;
+    _saved_type = rhs._saved_type;
+    _saved_sealed = rhs._saved_sealed;
+    data = rhs.data;
+    contents = rhs.contents;
+    _sealed = rhs._sealed;
+    adopt_contents();
+    invalidate_totals();
+    return *this;
+}
+
+item_pocket &item_pocket::operator=( item_pocket &&rhs )
+{
+    settings = std::move( rhs.settings );
+    _saved_type = rhs._saved_type;
+    _saved_sealed = rhs._saved_sealed;
+    data = rhs.data;
+    contents = std::move( rhs.contents );
+    _sealed = rhs._sealed;
+    rhs.totals = cached_totals();
+    adopt_contents();
+    invalidate_totals();
+    return *this;
+}
+
 bool item_pocket::operator==( const item_pocket &rhs ) const
 {
     return *data == *rhs.data;
@@ -199,6 +241,7 @@ void item_pocket::restack()
             }
             if( outer_iter->combine( *inner_iter ) ) {
                 inner_iter = contents.erase( inner_iter );
+                invalidate_totals();
                 outer_iter = contents.begin();
             } else {
                 ++inner_iter;
@@ -228,6 +271,7 @@ item *item_pocket::restack( /*const*/ item *it )
                     ret = &( *outer_iter );
                 }
                 inner_iter = contents.erase( inner_iter );
+                invalidate_totals();
                 outer_iter = contents.begin();
             } else {
                 ++inner_iter;
@@ -397,6 +441,7 @@ const item &item_pocket::front() const
 void item_pocket::pop_back()
 {
     contents.pop_back();
+    invalidate_totals();
 }
 
 size_t item_pocket::size() const
@@ -433,7 +478,7 @@ int item_pocket::remaining_capacity_for_item( const item &it ) const
 {
     item item_copy( it );
     if( item_copy.count_by_charges() ) {
-        item_copy.charges = 1;
+        item_copy.set_charges( 1 );
     }
     if( !can_contain( item_copy ).success() ) {
         return 0;
@@ -452,10 +497,7 @@ units::volume item_pocket::item_size_modifier() const
     if( data->rigid ) {
         return 0_ml;
     }
-    units::volume total_vol = 0_ml;
-    for( const item &it : contents ) {
-        total_vol += it.volume( is_type( item_pocket::pocket_type::MOD ) );
-    }
+    units::volume total_vol = get_totals().modifier_volume;
     total_vol -= data->magazine_well;
     total_vol *= data->volume_multiplier;
     return std::max( 0_ml, total_vol );
@@ -463,15 +505,47 @@ units::volume item_pocket::item_size_modifier() const
 
 units::mass item_pocket::item_weight_modifier() const
 {
-    units::mass total_mass = 0_gram;
+    return get_totals().modified_weight;
+}
+
+void item_pocket::invalidate_totals()
+{
+    totals.valid = false;
+    if( owner != nullptr ) {
+        owner->invalidate_outer_totals();
+    }
+}
+
+void item_pocket::adopt_contents()
+{
+    for( item &it : contents ) {
+        it.contents.outer = this;
+    }
+}
+
+const item_pocket::cached_totals &item_pocket::get_totals() const
+{
+    if( totals.valid ) {
+        return totals;
+    }
+    totals = cached_totals();
+    const bool mod = data != nullptr && is_type( item_pocket::pocket_type::MOD );
+    const float weight_multiplier = data != nullptr ? data->weight_multiplier : 1.0f;
     for( const item &it : contents ) {
-        if( is_type( item_pocket::pocket_type::MOD ) ) {
-            total_mass += it.weight( true, true ) * data->weight_multiplier;
+        const units::mass weight = it.weight();
+        const units::volume volume = it.volume();
+        totals.weight += weight;
+        totals.volume += volume;
+        if( mod ) {
+            totals.modified_weight += it.weight( true, true ) * weight_multiplier;
+            totals.modifier_volume += it.volume( true );
         } else {
-            total_mass += it.weight() * data->weight_multiplier;
+            totals.modified_weight += weight * weight_multiplier;
+            totals.modifier_volume += volume;
         }
     }
-    return total_mass;
+    totals.valid = true;
+    return totals;
 }
 
 float item_pocket::spoil_multiplier() const
@@ -545,8 +619,9 @@ int item_pocket::ammo_consume( int qty )
             need -= e.charges;
             used += e.charges;
             contents.erase( contents.begin() );
+            invalidate_totals();
         } else {
-            e.charges -= need;
+            e.set_charges( e.charges - need );
             used = need;
             break;
         }
@@ -580,6 +655,7 @@ void item_pocket::casings_handle( const std::function<bool( item & )> &func )
             it->unset_flag( "CASING" );
             if( func( *it ) ) {
                 it = contents.erase( it );
+                invalidate_totals();
                 continue;
             }
             // didn't handle the casing so reset the flag ready for next call
@@ -595,10 +671,12 @@ void item_pocket::handle_liquid_or_spill( Character &guy, const item *avoid )
         if( iter->made_of( phase_id::LIQUID ) ) {
             item liquid( *iter );
             iter = contents.erase( iter );
+            invalidate_totals();
             liquid_handler::handle_all_liquid( liquid, 1, avoid );
         } else {
             item i_copy( *iter );
             iter = contents.erase( iter );
+            invalidate_totals();
             guy.i_add_or_drop( i_copy, 1, avoid );
         }
     }
@@ -611,6 +689,7 @@ bool item_pocket::use_amount( const itype_id &it, int &quantity, std::list<item>
         if( a->use_amount( it, quantity, used ) ) {
             used_item = true;
             a = contents.erase( a );
+            invalidate_totals();
         } else {
             ++a;
         }
@@ -684,6 +763,7 @@ bool item_pocket::detonate( const tripoint &pos, std::vector<item> &drops )
     } );
     if( new_end != contents.end() ) {
         contents.erase( new_end, contents.end() );
+        invalidate_totals();
         // If any of the contents explodes, so does the container
         return true;
     }
@@ -701,6 +781,7 @@ bool item_pocket::process( const itype &type, player *carrier, const tripoint &p
         }
         if( it->process( carrier, pos, type.insulation_factor * insulation, flag, spoil_multiplier ) ) {
             it = contents.erase( it );
+            invalidate_totals();
             processed = true;
         } else {
             ++it;
@@ -718,6 +799,7 @@ void item_pocket::remove_all_ammo( Character &guy )
         }
         drop_or_handle( *iter, guy );
         iter = contents.erase( iter );
+        invalidate_totals();
     }
 }
 
@@ -727,6 +809,7 @@ void item_pocket::remove_all_mods( Character &guy )
         if( iter->is_toolmod() ) {
             guy.i_add_or_drop( *iter );
             iter = contents.erase( iter );
+            invalidate_totals();
         } else {
             ++iter;
         }
@@ -744,8 +827,8 @@ void item_pocket::set_item_defaults()
                                                   contained_item.ammo_default() )->ammo->type ) / 2
             );
         } else { //Contents are batteries or food
-            contained_item.charges =
-                item::find_type( contained_item.typeId() )->charges_default();
+            contained_item.set_charges(
+                item::find_type( contained_item.typeId() )->charges_default() );
         }
     }
 }
@@ -1074,6 +1157,7 @@ cata::optional<item> item_pocket::remove_item( const item &it )
     if( sz == contents.size() ) {
         return cata::nullopt;
     } else {
+        invalidate_totals();
         return ret;
     }
 }
@@ -1083,7 +1167,9 @@ bool item_pocket::remove_internal( const std::function<bool( item & )> &filter,
 {
     for( auto it = contents.begin(); it != contents.end(); ) {
         if( filter( *it ) ) {
+            it->contents.outer = nullptr;
             res.splice( res.end(), contents, it++ );
+            invalidate_totals();
             if( --count == 0 ) {
                 return true;
             }
@@ -1128,6 +1214,7 @@ void item_pocket::overflow( const tripoint &pos )
               ret_contain.value() != contain_code::ERR_CANNOT_SUPPORT ) ) {
             here.add_item_or_charges( pos, *iter );
             iter = contents.erase( iter );
+            invalidate_totals();
         } else {
             ++iter;
         }
@@ -1148,13 +1235,14 @@ void item_pocket::overflow( const tripoint &pos )
             total_qty += ammo.count();
             const int overflow_count = total_qty - ammo_iter->second;
             if( overflow_count > 0 ) {
-                ammo.charges -= overflow_count;
+                ammo.set_charges( ammo.charges - overflow_count );
                 item dropped_ammo( ammo.typeId(), ammo.birthday(), overflow_count );
                 here.add_item_or_charges( pos, contents.front() );
                 total_qty -= overflow_count;
             }
             if( ammo.count() == 0 ) {
                 iter = contents.erase( iter );
+                invalidate_totals();
             } else {
                 ++iter;
             }
@@ -1171,6 +1259,7 @@ void item_pocket::overflow( const tripoint &pos )
         while( remaining_volume() < 0_ml && !contents.empty() ) {
             here.add_item_or_charges( pos, contents.front() );
             contents.pop_front();
+            invalidate_totals();
         }
     }
     if( remaining_weight() < 0_gram ) {
@@ -1180,6 +1269,7 @@ void item_pocket::overflow( const tripoint &pos )
         while( remaining_weight() < 0_gram && !contents.empty() ) {
             here.add_item_or_charges( pos, contents.front() );
             contents.pop_front();
+            invalidate_totals();
         }
     }
 }
@@ -1196,6 +1286,7 @@ void item_pocket::on_contents_changed()
 {
     unseal();
     restack();
+    invalidate_totals();
 }
 
 bool item_pocket::spill_contents( const tripoint &pos )
@@ -1206,12 +1297,14 @@ bool item_pocket::spill_contents( const tripoint &pos )
     }
 
     contents.clear();
+    invalidate_totals();
     return true;
 }
 
 void item_pocket::clear_items()
 {
     contents.clear();
+    invalidate_totals();
 }
 
 bool item_pocket::has_item( const item &it ) const
@@ -1235,6 +1328,7 @@ item *item_pocket::get_item_with( const std::function<bool( const item & )> &fil
 void item_pocket::remove_items_if( const std::function<bool( item & )> &filter )
 {
     contents.remove_if( filter );
+    invalidate_totals();
     on_contents_changed();
 }
 
@@ -1246,6 +1340,7 @@ void item_pocket::process( player *carrier, const tripoint &pos, float insulatio
                            // spoil multipliers on pockets are not additive or multiplicative, they choose the best
                            std::min( spoil_multiplier_parent, spoil_multiplier() ) ) ) {
             iter = contents.erase( iter );
+            invalidate_totals();
         } else {
             ++iter;
         }
@@ -1295,6 +1390,8 @@ const pocket_data *item_pocket::get_pocket_data() const
 void item_pocket::add( const item &it, item **ret )
 {
     contents.push_back( it );
+    contents.back().contents.outer = this;
+    invalidate_totals();
     if( ret == nullptr ) {
         restack();
     } else {
@@ -1305,7 +1402,7 @@ void item_pocket::add( const item &it, item **ret )
 void item_pocket::fill_with( item contained )
 {
     if( contained.count_by_charges() ) {
-        contained.charges = 1;
+        contained.set_charges( 1 );
     }
     while( can_contain( contained ).success() ) {
         add( contained );
@@ -1325,17 +1422,14 @@ bool item_pocket::can_unload_liquid() const
     return will_spill() || !cts_is_frozen_liquid;
 }
 
-std::list<item> &item_pocket::edit_contents()
-{
-    return contents;
-}
-
 ret_val<item_pocket::contain_code> item_pocket::insert_item( const item &it )
 {
     const ret_val<item_pocket::contain_code> ret = !is_standard_type() ?
             ret_val<item_pocket::contain_code>::make_success() : can_contain( it );
     if( ret.success() ) {
         contents.push_back( it );
+        contents.back().contents.outer = this;
+        invalidate_totals();
     }
     restack();
     return ret;
@@ -1361,20 +1455,12 @@ bool item_pocket::is_valid() const
 
 units::volume item_pocket::contains_volume() const
 {
-    units::volume vol = 0_ml;
-    for( const item &it : contents ) {
-        vol += it.volume();
-    }
-    return vol;
+    return get_totals().volume;
 }
 
 units::mass item_pocket::contains_weight() const
 {
-    units::mass weight = 0_gram;
-    for( const item &it : contents ) {
-        weight += it.weight();
-    }
-    return weight;
+    return get_totals().weight;
 }
 
 units::mass item_pocket::remaining_weight() const
@@ -27,6 +27,7 @@
 
 class Character;
 class item;
+class item_contents;
 class item_location;
 class player;
 class pocket_data;
@@ -110,6 +111,11 @@ class item_pocket
 
         item_pocket() = default;
         item_pocket( const pocket_data *data ) : data( data ) {}
+        // copies don't belong to the item_contents the original does
+        item_pocket( const item_pocket &rhs );
+        item_pocket( item_pocket &&rhs );
+        item_pocket &operator=( const item_pocket &rhs );
+        item_pocket &operator=( item_pocket &&rhs );
 
         bool stacks_with( const item_pocket &rhs ) const;
         bool is_funnel_container( units::volume &bigger_than ) const;
@@ -165,6 +171,14 @@ class item_pocket
         units::volume item_size_modifier() const;
         units::mass item_weight_modifier() const;
 
+        /**
+         * The combined weight and volume of the contents are cached until this is called, which
+         * also invalidates the pockets containing this one. Members that change the contents call
+         * it themselves, contained items call it through
+         * @ref item_contents::invalidate_outer_totals.
+         */
+        void invalidate_totals();
+
         /** gets the spoilage multiplier depending on sealed data */
         float spoil_multiplier() const;
 
@@ -253,9 +267,6 @@ class item_pocket
         void fill_with( item contained );
         bool can_unload_liquid() const;
 
-        // only available to help with migration from previous usage of std::list<item>
-        std::list<item> &edit_contents();
-
         // cost of getting an item from this pocket
         // @TODO: make move cost vary based on other contained items
         int obtain_cost( const item &it ) const;
@@ -294,6 +305,24 @@ class item_pocket
         // the items inside the pocket
         std::list<item> contents;
         bool _sealed = false;
+        /** The contents of the item this pocket is part of, maintained by them. */
+        item_contents *owner = nullptr;
+
+        /** Links the contained items to this pocket, after items were added, copied or moved. */
+        void adopt_contents();
+
+        struct cached_totals {
+            bool valid = false;
+            units::mass weight = 0_gram;
+            units::volume volume = 0_ml;
+            // the sums used by item_weight_modifier and item_size_modifier
+            units::mass modified_weight = 0_gram;
+            units::volume modifier_volume = 0_ml;
+        };
+        mutable cached_totals totals;
+        const cached_totals &get_totals() const;
+
+        friend class item_contents;
 };
 
 /**
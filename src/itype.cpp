@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "debug.h"
+#include "flag.h"
 #include "item.h"
 #include "player.h"
 #include "ret_val.h"
@@ -120,6 +121,12 @@ std::string gun_type_type::name() const
     return pgettext( "gun_type_type", name_.c_str() );
 }
 
+bool itype::has_flag( const std::string &flag ) const
+{
+    const flag_id id = json_flag::lookup( flag );
+    return id != flag_id() && has_flag( id );
+}
+
 bool itype::can_have_charges() const
 {
     if( count_by_charges() ) {
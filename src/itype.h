@@ -18,6 +18,7 @@
 #include "damage.h"
 #include "enums.h" // point
 #include "explosion.h"
+#include "flag.h"
 #include "game_constants.h"
 #include "item_contents.h"
 #include "item_pocket.h"
@@ -915,6 +916,8 @@ struct itype {
         std::set<emit_id> emits;
 
         std::set<std::string> item_tags;
+        /** Bitset mirror of @ref item_tags, built when the type is finalized */
+        flag_bitset item_tag_bits;
         std::set<matec_id> techniques;
 
         // Minimum stat(s) or skill(s) to use the item
@@ -1121,6 +1124,12 @@ struct itype {
         }
         bool can_have_charges() const;
 
+        /** Whether the type has the flag, only valid after the type has been finalized */
+        bool has_flag( const flag_id &flag ) const {
+            return item_tag_bits.test( flag );
+        }
+        bool has_flag( const std::string &flag ) const;
+
         /**
          * Number of (charges of) this type of item that fit into the given volume.
          * May return 0 if not even one charge fits into the volume.
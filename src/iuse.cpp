@@ -445,12 +445,12 @@ void remove_radio_mod( item &it, Character &p )
     p.add_msg_if_player( _( "You remove the radio modification from your %s!" ), it.tname() );
     item mod( "radio_mod" );
     p.i_add_or_drop( mod, 1 );
-    it.item_tags.erase( "RADIO_ACTIVATION" );
-    it.item_tags.erase( "RADIO_MOD" );
-    it.item_tags.erase( "RADIOSIGNAL_1" );
-    it.item_tags.erase( "RADIOSIGNAL_2" );
-    it.item_tags.erase( "RADIOSIGNAL_3" );
-    it.item_tags.erase( "RADIOCARITEM" );
+    it.unset_flag( "RADIO_ACTIVATION" );
+    it.unset_flag( "RADIO_MOD" );
+    it.unset_flag( "RADIOSIGNAL_1" );
+    it.unset_flag( "RADIOSIGNAL_2" );
+    it.unset_flag( "RADIOSIGNAL_3" );
+    it.unset_flag( "RADIOCARITEM" );
 }
 
 // Checks that the player does not have an active item with LITCIG flag.
@@ -1788,10 +1788,10 @@ int iuse::radio_mod( player *p, item *, bool, const tripoint & )
     p->add_msg_if_player(
         _( "You modify your %1$s to listen for %2$s activation signal on the radio." ),
         modded.tname(), colorname );
-    modded.item_tags.insert( "RADIO_ACTIVATION" );
-    modded.item_tags.insert( "RADIOCARITEM" );
-    modded.item_tags.insert( "RADIO_MOD" );
-    modded.item_tags.insert( newtag );
+    modded.set_flag( "RADIO_ACTIVATION" );
+    modded.set_flag( "RADIOCARITEM" );
+    modded.set_flag( "RADIO_MOD" );
+    modded.set_flag( newtag );
     return 1;
 }
 
@@ -1889,7 +1889,7 @@ int iuse::fish_trap( player *p, item *it, bool t, const tripoint &pos )
         }
 
         if( it->charges < 0 ) {
-            it->charges = 0;
+            it->set_charges( 0 );
             return 0;
         }
         if( p->is_mounted() ) {
@@ -1949,9 +1949,9 @@ int iuse::fish_trap( player *p, item *it, bool t, const tripoint &pos )
                 success += rng( surv, surv * surv );
             }
 
-            it->charges = rng( -1, it->charges );
+            it->set_charges( rng( -1, it->charges ) );
             if( it->charges < 0 ) {
-                it->charges = 0;
+                it->set_charges( 0 );
             }
 
             int fishes = 0;
@@ -1967,7 +1967,7 @@ int iuse::fish_trap( player *p, item *it, bool t, const tripoint &pos )
             }
 
             if( fishes == 0 ) {
-                it->charges = 0;
+                it->set_charges( 0 );
                 p->practice( skill_survival, rng( 5, 15 ) );
 
                 return 0;
@@ -3708,7 +3708,7 @@ int iuse::granade( player *p, item *it, bool, const tripoint & )
 {
     p->add_msg_if_player( _( "You pull the pin on the Granade." ) );
     it->convert( itype_granade_act );
-    it->charges = 5;
+    it->set_charges( 5 );
     it->active = true;
     return it->type->charges_to_use();
 }
@@ -3871,7 +3871,7 @@ int iuse::c4( player *p, item *it, bool, const tripoint & )
     }
     p->add_msg_if_player( _( "You set the timer to %d." ), time );
     it->convert( itype_c4armed );
-    it->charges = time;
+    it->set_charges( time );
     it->active = true;
     return it->type->charges_to_use();
 }
@@ -3879,7 +3879,7 @@ int iuse::c4( player *p, item *it, bool, const tripoint & )
 int iuse::acidbomb_act( player *p, item *it, bool, const tripoint &pos )
 {
     if( !p->has_item( *it ) ) {
-        it->charges = -1;
+        it->set_charges( -1 );
         map &here = get_map();
         for( const tripoint &tmp : here.points_in_radius( pos.x == -999 ? p->pos() : pos, 1 ) ) {
             here.add_field( tmp, fd_acid, 3 );
@@ -3937,7 +3937,7 @@ int iuse::arrow_flammable( player *p, item *it, bool, const tripoint & )
         return 0;
     }
     item lit_arrow( *it );
-    lit_arrow.convert( itype_arrow_flamming ).charges = 1;
+    lit_arrow.convert( itype_arrow_flamming ).set_charges( 1 );
     p->i_add( lit_arrow );
     return 1;
 }
@@ -3958,7 +3958,7 @@ int iuse::molotov_lit( player *p, item *it, bool t, const tripoint &pos )
                               it->tname() );
         return 0;
     } else if( p->has_item( *it ) && it->charges == 0 ) {
-        it->charges += 1;
+        it->set_charges( it->charges + 1 );
         if( one_in( 5 ) ) {
             p->add_msg_if_player( _( "Your lit Molotov goes out." ) );
             it->convert( itype_molotov ).active = false;
@@ -3980,7 +3980,7 @@ int iuse::firecracker_pack( player *p, item *it, bool, const tripoint & )
     }
     p->add_msg_if_player( _( "You light the pack of firecrackers." ) );
     it->convert( itype_firecracker_pack_act );
-    it->charges = 26;
+    it->set_charges( 26 );
     it->set_age( 0_turns );
     it->active = true;
     return 0; // don't use any charges at all. it has became a new item
@@ -4001,10 +4001,10 @@ int iuse::firecracker_pack_act( player *, item *it, bool, const tripoint &pos )
         for( i = 0; i < ex; i++ ) {
             sounds::sound( pos, 20, sounds::sound_t::combat, _( "Bang!" ), false, "explosion", "small" );
         }
-        it->charges -= ex;
+        it->set_charges( it->charges - ex );
     }
     if( it->charges == 0 ) {
-        it->charges = -1;
+        it->set_charges( -1 );
     }
     return 0;
 }
@@ -4021,7 +4021,7 @@ int iuse::firecracker( player *p, item *it, bool, const tripoint & )
     }
     p->add_msg_if_player( _( "You light the firecracker." ) );
     it->convert( itype_firecracker_act );
-    it->charges = 2;
+    it->set_charges( 2 );
     it->active = true;
     return it->type->charges_to_use();
 }
@@ -4055,7 +4055,7 @@ int iuse::mininuke( player *p, item *it, bool, const tripoint & )
                           to_string( time_duration::from_turns( time ) ) );
     get_event_bus().send<event_type::activates_mininuke>( p->getID() );
     it->convert( itype_mininuke_act );
-    it->charges = time;
+    it->set_charges( time );
     it->active = true;
     return it->type->charges_to_use();
 }
@@ -4194,7 +4194,7 @@ int iuse::tazer2( player *p, item *it, bool b, const tripoint &pos )
         // Instead of having a ctrl+c+v of the function above, spawn a fake tazer and use it
         // Ugly, but less so than copied blocks
         item fake( "tazer", 0 );
-        fake.charges = 100;
+        fake.set_charges( 100 );
         return tazer( p, &fake, b, pos );
     } else {
         p->add_msg_if_player( m_info, _( "Insufficient power" ) );
@@ -5766,7 +5766,7 @@ static bool heat_item( player &p )
 {
     auto loc = g->inv_map_splice( []( const item & itm ) {
         const item *food = itm.get_food();
-        return food && !food->item_tags.count( "HOT" );
+        return food && !food->has_own_flag( "HOT" );
     }, _( "Heat up what?" ), 1, _( "You don't have appropriate food to heat up." ) );
 
     item *heat = loc.get_item();
@@ -5779,7 +5779,7 @@ static bool heat_item( player &p )
     // this is x2 to simulate larger delta temperature of frozen food in relation to
     // heating non-frozen food (x1); no real life physics here, only aproximations
     int duration = to_turns<int>( time_duration::from_seconds( to_gram( target->weight() ) ) ) * 10;
-    if( target->item_tags.count( "FROZEN" ) && !target->has_flag( flag_EATEN_COLD ) ) {
+    if( target->has_own_flag( "FROZEN" ) && !target->has_flag( flag_EATEN_COLD ) ) {
         duration *= 2;
     }
     p.add_msg_if_player( m_info, _( "You start heating up the food." ) );
@@ -5909,7 +5909,7 @@ int iuse::towel_common( Character *p, item *it, bool t )
             }
 
             // WET, active items have their timer decremented every turn
-            it->item_tags.insert( "WET" );
+            it->set_flag( "WET" );
             it->active = true;
         }
     }
@@ -6419,7 +6419,7 @@ static void init_memory_card_with_random_stuff( item &it )
                                         it.has_flag( "MC_SCIENCE_STUFF" ) ) && !( it.has_flag( "MC_USED" ) ||
                                                 it.has_flag( "MC_HAS_DATA" ) ) ) {
 
-        it.item_tags.insert( "MC_HAS_DATA" );
+        it.set_flag( "MC_HAS_DATA" );
 
         bool encrypted = false;
 
@@ -8054,7 +8054,7 @@ int iuse::camera( player *p, item *it, bool, const tripoint & )
         mc.convert( itype_mobile_memory_card );
         mc.clear_vars();
         mc.unset_flags();
-        mc.item_tags.insert( "MC_HAS_DATA" );
+        mc.set_flag( "MC_HAS_DATA" );
 
         mc.set_var( "MC_MONSTER_PHOTOS", it->get_var( "CAMERA_MONSTER_PHOTOS" ) );
         mc.set_var( "MC_EXTENDED_PHOTOS", it->get_var( "CAMERA_EXTENDED_PHOTOS" ) );
@@ -8073,7 +8073,7 @@ int iuse::ehandcuffs( player *p, item *it, bool t, const tripoint &pos )
     if( t ) {
 
         if( get_map().has_flag( "SWIMMABLE", pos.xy() ) ) {
-            it->item_tags.erase( "NO_UNWIELD" );
+            it->unset_flag( "NO_UNWIELD" );
             it->ammo_unset();
             it->active = false;
             add_msg( m_good, _( "%s automatically turned off!" ), it->tname() );
@@ -8083,7 +8083,7 @@ int iuse::ehandcuffs( player *p, item *it, bool t, const tripoint &pos )
         if( it->charges == 0 ) {
 
             sounds::sound( pos, 2, sounds::sound_t::combat, "Click.", true, "tools", "handcuffs" );
-            it->item_tags.erase( "NO_UNWIELD" );
+            it->unset_flag( "NO_UNWIELD" );
             it->active = false;
 
             if( p->has_item( *it ) && p->weapon.typeId() == itype_e_handcuffs ) {
@@ -8098,7 +8098,7 @@ int iuse::ehandcuffs( player *p, item *it, bool t, const tripoint &pos )
                 one_in( 5 ) ) {
                 p->mod_power_level( -2_kJ );
 
-                it->item_tags.erase( "NO_UNWIELD" );
+                it->unset_flag( "NO_UNWIELD" );
                 it->ammo_unset();
                 it->active = false;
                 add_msg( m_good, _( "The %s crackle with electricity from your bionic, then come off your hands!" ),
@@ -8137,9 +8137,9 @@ int iuse::ehandcuffs( player *p, item *it, bool t, const tripoint &pos )
                 add_msg( m_bad, _( "The %s spark with electricity!" ), it->tname() );
             }
 
-            it->charges -= 50;
+            it->set_charges( it->charges - 50 );
             if( it->charges < 1 ) {
-                it->charges = 1;
+                it->set_charges( 1 );
             }
 
             it->set_var( "HANDCUFFS_X", pos.x );
@@ -8452,7 +8452,7 @@ static bool hackveh( player &p, item &it, vehicle &veh )
     if( effort == 0 && !query_yn( _( "Try to hack this car's security system?" ) ) ) {
         // Scanning for security systems isn't free
         p.moves -= to_moves<int>( 1_seconds );
-        it.charges -= 1;
+        it.set_charges( it.charges - 1 );
         return false;
     }
 
@@ -8471,7 +8471,7 @@ static bool hackveh( player &p, item &it, vehicle &veh )
     }
 
     p.moves -= to_moves<int>( time_duration::from_seconds( effort ) );
-    it.charges -= effort;
+    it.set_charges( it.charges - effort );
     if( success && advanced ) { // Unlock controls, but only if they're drive-by-wire
         veh.is_locked = false;
     }
@@ -9587,7 +9587,7 @@ bool item::release_monster( const tripoint &target, const int radius )
     erase_var( "contained_name" );
     erase_var( "contained_json" );
     erase_var( "name" );
-    erase_var( "weight" );
+    set_weight_override( cata::nullopt );
     return true;
 }
 
@@ -9605,8 +9605,8 @@ int item::contain_monster( const tripoint &target )
     set_var( "contained_name", f.type->nname() );
     set_var( "name", string_format( _( "%s holding %s" ), type->nname( 1 ),
                                     f.type->nname() ) );
-    // Need to add the weight of the empty container because item::weight uses the "weight" variable directly.
-    set_var( "weight", to_milligram( type->weight + f.get_weight() ) );
+    // Need to add the weight of the empty container because the override replaces the type's weight.
+    set_weight_override( type->weight + f.get_weight() );
     g->remove_zombie( f );
     return 0;
 }
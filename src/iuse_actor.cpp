@@ -341,7 +341,7 @@ void iuse_transform::info( const item &it, std::vector<iteminfo> &dump ) const
 {
     item dummy( target, calendar::turn, std::max( ammo_qty, 1 ) );
     if( it.has_flag( "FIT" ) ) {
-        dummy.item_tags.insert( "FIT" );
+        dummy.set_flag( "FIT" );
     }
     dump.emplace_back( "TOOL", string_format( _( "<bold>Turns into</bold>: %s" ),
                        dummy.tname() ) );
@@ -914,7 +914,7 @@ int place_monster_iuse::use( player &p, item &it, bool, const tripoint & ) const
                 continue;
             }
             // Don't load more than the default from the monster definition.
-            ammo_item.charges = std::min( available, amdef.second );
+            ammo_item.set_charges( std::min( available, amdef.second ) );
             p.use_charges( amdef.first, ammo_item.charges );
             //~ First %s is the ammo item (with plural form and count included), second is the monster name
             p.add_msg_if_player( ngettext( "You load %1$d x %2$s round into the %3$s.",
@@ -1500,13 +1500,13 @@ int salvage_actor::cut_up( player &p, item &it, item_location &cut ) const
         item result( mat_name, calendar::turn );
         if( amount > 0 ) {
             if( result.count_by_charges() ) {
-                result.charges = amount;
+                result.set_charges( amount );
                 amount = 1;
             }
             add_msg( m_good, ngettext( "Salvaged %1$i %2$s.", "Salvaged %1$i %2$s.", amount ),
                      amount, result.display_name( amount ) );
             if( filthy ) {
-                result.item_tags.insert( "FILTHY" );
+                result.set_flag( "FILTHY" );
             }
             if( cut_type == item_location::type::character ) {
                 p.i_add_or_drop( result, amount );
@@ -2930,7 +2930,7 @@ repair_item_actor::attempt_hint repair_item_actor::repair( player &pl, item &too
             if( !fix->has_flag( "FIT" ) ) {
                 pl.add_msg_if_player( m_good, _( "You take your %s in, improving the fit." ),
                                       fix->tname() );
-                fix->item_tags.insert( "FIT" );
+                fix->set_flag( "FIT" );
             }
             handle_components( pl, *fix, false, false );
             return AS_SUCCESS;
@@ -2944,7 +2944,7 @@ repair_item_actor::attempt_hint repair_item_actor::repair( player &pl, item &too
         if( roll == SUCCESS ) {
             pl.add_msg_if_player( m_good, _( "You resize the %s to accommodate your tiny build." ),
                                   fix->tname().c_str() );
-            fix->item_tags.insert( "UNDERSIZE" );
+            fix->set_flag( "UNDERSIZE" );
             handle_components( pl, *fix, false, false );
             return AS_SUCCESS;
         }
@@ -2956,7 +2956,7 @@ repair_item_actor::attempt_hint repair_item_actor::repair( player &pl, item &too
         if( roll == SUCCESS ) {
             pl.add_msg_if_player( m_good, _( "You adjust the %s back to its normal size." ),
                                   fix->tname().c_str() );
-            fix->item_tags.erase( "UNDERSIZE" );
+            fix->unset_flag( "UNDERSIZE" );
             handle_components( pl, *fix, false, false );
             return AS_SUCCESS;
         }
@@ -3267,7 +3267,7 @@ int heal_actor::finish_using( player &healer, player &patient, item &it, bodypar
             }
         } else {
             item used_up( used_up_item_id, it.birthday() );
-            used_up.charges = used_up_item_charges;
+            used_up.set_charges( used_up_item_charges );
             for( const auto &flag : used_up_item_flags ) {
                 used_up.set_flag( flag );
             }
@@ -4190,10 +4190,10 @@ int sew_advanced_actor::use( player &p, item &it, bool, const tripoint & ) const
     // Gives us an item with the mod added or removed (toggled)
     const auto modded_copy = []( const item & proto, const std::string & mod_type ) {
         item mcopy = proto;
-        if( mcopy.item_tags.count( mod_type ) == 0 ) {
-            mcopy.item_tags.insert( mod_type );
+        if( !mcopy.has_own_flag( mod_type ) ) {
+            mcopy.set_flag( mod_type );
         } else {
-            mcopy.item_tags.erase( mod_type );
+            mcopy.unset_flag( mod_type );
         }
 
         return mcopy;
@@ -4210,7 +4210,7 @@ int sew_advanced_actor::use( player &p, item &it, bool, const tripoint & ) const
 
     int mod_count = 0;
     for( const clothing_mod &cm : clothing_mods::get_all() ) {
-        mod_count += mod.item_tags.count( cm.flag );
+        mod_count += mod.has_own_flag( cm.flag );
     }
 
     // We need extra thread to lose it on bad rolls
@@ -4241,7 +4241,7 @@ int sew_advanced_actor::use( player &p, item &it, bool, const tripoint & ) const
 
         bool enab = false;
         std::string prompt;
-        if( mod.item_tags.count( obj.flag ) == 0 ) {
+        if( !mod.has_own_flag( obj.flag ) ) {
             // TODO: Fix for UTF-8 strings
             // TODO: find other places where this is used and make a global function for all
             static const auto tolower = []( std::string t ) {
@@ -4303,9 +4303,9 @@ int sew_advanced_actor::use( player &p, item &it, bool, const tripoint & ) const
     const std::string &the_mod = clothing_mods[choice].obj().flag;
 
     // If the picked mod already exists, player wants to destroy it
-    if( mod.item_tags.count( the_mod ) ) {
+    if( mod.has_own_flag( the_mod ) ) {
         if( query_yn( _( "Are you sure?  You will not gain any materials back." ) ) ) {
-            mod.item_tags.erase( the_mod );
+            mod.unset_flag( the_mod );
         }
         mod.update_clothing_mod_val();
 
@@ -4347,13 +4347,13 @@ int sew_advanced_actor::use( player &p, item &it, bool, const tripoint & ) const
         p.add_msg_if_player( m_mixed, _( "You modify your %s, but waste a lot of thread." ),
                              mod.tname() );
         p.consume_items( comps, 1, is_crafting_component );
-        mod.item_tags.insert( the_mod );
+        mod.set_flag( the_mod );
         mod.update_clothing_mod_val();
         return thread_needed;
     }
 
     p.add_msg_if_player( m_good, _( "You modify your %s!" ), mod.tname() );
-    mod.item_tags.insert( the_mod );
+    mod.set_flag( the_mod );
     mod.update_clothing_mod_val();
     p.consume_items( comps, 1, is_crafting_component );
     return thread_needed / 2;
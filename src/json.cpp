@@ -74,6 +74,36 @@ static std::string utf16_to_utf8( uint32_t ch )
     return out;
 }
 
+static double sci_notation_to_double( const number_sci_notation &n )
+{
+    return n.number * std::pow( 10.0f, n.exp ) * ( n.negative ? -1.f : 1.f );
+}
+
+// Returns false if the number is not an integer in the range of int, in which
+// case the caller should read it from the stream again to report the error.
+static bool sci_notation_to_int( number_sci_notation n, int &out )
+{
+    if( n.exp < 0 ) {
+        return false;
+    }
+    for( int64_t i = 0; i < n.exp; i++ ) {
+        if( n.number > static_cast<uint64_t>( std::numeric_limits<int>::max() ) ) {
+            return false;
+        }
+        n.number *= 10ULL;
+    }
+    if( n.number > static_cast<uint64_t>( std::numeric_limits<int>::max() ) + 1ULL ) {
+        return false;
+    }
+    const int64_t value = n.negative ? -static_cast<int64_t>( n.number ) :
+                          static_cast<int64_t>( n.number );
+    if( value > std::numeric_limits<int>::max() || value < std::numeric_limits<int>::min() ) {
+        return false;
+    }
+    out = static_cast<int>( value );
+    return true;
+}
+
 /* class JsonObject
  * represents a JSON object,
  * providing access to the underlying data.
@@ -82,27 +112,74 @@ JsonObject::JsonObject( JsonIn &j )
 {
     jsin = &j;
     start = jsin->tell();
-    // cache the position of the value for each member
+    // cache the position of the value for each member, and the value itself for scalars
     jsin->start_object();
     while( !jsin->end_object() ) {
-        std::string n = jsin->get_member_name();
-        int p = jsin->tell();
-        if( positions.count( n ) > 0 ) {
-            j.error( "duplicate entry in json object" );
+        // The name has to be read before the position of the value is taken.
+        const std::string name = jsin->get_member_name();
+        members.emplace_back( name, jsin->tell() );
+        member &m = members.back();
+        try {
+            if( jsin->test_bool() ) {
+                m.boolean = jsin->get_bool();
+                m.type = member::value_type::boolean;
+            } else if( jsin->test_number() && jsin->peek() != '+' && jsin->peek() != '.' ) {
+                m.number = jsin->get_any_number();
+                m.type = member::value_type::number;
+            } else {
+                jsin->skip_value();
+            }
+        } catch( const JsonError & ) {
+            // Malformed scalars are only reported when the member is actually read.
+            m.type = member::value_type::other;
+            jsin->seek( m.pos );
+            jsin->skip_value();
         }
-        positions[n] = p;
-        jsin->skip_value();
     }
     end_ = jsin->tell();
     final_separator = jsin->get_ate_separator();
+
+    std::sort( members.begin(), members.end(), []( const member & lhs, const member & rhs ) {
+        return lhs.name < rhs.name;
+    } );
+    member_index.reserve( members.size() );
+    for( size_t i = 0; i < members.size(); ++i ) {
+        if( i > 0 && members[i - 1].name == members[i].name ) {
+            jsin->seek( std::max( members[i - 1].pos, members[i].pos ) );
+            jsin->error( "duplicate entry in json object" );
+        }
+        member_index.emplace_back( members[i].hash, static_cast<int>( i ) );
+    }
+    std::sort( member_index.begin(), member_index.end() );
+}
+
+const JsonObject::member *JsonObject::find_member( const std::string &name ) const
+{
+    const size_t hash = std::hash<std::string>()( name );
+    for( auto iter = std::lower_bound( member_index.begin(), member_index.end(),
+                                       std::make_pair( hash, 0 ) );
+         iter != member_index.end() && iter->first == hash; ++iter ) {
+        const member &m = members[iter->second];
+        if( m.name == name ) {
+            return &m;
+        }
+    }
+    return nullptr;
 }
 
 void JsonObject::mark_visited( const std::string &name ) const
+{
+    if( const member *m = find_member( name ) ) {
+        mark_visited( *m );
+    }
+}
+
+void JsonObject::mark_visited( const member &m ) const
 {
 #ifndef CATA_IN_TOOL
-    visited_members.emplace( name );
+    m.visited = true;
 #else
-    static_cast<void>( name );
+    static_cast<void>( m );
 #endif
 }
 
@@ -112,10 +189,9 @@ void JsonObject::report_unvisited() const
     if( test_mode && report_unvisited_members && !reported_unvisited_members &&
         !std::uncaught_exception() ) {
         reported_unvisited_members = true;
-        for( const std::pair<const std::string, int> &p : positions ) {
-            const std::string &name = p.first;
-            if( !visited_members.count( name ) && !string_starts_with( name, "//" ) &&
-                name != "blueprint" ) {
+        for( const member &m : members ) {
+            const std::string &name = m.name;
+            if( !m.visited && !string_starts_with( name, "//" ) && name != "blueprint" ) {
                 try {
                     throw_error( string_format( "Failed to visit member %s in JsonObject", name ), name );
                 } catch( const JsonError &e ) {
@@ -138,11 +214,11 @@ void JsonObject::finish()
 
 size_t JsonObject::size() const
 {
-    return positions.size();
+    return members.size();
 }
 bool JsonObject::empty() const
 {
-    return positions.empty();
+    return members.empty();
 }
 
 void JsonObject::allow_omitted_members() const
@@ -152,6 +228,19 @@ void JsonObject::allow_omitted_members() const
 #endif
 }
 
+void JsonObject::copy_visited_members( const JsonObject &rhs ) const
+{
+#ifndef CATA_IN_TOOL
+    for( const member &m : rhs.members ) {
+        if( m.visited ) {
+            mark_visited( m.name );
+        }
+    }
+#else
+    static_cast<void>( rhs );
+#endif
+}
+
 int JsonObject::verify_position( const std::string &name,
                                  const bool throw_exception ) const
 {
@@ -163,8 +252,8 @@ int JsonObject::verify_position( const std::string &name,
         // so it will never indicate a valid member position
         return 0;
     }
-    const auto iter = positions.find( name );
-    if( iter == positions.end() ) {
+    const member *m = find_member( name );
+    if( !m ) {
         if( throw_exception ) {
             jsin->seek( start );
             jsin->error( "member not found: " + name );
@@ -173,12 +262,12 @@ int JsonObject::verify_position( const std::string &name,
         // so it will never indicate a valid member position
         return 0;
     }
-    return iter->second;
+    return m->pos;
 }
 
 bool JsonObject::has_member( const std::string &name ) const
 {
-    return positions.count( name ) > 0;
+    return find_member( name ) != nullptr;
 }
 
 std::string JsonObject::line_number() const
@@ -248,49 +337,75 @@ JsonIn *JsonObject::get_raw( const std::string &name ) const
 
 bool JsonObject::get_bool( const std::string &name ) const
 {
-    return get_member( name ).get_bool();
+    const member *m = find_member( name );
+    if( !m || m->type != member::value_type::boolean ) {
+        return get_member( name ).get_bool();
+    }
+    mark_visited( *m );
+    return m->boolean;
 }
 
 bool JsonObject::get_bool( const std::string &name, const bool fallback ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return fallback;
     }
-    mark_visited( name );
-    jsin->seek( pos );
+    mark_visited( *m );
+    if( m->type == member::value_type::boolean ) {
+        return m->boolean;
+    }
+    jsin->seek( m->pos );
     return jsin->get_bool();
 }
 
 int JsonObject::get_int( const std::string &name ) const
 {
-    return get_member( name ).get_int();
+    const member *m = find_member( name );
+    int value = 0;
+    if( !m || m->type != member::value_type::number || !sci_notation_to_int( m->number, value ) ) {
+        return get_member( name ).get_int();
+    }
+    mark_visited( *m );
+    return value;
 }
 
 int JsonObject::get_int( const std::string &name, const int fallback ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return fallback;
     }
-    mark_visited( name );
-    jsin->seek( pos );
+    mark_visited( *m );
+    int value = 0;
+    if( m->type == member::value_type::number && sci_notation_to_int( m->number, value ) ) {
+        return value;
+    }
+    jsin->seek( m->pos );
     return jsin->get_int();
 }
 
 double JsonObject::get_float( const std::string &name ) const
 {
-    return get_member( name ).get_float();
+    const member *m = find_member( name );
+    if( !m || m->type != member::value_type::number ) {
+        return get_member( name ).get_float();
+    }
+    mark_visited( *m );
+    return sci_notation_to_double( m->number );
 }
 
 double JsonObject::get_float( const std::string &name, const double fallback ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return fallback;
     }
-    mark_visited( name );
-    jsin->seek( pos );
+    mark_visited( *m );
+    if( m->type == member::value_type::number ) {
+        return sci_notation_to_double( m->number );
+    }
+    jsin->seek( m->pos );
     return jsin->get_float();
 }
 
@@ -301,12 +416,12 @@ std::string JsonObject::get_string( const std::string &name ) const
 
 std::string JsonObject::get_string( const std::string &name, const std::string &fallback ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return fallback;
     }
-    mark_visited( name );
-    jsin->seek( pos );
+    mark_visited( *m );
+    jsin->seek( m->pos );
     return jsin->get_string();
 }
 
@@ -314,12 +429,12 @@ std::string JsonObject::get_string( const std::string &name, const std::string &
 
 JsonArray JsonObject::get_array( const std::string &name ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return JsonArray();
     }
-    mark_visited( name );
-    jsin->seek( pos );
+    mark_visited( *m );
+    jsin->seek( m->pos );
     return JsonArray( *jsin );
 }
 
@@ -343,12 +458,12 @@ std::vector<std::string> JsonObject::get_string_array( const std::string &name )
 
 JsonObject JsonObject::get_object( const std::string &name ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return JsonObject();
     }
-    mark_visited( name );
-    jsin->seek( pos );
+    mark_visited( *m );
+    jsin->seek( m->pos );
     return jsin->get_object();
 }
 
@@ -356,62 +471,68 @@ JsonObject JsonObject::get_object( const std::string &name ) const
 
 bool JsonObject::has_null( const std::string &name ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return false;
     }
-    mark_visited( name );
-    jsin->seek( pos );
+    mark_visited( *m );
+    jsin->seek( m->pos );
     return jsin->test_null();
 }
 
 bool JsonObject::has_bool( const std::string &name ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return false;
     }
-    jsin->seek( pos );
+    if( m->type != member::value_type::other ) {
+        return m->type == member::value_type::boolean;
+    }
+    jsin->seek( m->pos );
     return jsin->test_bool();
 }
 
 bool JsonObject::has_number( const std::string &name ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return false;
     }
-    jsin->seek( pos );
+    if( m->type != member::value_type::other ) {
+        return m->type == member::value_type::number;
+    }
+    jsin->seek( m->pos );
     return jsin->test_number();
 }
 
 bool JsonObject::has_string( const std::string &name ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return false;
     }
-    jsin->seek( pos );
+    jsin->seek( m->pos );
     return jsin->test_string();
 }
 
 bool JsonObject::has_array( const std::string &name ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return false;
     }
-    jsin->seek( pos );
+    jsin->seek( m->pos );
     return jsin->test_array();
 }
 
 bool JsonObject::has_object( const std::string &name ) const
 {
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return false;
     }
-    jsin->seek( pos );
+    jsin->seek( m->pos );
     return jsin->test_object();
 }
 
@@ -1146,8 +1267,7 @@ uint64_t JsonIn::get_uint64()
 
 double JsonIn::get_float()
 {
-    number_sci_notation n = get_any_number();
-    return n.number * std::pow( 10.0f, n.exp ) * ( n.negative ? -1.f : 1.f );
+    return sci_notation_to_double( get_any_number() );
 }
 
 number_sci_notation JsonIn::get_any_number()
@@ -1933,10 +2053,10 @@ JsonIn &JsonValue::seek() const
 
 JsonValue JsonObject::get_member( const std::string &name ) const
 {
-    const auto iter = positions.find( name );
-    if( !jsin || iter == positions.end() ) {
+    const member *m = find_member( name );
+    if( !jsin || !m ) {
         throw_error( "requested non-existing member \"" + name + "\"" );
     }
-    mark_visited( name );
-    return JsonValue( *jsin, iter->second );
+    mark_visited( *m );
+    return JsonValue( *jsin, m->pos );
 }
@@ -6,6 +6,7 @@
 #include <bitset>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <set>
@@ -513,6 +514,9 @@ class JsonIn
         void rewind( int max_lines = -1, int max_chars = -1 );
         std::string substr( size_t pos, size_t len = std::string::npos );
     private:
+        // JsonObject parses scalar members while indexing them.
+        friend class JsonObject;
+
         // This should be used to get any and all numerical data types.
         number_sci_notation get_any_number();
         // Calls get_any_number() then applies operations common to all integer types.
@@ -734,7 +738,11 @@ class JsonOut
  * JsonObject maps member names to the byte offset of the paired value,
  * given an underlying JsonIn stream.
  *
- * It provides data by seeking the stream to the relevant position,
+ * The members are indexed in a single pass when the object is constructed,
+ * into a flat table keyed by the hash of the member name.
+ * Scalar values (numbers and booleans) are parsed during that pass,
+ * so get_int(), get_float() and get_bool() return them without touching the stream.
+ * Other data is provided by seeking the stream to the relevant position,
  * and calling the correct JsonIn method to read the value from the stream.
  *
  *
@@ -803,19 +811,45 @@ class JsonOut
 class JsonObject
 {
     private:
-        std::map<std::string, int> positions;
+        struct member {
+            enum class value_type : char {
+                other,
+                number,
+                boolean,
+            };
+
+            member( const std::string &name, const int pos ) :
+                hash( std::hash<std::string>()( name ) ), name( name ), pos( pos ) {}
+
+            size_t hash;
+            std::string name;
+            int pos;
+            // Scalar values are parsed while indexing the object.
+            value_type type = value_type::other;
+            bool boolean = false;
+            number_sci_notation number;
+#ifndef CATA_IN_TOOL
+            mutable bool visited = false;
+#endif
+        };
+        // Members in the order of their names, which is the iteration order.
+        std::vector<member> members;
+        // ( hash, index into members ) pairs, sorted by hash, for lookup by name.
+        std::vector<std::pair<size_t, int>> member_index;
         int start;
         int end_;
         bool final_separator;
 #ifndef CATA_IN_TOOL
-        mutable std::set<std::string> visited_members;
         mutable bool report_unvisited_members = true;
         mutable bool reported_unvisited_members = false;
 #endif
         void mark_visited( const std::string &name ) const;
+        void mark_visited( const member &m ) const;
         void report_unvisited() const;
 
         JsonIn *jsin;
+        // Returns nullptr if there is no such member.
+        const member *find_member( const std::string &name ) const;
         int verify_position( const std::string &name,
                              bool throw_exception = true ) const;
 
@@ -843,6 +877,8 @@ class JsonObject
         bool empty() const;
 
         void allow_omitted_members() const;
+        // Marks the members visited in rhs, a copy of this object, as visited here as well.
+        void copy_visited_members( const JsonObject &rhs ) const;
         bool has_member( const std::string &name ) const; // true iff named member exists
         std::string str() const; // copy object json as string
         [[noreturn]] void throw_error( const std::string &err ) const;
@@ -865,11 +901,12 @@ class JsonObject
 
         template<typename E, typename = typename std::enable_if<std::is_enum<E>::value>::type>
         E get_enum_value( const std::string &name, const E fallback ) const {
-            if( !has_member( name ) ) {
+            const member *m = find_member( name );
+            if( !m ) {
                 return fallback;
             }
-            mark_visited( name );
-            jsin->seek( verify_position( name ) );
+            mark_visited( *m );
+            jsin->seek( m->pos );
             return jsin->get_enum_value<E>();
         }
         template<typename E, typename = typename std::enable_if<std::is_enum<E>::value>::type>
@@ -914,12 +951,12 @@ class JsonObject
         // but the read fails.
         template <typename T>
         bool read( const std::string &name, T &t, bool throw_on_error = true ) const {
-            int pos = verify_position( name, false );
-            if( !pos ) {
+            const member *m = find_member( name );
+            if( !m ) {
                 return false;
             }
-            mark_visited( name );
-            jsin->seek( pos );
+            mark_visited( *m );
+            jsin->seek( m->pos );
             return jsin->read( t, throw_on_error );
         }
 
@@ -1243,7 +1280,7 @@ class JsonObject::const_iterator
 {
     private:
         const JsonObject &object_;
-        decltype( JsonObject::positions )::const_iterator iter_;
+        decltype( JsonObject::members )::const_iterator iter_;
 
     public:
         const_iterator( const JsonObject &object, const decltype( iter_ ) &iter ) : object_( object ),
@@ -1254,8 +1291,8 @@ class JsonObject::const_iterator
             return *this;
         }
         JsonMember operator*() const {
-            object_.mark_visited( iter_->first );
-            return JsonMember( iter_->first, JsonValue( *object_.jsin, iter_->second ) );
+            object_.mark_visited( *iter_ );
+            return JsonMember( iter_->name, JsonValue( *object_.jsin, iter_->pos ) );
         }
 
         friend bool operator==( const const_iterator &lhs, const const_iterator &rhs ) {
@@ -1268,12 +1305,12 @@ class JsonObject::const_iterator
 
 inline JsonObject::const_iterator JsonObject::begin() const
 {
-    return const_iterator( *this, positions.begin() );
+    return const_iterator( *this, members.begin() );
 }
 
 inline JsonObject::const_iterator JsonObject::end() const
 {
-    return const_iterator( *this, positions.end() );
+    return const_iterator( *this, members.end() );
 }
 
 template <typename T>
@@ -1301,12 +1338,12 @@ template <typename T>
 std::set<T> JsonObject::get_tags( const std::string &name ) const
 {
     std::set<T> res;
-    int pos = verify_position( name, false );
-    if( !pos ) {
+    const member *m = find_member( name );
+    if( !m ) {
         return res;
     }
-    mark_visited( name );
-    jsin->seek( pos );
+    mark_visited( *m );
+    jsin->seek( m->pos );
 
     // allow single string as tag
     if( jsin->test_string() ) {
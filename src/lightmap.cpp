@@ -27,6 +27,7 @@
 #include "npc.h"
 #include "optional.h"
 #include "point.h"
+#include "profiler.h"
 #include "shadowcasting.h" // IWYU pragma: associated
 #include "string_formatter.h"
 #include "string_id.h"
@@ -285,6 +286,7 @@ void map::build_sunlight_cache( int zlev )
 
 void map::generate_lightmap( const int zlev )
 {
+    CATA_PROFILE_ZONE( "lightmap" );
     auto &map_cache = get_cache( zlev );
     auto &lm = map_cache.lm;
     auto &sm = map_cache.sm;
@@ -1151,6 +1153,7 @@ castLightAll<fragment_cloud, fragment_cloud, shrapnel_calc, shrapnel_check,
  */
 void map::build_seen_cache( const tripoint &origin, const int target_z )
 {
+    CATA_PROFILE_ZONE( "shadowcasting" );
     auto &map_cache = get_cache( target_z );
     float ( &transparency_cache )[MAPSIZE_X][MAPSIZE_Y] = map_cache.vision_transparency_cache;
     float ( &seen_cache )[MAPSIZE_X][MAPSIZE_Y] = map_cache.seen_cache;
@@ -72,4 +72,3 @@ const std::list<typename lru_cache<Key, Value>::Pair> &lru_cache<Key, Value>::li
 // explicit template initialization for lru_cache of all types
 template class lru_cache<tripoint, memorized_terrain_tile>;
 template class lru_cache<tripoint, int>;
-template class lru_cache<point, char>;
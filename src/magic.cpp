@@ -14,6 +14,7 @@
 #include "character.h"
 #include "color.h"
 #include "compatibility.h"
+#include "crafting_inventory_view.h"
 #include "creature.h"
 #include "cursesdef.h"
 #include "damage.h"
@@ -706,7 +707,7 @@ bool spell::is_spell_class( const trait_id &mid ) const
 bool spell::can_cast( Character &guy ) const
 {
     if( !type->spell_components.is_empty() &&
-        !type->spell_components->can_make_with_inventory( guy.crafting_inventory( guy.pos(), 0 ),
+        !type->spell_components->can_make_with_inventory( guy.crafting_view( guy.pos(), 0 ),
                 return_true<item> ) ) {
         return false;
     }
@@ -761,7 +761,7 @@ void spell_effect::spawn_ethereal_item( const spell &sp, Creature &caster, const
         granted.set_flag( "ETHEREAL_ITEM" );
     }
     if( granted.count_by_charges() && sp.damage() > 0 ) {
-        granted.charges = sp.damage();
+        granted.set_charges( sp.damage() );
     }
     if( sp.has_flag( spell_flag::WITH_CONTAINER ) ) {
         granted = granted.in_its_container();
@@ -26,6 +26,7 @@
 #include "color.h"
 #include "construction.h"
 #include "coordinate_conversions.h"
+#include "crafting_inventory_view.h"
 #include "creature.h"
 #include "cuboid_rectangle.h"
 #include "cursesdef.h"
@@ -38,6 +39,7 @@
 #include "explosion.h"
 #include "field.h"
 #include "field_type.h"
+#include "flag.h"
 #include "flat_set.h"
 #include "fragment_cloud.h"
 #include "fungal_effects.h"
@@ -71,6 +73,7 @@
 #include "overmapbuffer.h"
 #include "pathfinding.h"
 #include "player.h"
+#include "profiler.h"
 #include "projectile.h"
 #include "relic.h"
 #include "ret_val.h"
@@ -119,6 +122,8 @@ static const mtype_id mon_zombie( "mon_zombie" );
 static const efftype_id effect_boomered( "boomered" );
 static const efftype_id effect_crushed( "crushed" );
 
+static const flag_id flag_EMITTER( "EMITTER" );
+
 #define dbg(x) DebugLog((x),D_MAP) << __FILE__ << ":" << __LINE__ << ": "
 
 static cata::colony<item> nulitems;          // Returned when &i_at() is asked for an OOB value
@@ -247,9 +252,12 @@ void map::add_vehicle_to_cache( vehicle *veh )
         const tripoint p = veh->global_part_pos3( vpr.part() );
         level_cache &ch = get_cache( p.z );
         ch.veh_in_active_range = true;
-        ch.veh_cached_parts[p] = std::make_pair( veh,  static_cast<int>( vpr.part_index() ) );
         if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = true;
+            if( !ch.veh_exists_at[p.x][p.y] ) {
+                ch.veh_exists_at[p.x][p.y] = true;
+                ch.veh_exists_count++;
+            }
+            ch.veh_cached_parts[p.x][p.y] = std::make_pair( veh, static_cast<int>( vpr.part_index() ) );
         }
     }
 }
@@ -261,28 +269,25 @@ void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint &pt )
         return;
     }
 
+    if( !inbounds( pt ) ) {
+        return;
+    }
     level_cache &ch = get_cache( pt.z );
-    if( inbounds( pt ) ) {
+    if( ch.veh_exists_at[pt.x][pt.y] ) {
         ch.veh_exists_at[pt.x][pt.y] = false;
+        ch.veh_exists_count--;
     }
-    auto it = ch.veh_cached_parts.find( pt );
-    if( it != ch.veh_cached_parts.end() && it->second.first == veh ) {
-        ch.veh_cached_parts.erase( it );
+    std::pair<vehicle *, int> &cached = ch.veh_cached_parts[pt.x][pt.y];
+    if( cached.first == veh ) {
+        cached = std::make_pair( nullptr, -1 );
     }
-
 }
 
 void map::clear_vehicle_cache( const int zlev )
 {
     level_cache &ch = get_cache( zlev );
-    while( !ch.veh_cached_parts.empty() ) {
-        const auto part = ch.veh_cached_parts.begin();
-        const auto &p = part->first;
-        if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = false;
-        }
-        ch.veh_cached_parts.erase( part );
-    }
+    std::fill_n( &ch.veh_exists_at[0][0], MAPSIZE_X * MAPSIZE_Y, false );
+    ch.veh_exists_count = 0;
     ch.veh_in_active_range = false;
 }
 
@@ -370,6 +375,7 @@ void map::on_vehicle_moved( const int smz )
 
 void map::vehmove()
 {
+    CATA_PROFILE_ZONE( "vehmove" );
     // give vehicles movement points
     VehicleList vehicle_list;
     int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
@@ -384,6 +390,10 @@ void map::vehmove()
             vehicle_list.push_back( w );
         }
     }
+    vehicles_to_move.clear();
+    for( const wrapped_vehicle &w : vehicle_list ) {
+        vehicles_to_move.push( *w.v );
+    }
 
     // 15 equals 3 >50mph vehicles, or up to 15 slow (1 square move) ones
     // But 15 is too low for V12 death-bikes, let's put 100 here
@@ -392,6 +402,7 @@ void map::vehmove()
             break;
         }
     }
+    vehicles_to_move.clear();
     // Process item removal on the vehicles that were modified this turn.
     // Use a copy because part_removal_cleanup can modify the container.
     auto temp = dirty_vehicle_list;
@@ -418,21 +429,14 @@ void map::vehmove()
 
 bool map::vehproceed( VehicleList &vehicle_list )
 {
-    wrapped_vehicle *cur_veh = nullptr;
-    float max_of_turn = 0.0f;
     // First horizontal movement
-    for( wrapped_vehicle &vehs_v : vehicle_list ) {
-        if( vehs_v.v->of_turn > max_of_turn ) {
-            cur_veh = &vehs_v;
-            max_of_turn = cur_veh->v->of_turn;
-        }
-    }
+    vehicle *cur_veh = vehicles_to_move.pop();
 
     // Then vertical-only movement
     if( cur_veh == nullptr ) {
         for( wrapped_vehicle &vehs_v : vehicle_list ) {
             if( vehs_v.v->is_falling || ( vehs_v.v->is_rotorcraft() && vehs_v.v->get_z_change() != 0 ) ) {
-                cur_veh = &vehs_v;
+                cur_veh = vehs_v.v;
                 break;
             }
         }
@@ -442,9 +446,15 @@ bool map::vehproceed( VehicleList &vehicle_list )
         return false;
     }
 
-    cur_veh->v = cur_veh->v->act_on_map();
-    if( cur_veh->v == nullptr ) {
+    cur_veh = cur_veh->act_on_map();
+    if( cur_veh == nullptr ) {
         vehicle_list = get_vehicles();
+        vehicles_to_move.clear();
+        for( const wrapped_vehicle &w : vehicle_list ) {
+            vehicles_to_move.push( *w.v );
+        }
+    } else {
+        vehicles_to_move.push( *cur_veh );
     }
 
     // confirm that veh_in_active_range is still correct for each z-level
@@ -452,20 +462,39 @@ bool map::vehproceed( VehicleList &vehicle_list )
     int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int zlev = minz; zlev <= maxz; ++zlev ) {
         level_cache &cache = get_cache( zlev );
-
-        // Check if any vehicles exist in the active range for this z-level
-        cache.veh_in_active_range = cache.veh_in_active_range &&
-                                    std::any_of( std::begin( cache.veh_exists_at ),
-        std::end( cache.veh_exists_at ), []( const auto & row ) {
-            return std::any_of( std::begin( row ), std::end( row ), []( bool veh_exists ) {
-                return veh_exists;
-            } );
-        } );
+        cache.veh_in_active_range = cache.veh_in_active_range && cache.veh_exists_count > 0;
     }
 
     return true;
 }
 
+void vehicle_move_queue::push( vehicle &veh )
+{
+    if( veh.of_turn > 0.0f ) {
+        queue.emplace( veh.of_turn, -pushed++, &veh );
+    }
+}
+
+vehicle *vehicle_move_queue::pop()
+{
+    while( !queue.empty() ) {
+        const std::tuple<float, int, vehicle *> top = queue.top();
+        queue.pop();
+        vehicle *veh = std::get<2>( top );
+        // Skip entries of vehicles whose of_turn changed since, they were pushed again
+        if( veh->of_turn == std::get<0>( top ) ) {
+            return veh;
+        }
+    }
+    return nullptr;
+}
+
+void vehicle_move_queue::clear()
+{
+    queue = std::priority_queue<std::tuple<float, int, vehicle *>>();
+    pushed = 0;
+}
+
 static bool sees_veh( const Creature &c, vehicle &veh, bool force_recalc )
 {
     const auto &veh_points = veh.get_points( force_recalc );
@@ -802,6 +831,7 @@ float map::vehicle_vehicle_collision( vehicle &veh, vehicle &veh2,
 
         veh.of_turn = avg_of_turn * 0.9f;
         veh2.of_turn = avg_of_turn * 1.1f;
+        vehicles_to_move.push( veh2 );
 
         //Energy after collision
         float E_a = 0.5 * m1 * final1.magnitude() * final1.magnitude() +
@@ -979,10 +1009,10 @@ const vehicle *map::veh_at_internal( const tripoint &p, int &part_num ) const
         return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
     }
 
-    const auto it = ch.veh_cached_parts.find( p );
-    if( it != ch.veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
+    const std::pair<vehicle *, int> &cached = ch.veh_cached_parts[p.x][p.y];
+    if( cached.first != nullptr ) {
+        part_num = cached.second;
+        return cached.first;
     }
 
     debugmsg( "vehicle part cache indicated vehicle not found: %d %d %d", p.x, p.y, p.z );
@@ -1132,6 +1162,11 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp, const bool adjust_
                        << dp.x << ", " << dp.y << ", " << dp.z << ")";
         return true;
     }
+    // Cables are found by the position of the vehicle they lead to. Both ends of a cable
+    // are parts of the vehicles it connects, so vehicles without cables are in no grid.
+    if( veh.has_power_cables() ) {
+        vehicle::invalidate_power_grids();
+    }
 
     Character &player_character = get_player_character();
     // Need old coordinates to check for remote control
@@ -1384,25 +1419,14 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture )
             c->remove_effect( effect_crushed );
         }
     }
-    if( new_t.has_flag( "EMITTER" ) ) {
+    if( new_t.has_flag( flag_EMITTER ) ) {
         field_furn_locs.push_back( p );
     }
-    if( old_t.transparent != new_t.transparent ) {
-        set_transparency_cache_dirty( p.z );
-    }
-
-    if( old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ) ) {
-        set_outside_cache_dirty( p.z );
-    }
-
-    if( old_t.has_flag( TFLAG_NO_FLOOR ) != new_t.has_flag( TFLAG_NO_FLOOR ) ) {
-        set_floor_cache_dirty( p.z );
-    }
+    terrain_caches_changed( p.z, old_t.transparent != new_t.transparent,
+                            old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ),
+                            old_t.has_flag( TFLAG_NO_FLOOR ) != new_t.has_flag( TFLAG_NO_FLOOR ) );
     set_memory_seen_cache_dirty( p );
 
-    // TODO: Limit to changes that affect move cost, traps and stairs
-    set_pathfinding_cache_dirty( p.z );
-
     // Make sure the furniture falls if it needs to
     support_dirty( p );
     tripoint above( p.xy(), p.z + 1 );
@@ -1693,24 +1717,16 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
         traplocs[new_t.trap.to_i()].push_back( p );
     }
 
-    if( old_t.transparent != new_t.transparent ) {
-        set_transparency_cache_dirty( p.z );
-    }
-
-    if( old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ) ) {
-        set_outside_cache_dirty( p.z );
-    }
-
-    if( new_t.has_flag( TFLAG_NO_FLOOR ) != old_t.has_flag( TFLAG_NO_FLOOR ) ) {
-        set_floor_cache_dirty( p.z );
+    const bool floor_changed = new_t.has_flag( TFLAG_NO_FLOOR ) != old_t.has_flag( TFLAG_NO_FLOOR );
+    terrain_caches_changed( p.z, old_t.transparent != new_t.transparent,
+                            old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ),
+                            floor_changed );
+    if( floor_changed ) {
         // It's a set, not a flag
         support_cache_dirty.insert( p );
     }
     set_memory_seen_cache_dirty( p );
 
-    // TODO: Limit to changes that affect move cost, traps and stairs
-    set_pathfinding_cache_dirty( p.z );
-
     tripoint above( p.xy(), p.z + 1 );
     // Make sure that if we supported something and no longer do so, it falls down
     support_dirty( above );
@@ -2304,7 +2320,8 @@ void map::process_falling()
 
 bool map::has_flag( const std::string &flag, const tripoint &p ) const
 {
-    return has_flag_ter_or_furn( flag, p ); // Does bound checking
+    const flag_id id = json_flag::lookup( flag );
+    return id != flag_id() && has_flag_ter_or_furn( id, p ); // Does bound checking
 }
 
 bool map::can_put_items( const tripoint &p ) const
@@ -2318,20 +2335,43 @@ bool map::can_put_items( const tripoint &p ) const
 
 bool map::can_put_items_ter_furn( const tripoint &p ) const
 {
-    return !has_flag( "NOITEM", p ) && !has_flag( "SEALED", p );
+    return !has_flag( TFLAG_NOITEM, p ) && !has_flag( TFLAG_SEALED, p );
 }
 
 bool map::has_flag_ter( const std::string &flag, const tripoint &p ) const
 {
-    return ter( p ).obj().has_flag( flag );
+    const flag_id id = json_flag::lookup( flag );
+    return id != flag_id() && has_flag_ter( id, p );
 }
 
 bool map::has_flag_furn( const std::string &flag, const tripoint &p ) const
 {
-    return furn( p ).obj().has_flag( flag );
+    const flag_id id = json_flag::lookup( flag );
+    return id != flag_id() && has_flag_furn( id, p );
 }
 
 bool map::has_flag_ter_or_furn( const std::string &flag, const tripoint &p ) const
+{
+    const flag_id id = json_flag::lookup( flag );
+    return id != flag_id() && has_flag_ter_or_furn( id, p );
+}
+
+bool map::has_flag( const flag_id &flag, const tripoint &p ) const
+{
+    return has_flag_ter_or_furn( flag, p ); // Does bound checking
+}
+
+bool map::has_flag_ter( const flag_id &flag, const tripoint &p ) const
+{
+    return ter( p ).obj().has_flag( flag );
+}
+
+bool map::has_flag_furn( const flag_id &flag, const tripoint &p ) const
+{
+    return furn( p ).obj().has_flag( flag );
+}
+
+bool map::has_flag_ter_or_furn( const flag_id &flag, const tripoint &p ) const
 {
     if( !inbounds( p ) ) {
         return false;
@@ -3019,7 +3059,7 @@ void map::smash_items( const tripoint &p, const int power, const std::string &ca
             while( ( damage_chance > material_factor ||
                      x_in_y( damage_chance, material_factor ) ) &&
                    i->charges > 0 ) {
-                i->charges--;
+                i->set_charges( i->charges - 1 );
                 damage_chance -= material_factor;
                 // We can't increment items_damaged directly because a single item can be damaged more than once
                 item_was_damaged = true;
@@ -3770,7 +3810,7 @@ void map::shoot( const tripoint &p, projectile &proj, const bool hit_items )
                         if( one_in( 3 ) && passable( pt ) ) {
                             int gas_amount = rng( 10, 100 );
                             item gas_spill( "gasoline", calendar::turn );
-                            gas_spill.charges = gas_amount;
+                            gas_spill.set_charges( gas_amount );
                             add_item_or_charges( pt, gas_spill );
                         }
                     }
@@ -4274,12 +4314,12 @@ void map::spawn_item( const tripoint &p, const itype_id &type_id,
     // spawn the item
     item new_item( type_id, birthday );
     if( one_in( 3 ) && new_item.has_flag( "VARSIZE" ) ) {
-        new_item.item_tags.insert( "FIT" );
+        new_item.set_flag( "FIT" );
     }
 
     if( charges && new_item.charges > 0 ) {
         //let's fail silently if we specify charges for an item that doesn't support it
-        new_item.charges = charges;
+        new_item.set_charges( charges );
     }
     new_item = new_item.in_its_container();
     if( ( new_item.made_of( phase_id::LIQUID ) && has_flag( "SWIMMABLE", p ) ) ||
@@ -4465,6 +4505,9 @@ item &map::add_item( const tripoint &p, item new_item )
         }
         current_submap->active_items.add( *new_pos, l );
     }
+    if( this == &get_map() ) {
+        crafting_inventory_view::on_map_item_added( p, *new_pos );
+    }
 
     return *new_pos;
 }
@@ -4592,7 +4635,7 @@ static void process_vehicle_items( vehicle &cur_veh, int part )
             const time_duration time_left = washing_time - n.age();
             static const std::string filthy( "FILTHY" );
             if( time_left <= 0_turns ) {
-                n.item_tags.erase( filthy );
+                n.unset_flag( filthy );
                 washing_machine_finished = true;
                 cur_veh.part( part ).enabled = false;
             } else if( calendar::once_every( 15_minutes ) ) {
@@ -4620,7 +4663,7 @@ static void process_vehicle_items( vehicle &cur_veh, int part )
             static const std::string no_sterile( "NO_STERILE" );
             if( time_left <= 0_turns ) {
                 if( !n.has_flag( "NO_PACKED" ) ) {
-                    n.item_tags.erase( no_sterile );
+                    n.unset_flag( no_sterile );
                 }
                 autoclave_finished = true;
                 cur_veh.part( part ).enabled = false;
@@ -4698,6 +4741,7 @@ std::vector<tripoint> map::check_submap_active_item_consistency()
 
 void map::process_items()
 {
+    CATA_PROFILE_ZONE( "process_items" );
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int gz = minz; gz <= maxz; ++gz ) {
@@ -4881,8 +4925,8 @@ bool map::could_see_items( const tripoint &p, const Creature &who ) const
 
 bool map::could_see_items( const tripoint &p, const tripoint &from ) const
 {
-    static const std::string container_string( "CONTAINER" );
-    const bool container = has_flag_ter_or_furn( container_string, p );
+    static const flag_id flag_CONTAINER( "CONTAINER" );
+    const bool container = has_flag_ter_or_furn( flag_CONTAINER, p );
     const bool sealed = has_flag_ter_or_furn( TFLAG_SEALED, p );
     if( sealed && container ) {
         // never see inside of sealed containers
@@ -4995,9 +5039,9 @@ static void use_charges_from_furn( const furn_t &f, const itype_id &type, int &q
                 ret.push_back( *current_item );
                 if( current_item->charges - quantity > 0 ) {
                     // Update the returned liquid amount to match the requested amount
-                    ret.back().charges = quantity;
+                    ret.back().set_charges( quantity );
                     // Update the liquid item in the world to contain the leftover liquid
-                    current_item->charges -= quantity;
+                    current_item->set_charges( current_item->charges - quantity );
                     // All the liquid needed was found, no other sources will be needed
                     quantity = 0;
                 } else {
@@ -5028,11 +5072,11 @@ static void use_charges_from_furn( const furn_t &f, const itype_id &type, int &q
             // The const itemructor limits the charges to the (type specific) maximum.
             // Setting it separately circumvents that it is synchronized with the code that creates
             // the pseudo item (and fills its charges) in inventory.cpp
-            furn_item.charges = iter->charges;
+            furn_item.set_charges( iter->charges );
             if( furn_item.use_charges( type, quantity, ret, p ) ) {
                 stack.erase( iter );
             } else {
-                iter->charges = furn_item.charges;
+                iter->set_charges( furn_item.charges );
             }
         }
     }
@@ -5054,7 +5098,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
         // Handle infinite map sources.
         item water = water_from( p );
         if( water.typeId() == type ) {
-            water.charges = quantity;
+            water.set_charges( quantity );
             ret.push_back( water );
             quantity = 0;
             return ret;
@@ -5109,7 +5153,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
 
             // TODO: add a sane birthday arg
             item tmp( type, 0 );
-            tmp.charges = kpart->vehicle().drain( ftype, quantity );
+            tmp.set_charges( kpart->vehicle().drain( ftype, quantity ) );
             // TODO: Handle water poison when crafting starts respecting it
             quantity -= tmp.charges;
             ret.push_back( tmp );
@@ -5129,7 +5173,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
             }
             // TODO: add a sane birthday arg
             item tmp( type, 0 );
-            tmp.charges = weldpart->vehicle().drain( ftype, quantity );
+            tmp.set_charges( weldpart->vehicle().drain( ftype, quantity ) );
             quantity -= tmp.charges;
             ret.push_back( tmp );
 
@@ -5153,7 +5197,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
 
             // TODO: add a sane birthday arg
             item tmp( type, 0 );
-            tmp.charges = craftpart->vehicle().drain( ftype, quantity );
+            tmp.set_charges( craftpart->vehicle().drain( ftype, quantity ) );
             quantity -= tmp.charges;
             ret.push_back( tmp );
 
@@ -5171,7 +5215,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
 
             // TODO: add a sane birthday arg
             item tmp( type, 0 );
-            tmp.charges = forgepart->vehicle().drain( ftype, quantity );
+            tmp.set_charges( forgepart->vehicle().drain( ftype, quantity ) );
             quantity -= tmp.charges;
             ret.push_back( tmp );
 
@@ -5189,7 +5233,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
 
             // TODO: add a sane birthday arg
             item tmp( type, 0 );
-            tmp.charges = kilnpart->vehicle().drain( ftype, quantity );
+            tmp.set_charges( kilnpart->vehicle().drain( ftype, quantity ) );
             quantity -= tmp.charges;
             ret.push_back( tmp );
 
@@ -5211,7 +5255,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
 
             // TODO: add a sane birthday arg
             item tmp( type, 0 );
-            tmp.charges = chempart->vehicle().drain( ftype, quantity );
+            tmp.set_charges( chempart->vehicle().drain( ftype, quantity ) );
             quantity -= tmp.charges;
             ret.push_back( tmp );
 
@@ -6286,15 +6330,9 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         bresenham_slope = 0;
         return false; // Out of range!
     }
-    // Cannonicalize the order of the tripoints so the cache is reflexive.
-    const tripoint &min = F < T ? F : T;
-    const tripoint &max = !( F < T ) ? F : T;
-    // A little gross, just pack the values into a point.
-    const point key(
-        min.x << 16 | min.y << 8 | ( min.z + OVERMAP_DEPTH ),
-        max.x << 16 | max.y << 8 | ( max.z + OVERMAP_DEPTH )
-    );
-    char cached = skew_vision_cache.get( key, -1 );
+    // The cache only covers pairs of points inside the bubble.
+    const bool cacheable = inbounds( F );
+    const int cached = cacheable ? skew_vision_cache.get( F, T ) : -1;
     if( cached >= 0 ) {
         return cached > 0;
     }
@@ -6314,7 +6352,9 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
             }
             return true;
         } );
-        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        if( cacheable ) {
+            skew_vision_cache.insert( F, T, visible );
+        }
         return visible;
     }
 
@@ -6347,7 +6387,9 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         last_point = new_point;
         return true;
     } );
-    skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+    if( cacheable ) {
+        skew_vision_cache.insert( F, T, visible );
+    }
     return visible;
 }
 
@@ -7289,7 +7331,7 @@ void map::produce_sap( const tripoint &p, const time_duration &time_since_last_a
 
                 // The environment might have poisoned the sap with animals passing by, insects, leaves or contaminants in the ground
                 sap.poison = one_in( 10 ) ? 1 : 0;
-                sap.charges = new_charges;
+                sap.set_charges( new_charges );
 
                 it.put_in( sap, item_pocket::pocket_type::CONTAINER );
             }
@@ -7383,7 +7425,7 @@ void map::actualize( const tripoint &grid )
             const tripoint pnt = sm_to_ms_copy( grid ) + point( x, y );
             const point p( x, y );
             const auto &furn = this->furn( pnt ).obj();
-            if( furn.has_flag( "EMITTER" ) ) {
+            if( furn.has_flag( flag_EMITTER ) ) {
                 field_furn_locs.push_back( pnt );
             }
 
@@ -8116,6 +8158,7 @@ void map::do_vehicle_caching( int z )
 
 void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
+    CATA_PROFILE_ZONE( "build_map_cache" );
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
@@ -8128,7 +8171,7 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     seen_cache_dirty |= build_vision_transparency_cache( zlev );
 
     if( seen_cache_dirty ) {
-        skew_vision_cache.clear();
+        skew_vision_cache.invalidate();
     }
     // Initial value is illegal player position.
     const tripoint &p = get_player_character().pos();
@@ -8136,9 +8179,11 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     if( seen_cache_dirty || player_prev_pos != p ) {
         build_seen_cache( p, zlev );
         player_prev_pos = p;
+        avatar::invalidate_visible_creatures();
     }
     if( !skip_lightmap ) {
         generate_lightmap( zlev );
+        avatar::invalidate_visible_creatures();
     }
 }
 
@@ -8264,6 +8309,86 @@ void map::draw_fill_background( const ter_id &type )
     }
 }
 
+void map::set_tiles_direct( const point &origin, const point &size,
+                            const std::vector<ter_furn_id> &tiles, const int turns )
+{
+    const int z = abs_sub.z;
+    bool transparency_changed = false;
+    bool outside_changed = false;
+    bool floor_changed = false;
+    bool any_changed = false;
+    for( int y = 0; y < size.y; y++ ) {
+        for( int x = 0; x < size.x; x++ ) {
+            const ter_furn_id &tile = tiles[y * size.x + x];
+            if( tile.ter == t_null && tile.furn == f_null ) {
+                continue;
+            }
+            const tripoint p( origin + point( x, y ).rotate( turns, size ), z );
+            if( !inbounds( p ) ) {
+                continue;
+            }
+            point l;
+            submap *const sm = get_submap_at( p, l );
+            if( sm == nullptr ) {
+                debugmsg( "Tried to set tiles at (%d,%d) but the submap is not loaded", l.x, l.y );
+                continue;
+            }
+            const ter_id old_ter = sm->get_ter( l );
+            if( tile.ter != t_null && tile.ter != old_ter ) {
+                sm->set_ter( l, tile.ter );
+                const ter_t &old_t = old_ter.obj();
+                const ter_t &new_t = tile.ter.obj();
+                // Same ledge hack as in ter_set
+                if( old_t.trap != tr_null && old_t.trap != tr_ledge ) {
+                    std::vector<tripoint> &traps = traplocs[old_t.trap.to_i()];
+                    const auto iter = std::find( traps.begin(), traps.end(), p );
+                    if( iter != traps.end() ) {
+                        traps.erase( iter );
+                    }
+                }
+                if( new_t.trap != tr_null && new_t.trap != tr_ledge ) {
+                    traplocs[new_t.trap.to_i()].push_back( p );
+                }
+                transparency_changed |= old_t.transparent != new_t.transparent;
+                outside_changed |= old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS );
+                if( old_t.has_flag( TFLAG_NO_FLOOR ) != new_t.has_flag( TFLAG_NO_FLOOR ) ) {
+                    floor_changed = true;
+                    support_cache_dirty.insert( p );
+                }
+                set_memory_seen_cache_dirty( p );
+                any_changed = true;
+            }
+            const furn_id old_furn = sm->get_furn( l );
+            if( tile.furn != f_null && tile.furn != old_furn ) {
+                sm->set_furn( l, tile.furn );
+                const furn_t &old_t = old_furn.obj();
+                const furn_t &new_t = tile.furn.obj();
+                if( new_t.has_flag( flag_EMITTER ) ) {
+                    field_furn_locs.push_back( p );
+                }
+                transparency_changed |= old_t.transparent != new_t.transparent;
+                outside_changed |= old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS );
+                floor_changed |= old_t.has_flag( TFLAG_NO_FLOOR ) != new_t.has_flag( TFLAG_NO_FLOOR );
+                set_memory_seen_cache_dirty( p );
+                any_changed = true;
+            }
+        }
+    }
+
+    if( transparency_changed ) {
+        set_transparency_cache_dirty( z );
+    }
+    if( outside_changed ) {
+        set_outside_cache_dirty( z );
+    }
+    if( floor_changed ) {
+        set_floor_cache_dirty( z );
+    }
+    if( any_changed ) {
+        set_pathfinding_cache_dirty( z );
+    }
+}
+
 void map::draw_fill_background( ter_id( *f )() )
 {
     draw_square_ter( f, point_zero, point( SEEX * my_MAPSIZE - 1, SEEY * my_MAPSIZE - 1 ) );
@@ -8348,7 +8473,7 @@ void map::add_corpse( const tripoint &p )
         body = item::make_corpse();
     } else {
         body = item::make_corpse( mon_zombie );
-        body.item_tags.insert( "REVIVE_SPECIAL" );
+        body.set_flag( "REVIVE_SPECIAL" );
     }
 
     put_items_from_loc( "default_zombie_clothes", p, 0 );
@@ -8665,6 +8790,8 @@ level_cache::level_cache()
     std::fill_n( &visibility_cache[0][0], map_dimensions, lit_level::DARK );
     veh_in_active_range = false;
     std::fill_n( &veh_exists_at[0][0], map_dimensions, false );
+    veh_exists_count = 0;
+    std::fill_n( &veh_cached_parts[0][0], map_dimensions, std::make_pair( nullptr, -1 ) );
     max_populated_zlev = OVERMAP_HEIGHT;
 }
 
@@ -8685,6 +8812,53 @@ void map::set_pathfinding_cache_dirty( const int zlev )
     if( inbounds_z( zlev ) ) {
         get_pathfinding_cache( zlev ).dirty = true;
     }
+    // What can be reached changed, so have crafting gather their map items again.
+    if( this == &get_map() ) {
+        crafting_inventory_view::invalidate_map_items();
+    }
+}
+
+void map::terrain_caches_changed( const int zlev, const bool transparency, const bool outside,
+                                  const bool floor )
+{
+    if( cache_invalidation_deferred && inbounds_z( zlev ) ) {
+        deferred_invalidation &pending = deferred_invalidations[zlev + OVERMAP_DEPTH];
+        pending.pathfinding = true;
+        pending.transparency |= transparency;
+        pending.outside |= outside;
+        pending.floor |= floor;
+        return;
+    }
+
+    cache_invalidation_count++;
+    if( transparency ) {
+        set_transparency_cache_dirty( zlev );
+    }
+    if( outside ) {
+        set_outside_cache_dirty( zlev );
+    }
+    if( floor ) {
+        set_floor_cache_dirty( zlev );
+    }
+    // TODO: Limit to changes that affect move cost, traps and stairs
+    set_pathfinding_cache_dirty( zlev );
+}
+
+void map::defer_cache_invalidation()
+{
+    cache_invalidation_deferred = true;
+}
+
+void map::flush_cache_invalidation()
+{
+    cache_invalidation_deferred = false;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        deferred_invalidation &pending = deferred_invalidations[z + OVERMAP_DEPTH];
+        if( pending.pathfinding ) {
+            terrain_caches_changed( z, pending.transparency, pending.outside, pending.floor );
+            pending = deferred_invalidation();
+        }
+    }
 }
 
 const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
@@ -11,6 +11,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <queue>
 #include <set>
 #include <string>
 #include <tuple>
@@ -28,11 +29,11 @@
 #include "item_stack.h"
 #include "lightmap.h"
 #include "line.h"
-#include "lru_cache.h"
 #include "mapdata.h"
 #include "point.h"
 #include "rng.h"
 #include "shadowcasting.h"
+#include "sight_cache.h"
 #include "string_id.h"
 #include "type_id.h"
 #include "units_fwd.h"
@@ -67,6 +68,7 @@ struct maptile;
 struct partial_con;
 struct rl_vec2d;
 struct spawn_data;
+struct ter_furn_id;
 struct trap;
 template<typename Tripoint>
 class tripoint_range;
@@ -88,6 +90,25 @@ struct wrapped_vehicle {
 };
 
 using VehicleList = std::vector<wrapped_vehicle>;
+
+/**
+ * The vehicles that still have some of their turn left, the one with the most of it first.
+ * A vehicle has to be pushed again whenever its of_turn changes, the entries queued before
+ * are skipped then.
+ */
+class vehicle_move_queue
+{
+    public:
+        void push( vehicle &veh );
+        /** Takes out the vehicle to move next, nullptr if there is none. */
+        vehicle *pop();
+        void clear();
+
+    private:
+        // of_turn when queued, the negated push count, so that ties go to the first pushed
+        std::priority_queue<std::tuple<float, int, vehicle *>> queue;
+        int pushed = 0;
+};
 using items_location = std::string;
 class map;
 
@@ -183,7 +204,10 @@ struct level_cache {
 
     bool veh_in_active_range;
     bool veh_exists_at[MAPSIZE_X][MAPSIZE_Y];
-    std::map< tripoint, std::pair<vehicle *, int> > veh_cached_parts;
+    /** The number of tiles set in veh_exists_at. */
+    int veh_exists_count;
+    /** Vehicle and part index at each tile, only valid where veh_exists_at is set. */
+    std::pair<vehicle *, int> veh_cached_parts[MAPSIZE_X][MAPSIZE_Y];
     std::set<vehicle *> vehicle_list;
     std::set<vehicle *> zone_vehicles;
 
@@ -253,6 +277,18 @@ class map
         void set_pathfinding_cache_dirty( int zlev );
         /*@}*/
 
+        /**
+         * While deferred, terrain and furniture changes only note which caches they touched,
+         * and those are marked dirty by @ref flush_cache_invalidation, once per z-level.
+         * Nothing may rebuild the caches in between.
+         */
+        void defer_cache_invalidation();
+        void flush_cache_invalidation();
+        /** How many times terrain or furniture changes marked the caches of a z-level dirty. */
+        int get_cache_invalidation_count() const {
+            return cache_invalidation_count;
+        }
+
         void set_memory_seen_cache_dirty( const tripoint &p ) {
             const int offset = p.x + p.y * MAPSIZE_Y;
             if( offset >= 0 && offset < MAPSIZE_X * MAPSIZE_Y ) {
@@ -568,6 +604,8 @@ class map
         void vehmove();
         // Selects a vehicle to move, returns false if no moving vehicles
         bool vehproceed( VehicleList &vehicle_list );
+        // The vehicles to move during vehmove, see vehproceed
+        vehicle_move_queue vehicles_to_move;
 
         // Vehicles
         VehicleList get_vehicles( const tripoint &start, const tripoint &end );
@@ -774,6 +812,27 @@ class map
         bool has_flag_ter_or_furn( const std::string &flag, const point &p ) const {
             return has_flag_ter_or_furn( flag, tripoint( p, abs_sub.z ) );
         }
+        // Same as the string versions, but with the flag id already resolved
+        // Checks terrain, furniture and vehicles
+        bool has_flag( const flag_id &flag, const tripoint &p ) const;
+        bool has_flag( const flag_id &flag, const point &p ) const {
+            return has_flag( flag, tripoint( p, abs_sub.z ) );
+        }
+        // Checks terrain
+        bool has_flag_ter( const flag_id &flag, const tripoint &p ) const;
+        bool has_flag_ter( const flag_id &flag, const point &p ) const {
+            return has_flag_ter( flag, tripoint( p, abs_sub.z ) );
+        }
+        // Checks furniture
+        bool has_flag_furn( const flag_id &flag, const tripoint &p ) const;
+        bool has_flag_furn( const flag_id &flag, const point &p ) const {
+            return has_flag_furn( flag, tripoint( p, abs_sub.z ) );
+        }
+        // Checks terrain or furniture
+        bool has_flag_ter_or_furn( const flag_id &flag, const tripoint &p ) const;
+        bool has_flag_ter_or_furn( const flag_id &flag, const point &p ) const {
+            return has_flag_ter_or_furn( flag, tripoint( p, abs_sub.z ) );
+        }
         // Fast "oh hai it's update_scent/lightmap/draw/monmove/self/etc again, what about this one" flag checking
         // Checks terrain, furniture and vehicles
         bool has_flag( ter_bitflags flag, const tripoint &p ) const;
@@ -898,6 +957,18 @@ class map
         void draw_fill_background( const ter_id &type );
         void draw_fill_background( ter_id( *f )() );
         void draw_fill_background( const weighted_int_list<ter_id> &f );
+        /**
+         * Writes a block of terrain and furniture straight into the submaps, for mapgen.
+         * @param tiles row-major block of @p size tiles, null ids leave the tile as it is.
+         * @param turns the block is rotated clockwise by that many quarter turns while it
+         * is written, so it ends up at @p origin as if it had been rotated beforehand.
+         * Unlike ter_set/furn_set this does the per tile bookkeeping only where it is still
+         * needed (trap and emitter locations) and sets the caches dirty once per call.
+         * Nothing is done about grabs, crushed creatures or support, so it must not be used
+         * on the map the player is on.
+         */
+        void set_tiles_direct( const point &origin, const point &size,
+                               const std::vector<ter_furn_id> &tiles, int turns = 0 );
 
         void draw_square_ter( const ter_id &type, const point &p1, const point &p2 );
         void draw_square_furn( const furn_id &type, const point &p1, const point &p2 );
@@ -1721,6 +1792,9 @@ class map
         // or can just return air because we bashed down an entire floor tile
         ter_id get_roof( const tripoint &p, bool allow_air );
 
+        /** Marks the caches a terrain or furniture change on z-level @p zlev touched as dirty. */
+        void terrain_caches_changed( int zlev, bool transparency, bool outside, bool floor );
+
     public:
         void process_items();
     private:
@@ -1773,6 +1847,17 @@ class map
         std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
 
         mutable std::array< std::unique_ptr<pathfinding_cache>, OVERMAP_LAYERS > pathfinding_caches;
+
+        /** Caches of a z-level to mark dirty once @ref flush_cache_invalidation is called. */
+        struct deferred_invalidation {
+            bool pathfinding = false;
+            bool transparency = false;
+            bool outside = false;
+            bool floor = false;
+        };
+        std::array<deferred_invalidation, OVERMAP_LAYERS> deferred_invalidations;
+        bool cache_invalidation_deferred = false;
+        int cache_invalidation_count = 0;
         /**
          * Set of submaps that contain active items in absolute coordinates.
          */
@@ -1781,7 +1866,7 @@ class map
         /**
          * Cache of coordinate pairs recently checked for visibility.
          */
-        mutable lru_cache<point, char> skew_vision_cache;
+        mutable sight_cache skew_vision_cache;
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
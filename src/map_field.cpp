@@ -49,6 +49,7 @@
 #include "overmapbuffer.h"
 #include "player.h"
 #include "point.h"
+#include "profiler.h"
 #include "rng.h"
 #include "scent_block.h"
 #include "scent_map.h"
@@ -142,6 +143,7 @@ int map::burn_body_part( player &u, field_entry &cur, body_part bp, const int sc
 
 bool map::process_fields()
 {
+    CATA_PROFILE_ZONE( "process_fields" );
     bool dirty_transparency_cache = false;
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
@@ -465,6 +465,7 @@ void load_terrain( const JsonObject &jo, const std::string &src )
 void map_data_common_t::set_flag( const std::string &flag )
 {
     flags.insert( flag );
+    flag_bits.set( flag_id( flag ) );
     const auto it = ter_bitflags_map.find( flag );
     if( it != ter_bitflags_map.end() ) {
         bitflags.set( it->second );
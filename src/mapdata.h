@@ -12,6 +12,7 @@
 
 #include "calendar.h"
 #include "color.h"
+#include "flag.h"
 #include "int_id.h"
 #include "string_id.h"
 #include "translations.h"
@@ -158,6 +159,9 @@ struct plant_data {
  * so much that strings produce a significant performance penalty. The following are equivalent:
  *  m->has_flag("FLAMMABLE");     //
  *  m->has_flag(TFLAG_FLAMMABLE); // ~ 20 x faster than the above, ( 2.5 x faster if the above uses static const std::string str_flammable("FLAMMABLE");
+ * Every string flag, including those only used by mods, is also interned as a flag_id when it is set,
+ * so m->has_flag( flag_id( "FLAMMABLE" ) ) is a single bit test as well once the id has been resolved,
+ * e.g. into a static const flag_id.
  * To add a new ter_bitflag, add below and add to ter_bitflags_map in mapdata.cpp
  * Order does not matter.
  */
@@ -245,6 +249,7 @@ struct map_data_common_t {
 
     private:
         std::set<std::string> flags;    // string flags which possibly refer to what's documented above.
+        flag_bitset flag_bits;          // all of the string flags, indexed by their interned flag_id
         std::bitset<NUM_TERFLAGS> bitflags; // bitfield of -certain- string flags which are heavily checked
 
     public:
@@ -292,7 +297,12 @@ struct map_data_common_t {
         }
 
         bool has_flag( const std::string &flag ) const {
-            return flags.count( flag ) > 0;
+            const flag_id id = json_flag::lookup( flag );
+        return id != flag_id() && has_flag( id );
+        }
+
+        bool has_flag( const flag_id &flag ) const {
+            return flag_bits.test( flag );
         }
 
         bool has_flag( const ter_bitflags flag ) const {
@@ -326,8 +336,8 @@ struct map_data_common_t {
         bool was_loaded = false;
 
         bool is_flammable() const {
-            return flags.count( "FLAMMABLE" ) > 0 || flags.count( "FLAMMABLE_ASH" ) > 0 ||
-                   flags.count( "FLAMMABLE_HARD" ) > 0;
+            return has_flag( TFLAG_FLAMMABLE ) || has_flag( TFLAG_FLAMMABLE_ASH ) ||
+                   has_flag( TFLAG_FLAMMABLE_HARD );
         }
 
         virtual void load( const JsonObject &jo, const std::string &src );
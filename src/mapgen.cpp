@@ -58,6 +58,7 @@
 #include "overmap.h"
 #include "overmapbuffer.h"
 #include "point.h"
+#include "profiler.h"
 #include "relic.h"
 #include "ret_val.h"
 #include "rng.h"
@@ -110,6 +111,7 @@ static void build_mine_room( room_type type, const point &p1, const point &p2, m
 // x%2 and y%2 must be 0!
 void map::generate( const tripoint &p, const time_point &when )
 {
+    CATA_PROFILE_ZONE( "mapgen" );
     dbg( D_INFO ) << "map::generate( g[" << g.get() << "], p[" << p << "], "
                   "when[" << to_string( when ) << "] )";
 
@@ -280,6 +282,12 @@ class mapgen_basic_container
                 mapgen_function_ptr->check( key );
             }
         }
+        /// @see mapgen_function::compile
+        void compile() {
+            for( weighted_object<int, std::shared_ptr<mapgen_function>> &elem : weights_ ) {
+                elem.obj->compile();
+            }
+        }
 };
 
 class mapgen_factory
@@ -330,6 +338,12 @@ class mapgen_factory
                 }
             }
         }
+        /// @see mapgen_basic_container::compile
+        void compile() {
+            for( std::pair<const std::string, mapgen_basic_container> &omw : mapgens_ ) {
+                omw.second.compile();
+            }
+        }
         /**
          * Checks whether we have an entry for the given key.
          * Note that the entry itself may not contain any valid mapgen instance
@@ -360,6 +374,10 @@ static mapgen_factory oter_mapgen;
 std::map<std::string, weighted_int_list<std::shared_ptr<mapgen_function_json_nested>> >
         nested_mapgen;
 std::map<std::string, std::vector<std::unique_ptr<update_mapgen_function_json>> > update_mapgen;
+/** The update_mapgen given inline in missions, compiled along with the ones above. */
+static std::vector<std::shared_ptr<update_mapgen_function_json>> inline_update_mapgen;
+/** Whether @ref compile_mapgen ran, inline update_mapgen loaded later are compiled right away. */
+static bool mapgen_compiled = false;
 
 /*
  * setup mapgen_basic_container::weights_ which mapgen uses to diceroll. Also setup mapgen_function_json
@@ -381,6 +399,25 @@ void calculate_mapgen_weights()   // TODO: rename as it runs jsonfunction setup
 
 }
 
+void compile_mapgen()
+{
+    oter_mapgen.compile();
+    for( auto &pr : nested_mapgen ) {
+        for( weighted_object<int, std::shared_ptr<mapgen_function_json_nested>> &ptr : pr.second ) {
+            ptr.obj->compile();
+        }
+    }
+    for( auto &pr : update_mapgen ) {
+        for( auto &ptr : pr.second ) {
+            ptr->compile();
+        }
+    }
+    for( const std::shared_ptr<update_mapgen_function_json> &ptr : inline_update_mapgen ) {
+        ptr->compile();
+    }
+    mapgen_compiled = true;
+}
+
 void check_mapgen_definitions()
 {
     oter_mapgen.check_consistency();
@@ -539,6 +576,8 @@ void reset_mapgens()
     oter_mapgen.reset();
     nested_mapgen.clear();
     update_mapgen.clear();
+    inline_update_mapgen.clear();
+    mapgen_compiled = false;
 }
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -817,6 +856,11 @@ class jmapgen_alternativly : public jmapgen_piece
         // PieceType, they *can not* be of any other type.
         std::vector<PieceType> alternatives;
         jmapgen_alternativly() = default;
+        void compile() override {
+            for( PieceType &alternative : alternatives ) {
+                alternative.compile();
+            }
+        }
         void apply( mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y ) const override {
             if( const auto chosen = random_entry_opt( alternatives ) ) {
                 chosen->get().apply( dat, x, y );
@@ -1119,7 +1163,7 @@ class jmapgen_liquid_item : public jmapgen_piece
             if( one_in( chance.get() ) ) {
                 item newliquid( liquid, calendar::start_of_cataclysm );
                 if( amount.valmax > 0 ) {
-                    newliquid.charges = amount.get();
+                    newliquid.set_charges( amount.get() );
                 }
                 dat.m.add_item_or_charges( tripoint( x.get(), y.get(), dat.m.get_abs_sub().z ), newliquid );
             }
@@ -1205,6 +1249,8 @@ class jmapgen_loot : public jmapgen_piece
 class jmapgen_monster_group : public jmapgen_piece
 {
     public:
+        // Not resolved by compile: monster groups are looked up by id in a map, and
+        // place_spawns takes the id.
         mongroup_id id;
         float density;
         jmapgen_int chance;
@@ -1475,16 +1521,24 @@ class jmapgen_terrain : public jmapgen_piece
 {
     public:
         ter_id id;
+        /** Flags of the terrain, resolved by @ref compile */
+        bool is_wall = false;
+        bool keeps_items = false;
         jmapgen_terrain( const JsonObject &jsi ) : jmapgen_terrain( jsi.get_string( "ter" ) ) {}
         jmapgen_terrain( const std::string &tid ) : id( ter_id( tid ) ) {}
+        void compile() override {
+            is_wall = id->has_flag( "WALL" );
+            keeps_items = id->has_flag( "PLACE_ITEM" );
+        }
         void apply( mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y ) const override {
-            dat.m.ter_set( point( x.get(), y.get() ), id );
+            const point p( x.get(), y.get() );
+            dat.m.ter_set( p, id );
             // Delete furniture if a wall was just placed over it. TODO: need to do anything for fluid, monsters?
-            if( dat.m.has_flag_ter( "WALL", point( x.get(), y.get() ) ) ) {
-                dat.m.furn_set( point( x.get(), y.get() ), f_null );
+            if( is_wall && dat.m.inbounds( p ) ) {
+                dat.m.furn_set( p, f_null );
                 // and items, unless the wall has PLACE_ITEM flag indicating it stores things.
-                if( !dat.m.has_flag_ter( "PLACE_ITEM", point( x.get(), y.get() ) ) ) {
-                    dat.m.i_clear( tripoint( x.get(), y.get(), dat.m.get_abs_sub().z ) );
+                if( !keeps_items ) {
+                    dat.m.i_clear( tripoint( p, dat.m.get_abs_sub().z ) );
                 }
             }
         }
@@ -1816,6 +1870,24 @@ class jmapgen_nested : public jmapgen_piece
                 }
         };
 
+        using nested_list = weighted_int_list<std::shared_ptr<mapgen_function_json_nested>>;
+        /** A chunk id and its entry in @ref nested_mapgen, nullptr if there is none */
+        using resolved_chunk = std::pair<const std::string *, const nested_list *>;
+
+        /** The entries with the same weights, but their ids looked up already */
+        weighted_int_list<resolved_chunk> resolved_entries;
+        weighted_int_list<resolved_chunk> resolved_else_entries;
+
+        static void resolve( const weighted_int_list<std::string> &list,
+                             weighted_int_list<resolved_chunk> &resolved ) {
+            resolved.clear();
+            for( const weighted_object<int, std::string> &entry : list ) {
+                const auto iter = nested_mapgen.find( entry.obj );
+                const nested_list *chunks = iter == nested_mapgen.end() ? nullptr : &iter->second;
+                resolved.add( resolved_chunk( &entry.obj, chunks ), entry.weight );
+            }
+        }
+
     public:
         weighted_int_list<std::string> entries;
         weighted_int_list<std::string> else_entries;
@@ -1824,21 +1896,25 @@ class jmapgen_nested : public jmapgen_piece
             load_weighted_entries( jsi, "chunks", entries );
             load_weighted_entries( jsi, "else_chunks", else_entries );
         }
+        void compile() override {
+            resolve( entries, resolved_entries );
+            resolve( else_entries, resolved_else_entries );
+        }
         void apply( mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y ) const override {
-            const std::string *res = neighbors.test( dat ) ? entries.pick() : else_entries.pick();
-            if( res == nullptr || res->empty() || *res == "null" ) {
+            const resolved_chunk *res = neighbors.test( dat ) ? resolved_entries.pick() :
+                                        resolved_else_entries.pick();
+            if( res == nullptr || res->first->empty() || *res->first == "null" ) {
                 // This will be common when neighbors.test(...) is false, since else_entires is often empty.
                 return;
             }
 
-            const auto iter = nested_mapgen.find( *res );
-            if( iter == nested_mapgen.end() ) {
-                debugmsg( "Unknown nested mapgen function id %s", res->c_str() );
+            if( res->second == nullptr ) {
+                debugmsg( "Unknown nested mapgen function id %s", res->first->c_str() );
                 return;
             }
 
             // A second roll? Let's allow it for now
-            const auto &ptr = iter->second.pick();
+            const auto &ptr = res->second->pick();
             if( ptr == nullptr ) {
                 return;
             }
@@ -1882,9 +1958,9 @@ bool jmapgen_objects::check_bounds( const jmapgen_place &place, const JsonObject
 }
 
 void jmapgen_objects::add( const jmapgen_place &place,
-                           const shared_ptr_fast<const jmapgen_piece> &piece )
+                           const shared_ptr_fast<jmapgen_piece> &piece )
 {
-    objects.emplace_back( place, piece );
+    objects.push_back( { place, piece, place.repeat, piece->repeat } );
 }
 
 template<typename PieceType>
@@ -2469,6 +2545,21 @@ void mapgen_function_json_nested::check( const std::string &oter_name ) const
     check_common( oter_name );
 }
 
+void mapgen_function_json::compile()
+{
+    compile_common();
+}
+
+void mapgen_function_json_nested::compile()
+{
+    compile_common();
+}
+
+void mapgen_function_json_base::compile_common()
+{
+    objects.compile();
+}
+
 void mapgen_function_json_base::check_common( const std::string &oter_name ) const
 {
     auto check_furn = [&]( const furn_id & id ) {
@@ -2508,7 +2599,31 @@ void mapgen_function_json_base::check_common( const std::string &oter_name ) con
 void jmapgen_objects::check( const std::string &oter_name ) const
 {
     for( const jmapgen_obj &obj : objects ) {
-        obj.second->check( oter_name );
+        obj.what->check( oter_name );
+    }
+}
+
+void jmapgen_objects::compile()
+{
+    const auto is_fixed = []( const jmapgen_int & i ) {
+        return i.val == i.valmax;
+    };
+    for( jmapgen_obj &obj : objects ) {
+        const jmapgen_int &where_repeat = obj.where.repeat;
+        const jmapgen_int &what_repeat = obj.what->repeat;
+        obj.repeat = where_repeat;
+        obj.what_repeat = cata::nullopt;
+        // Fixed repeats don't roll, so merging them keeps the random sequence as it was.
+        if( is_fixed( where_repeat ) && is_fixed( what_repeat ) ) {
+            obj.repeat = jmapgen_int( std::max( where_repeat.val, what_repeat.val ) );
+        } else if( is_fixed( where_repeat ) && where_repeat.val <= what_repeat.val ) {
+            obj.repeat = what_repeat;
+        } else if( !is_fixed( what_repeat ) || what_repeat.val > where_repeat.val ) {
+            // A fixed repeat of the piece that can never win is left out.
+            obj.what_repeat = what_repeat;
+        }
+        // Pieces from palettes are shared between mapgens, compiling them again is harmless.
+        obj.what->compile();
     }
 }
 
@@ -2725,6 +2840,22 @@ void mapgen_function_json::generate( mapgendata &md )
     if( fill_ter != t_null ) {
         m->draw_fill_background( fill_ter );
     }
+    // The explicit rotation of the mapgen and the one of the overmap terrain, applied in one go.
+    int turns = rotation.get();
+    if( md.terrain_type()->is_rotatable() ) {
+        turns += static_cast<int>( md.terrain_type()->get_dir() );
+    }
+    turns %= 4;
+    if( predecessor_mapgen == oter_str_id::NULL_ID() && setmap_points.empty() &&
+        objects.empty() ) {
+        // Nothing but the format: write it rotated already instead of rotating the whole
+        // map afterwards.
+        if( do_format ) {
+            m->set_tiles_direct( point_zero, mapgensize, format, turns );
+        }
+        resolve_regional_terrain_and_furniture( md );
+        return;
+    }
     if( predecessor_mapgen != oter_str_id::NULL_ID() ) {
         mapgendata predecessor_mapgen_dat( md, predecessor_mapgen );
         run_mapgen_func( predecessor_mapgen.id().str(), predecessor_mapgen_dat );
@@ -2737,14 +2868,10 @@ void mapgen_function_json::generate( mapgendata &md )
         // when we apply that rotation, our predecessor is back in its original state while this
         // location is rotated as desired.
 
-        m->rotate( ( -rotation.get() + 4 ) % 4 );
-
-        if( md.terrain_type()->is_rotatable() ) {
-            m->rotate( ( -static_cast<int>( md.terrain_type()->get_dir() ) + 4 ) % 4 );
-        }
+        m->rotate( ( 4 - turns ) % 4 );
     }
     if( do_format ) {
-        formatted_set_incredibly_simple( *m, point_zero );
+        m->set_tiles_direct( point_zero, mapgensize, format );
     }
     for( auto &elem : setmap_points ) {
         elem.apply( md, point_zero );
@@ -2754,11 +2881,7 @@ void mapgen_function_json::generate( mapgendata &md )
 
     resolve_regional_terrain_and_furniture( md );
 
-    m->rotate( rotation.get() );
-
-    if( md.terrain_type()->is_rotatable() ) {
-        mapgen_rotate( m, md.terrain_type(), false );
-    }
+    m->rotate( turns );
 }
 
 void mapgen_function_json_nested::nest( mapgendata &dat, const point &offset ) const
@@ -2785,13 +2908,13 @@ void mapgen_function_json_nested::nest( mapgendata &dat, const point &offset ) c
 void jmapgen_objects::apply( mapgendata &dat ) const
 {
     for( const jmapgen_obj &obj : objects ) {
-        const auto &where = obj.first;
-        const auto &what = *obj.second;
+        const jmapgen_place &where = obj.where;
         // The user will only specify repeat once in JSON, but it may get loaded both
         // into the what and where in some cases--we just need the greater value of the two.
-        const int repeat = std::max( where.repeat.get(), what.repeat.get() );
+        const int repeat = obj.what_repeat ? std::max( obj.repeat.get(), obj.what_repeat->get() ) :
+                           obj.repeat.get();
         for( int i = 0; i < repeat; i++ ) {
-            what.apply( dat, where.x, where.y );
+            obj.what->apply( dat, where.x, where.y );
         }
     }
 }
@@ -2805,15 +2928,15 @@ void jmapgen_objects::apply( mapgendata &dat, const point &offset ) const
     }
 
     for( const jmapgen_obj &obj : objects ) {
-        jmapgen_place where = obj.first;
+        jmapgen_place where = obj.where;
         where.offset( -offset );
 
-        const jmapgen_piece &what = *obj.second;
         // The user will only specify repeat once in JSON, but it may get loaded both
         // into the what and where in some cases--we just need the greater value of the two.
-        const int repeat = std::max( where.repeat.get(), what.repeat.get() );
+        const int repeat = obj.what_repeat ? std::max( obj.repeat.get(), obj.what_repeat->get() ) :
+                           obj.repeat.get();
         for( int i = 0; i < repeat; i++ ) {
-            what.apply( dat, where.x, where.y );
+            obj.what->apply( dat, where.x, where.y );
         }
     }
 }
@@ -2821,9 +2944,9 @@ void jmapgen_objects::apply( mapgendata &dat, const point &offset ) const
 bool jmapgen_objects::has_vehicle_collision( mapgendata &dat, const point &offset ) const
 {
     for( const jmapgen_obj &obj : objects ) {
-        auto where = obj.first;
+        auto where = obj.where;
         where.offset( -offset );
-        const auto &what = *obj.second;
+        const auto &what = *obj.what;
         if( what.has_vehicle_collision( dat, point( where.x.get(), where.y.get() ) ) ) {
             return true;
         }
@@ -4091,7 +4214,7 @@ void map::draw_lab( mapgendata &dat )
                                     "mininuke", 1, 1, 0, rng( 2, 4 ) );
                     } else {
                         item newliquid( "plut_slurry_dense", calendar::start_of_cataclysm );
-                        newliquid.charges = 1;
+                        newliquid.set_charges( 1 );
                         add_item_or_charges( tripoint( marker_x, marker_y, get_abs_sub().z ),
                                              newliquid );
                     }
@@ -5649,7 +5772,7 @@ void map::place_spawns( const mongroup_id &group, const int chance,
 void map::place_gas_pump( const point &p, int charges, const std::string &fuel_type )
 {
     item fuel( fuel_type, 0 );
-    fuel.charges = charges;
+    fuel.set_charges( charges );
     add_item( p, fuel );
     ter_set( p, ter_id( fuel.fuel_pump_terrain() ) );
 }
@@ -5657,7 +5780,7 @@ void map::place_gas_pump( const point &p, int charges, const std::string &fuel_t
 void map::place_toilet( const point &p, int charges )
 {
     item water( "water", 0 );
-    water.charges = charges;
+    water.set_charges( charges );
     add_item( p, water );
     furn_set( p, f_toilet );
 }
@@ -6947,6 +7070,11 @@ void update_mapgen_function_json::check( const std::string &oter_name ) const
     check_common( oter_name );
 }
 
+void update_mapgen_function_json::compile()
+{
+    compile_common();
+}
+
 bool update_mapgen_function_json::setup_update( const JsonObject &jo )
 {
     return setup_common( jo );
@@ -7031,18 +7159,27 @@ mapgen_update_func add_mapgen_update_func( const JsonObject &jo, bool &defer )
         return update_function;
     }
 
-    update_mapgen_function_json json_data( "" );
+    std::shared_ptr<update_mapgen_function_json> json_data =
+        std::make_shared<update_mapgen_function_json>( "" );
     mapgen_defer::defer = defer;
-    if( !json_data.setup_update( jo ) ) {
+    if( !json_data->setup_update( jo ) ) {
         const auto null_function = []( const tripoint_abs_omt &, mission * ) {
         };
         return null_function;
     }
     const auto update_function = [json_data]( const tripoint_abs_omt & omt_pos, mission * miss ) {
-        json_data.update_map( omt_pos, point_zero, miss );
+        json_data->update_map( omt_pos, point_zero, miss );
     };
     defer = mapgen_defer::defer;
     mapgen_defer::jsi = JsonObject();
+    if( !defer ) {
+        // The nested chunks and terrain it refers to may not be loaded yet.
+        if( mapgen_compiled ) {
+            json_data->compile();
+        } else {
+            inline_update_mapgen.push_back( json_data );
+        }
+    }
     return update_function;
 }
 
@@ -12,6 +12,7 @@
 
 #include "coordinates.h"
 #include "memory_fast.h"
+#include "optional.h"
 #include "point.h"
 #include "regional_settings.h"
 #include "type_id.h"
@@ -40,6 +41,8 @@ class mapgen_function
         virtual ~mapgen_function() = default;
         virtual void setup() { } // throws
         virtual void check( const std::string & /*oter_name*/ ) const { }
+        /** Resolves what can be resolved once all game data is loaded, see @ref compile_mapgen */
+        virtual void compile() { }
         virtual void generate( mapgendata & ) = 0;
 };
 
@@ -160,6 +163,11 @@ class jmapgen_piece
     public:
         /** Sanity-check this piece */
         virtual void check( const std::string &/*oter_name*/ ) const { }
+        /**
+         * Resolves references to other game data once all of it is loaded, so that
+         * @ref apply doesn't have to look them up each time.
+         */
+        virtual void compile() { }
         /** Place something on the map from mapgendata &dat, at (x,y). */
         virtual void apply( mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y ) const = 0;
         virtual ~jmapgen_piece() = default;
@@ -222,7 +230,7 @@ class mapgen_palette
          * out of the json "bitmap" (which is used to paint the terrain/furniture).
          */
         using placing_map =
-            std::unordered_map<map_key, std::vector< shared_ptr_fast<const jmapgen_piece>>>;
+            std::unordered_map<map_key, std::vector< shared_ptr_fast<jmapgen_piece>>>;
 
         std::unordered_map<map_key, ter_id> format_terrain;
         std::unordered_map<map_key, furn_id> format_furniture;
@@ -268,7 +276,7 @@ struct jmapgen_objects {
 
         bool check_bounds( const jmapgen_place &place, const JsonObject &jso );
 
-        void add( const jmapgen_place &place, const shared_ptr_fast<const jmapgen_piece> &piece );
+        void add( const jmapgen_place &place, const shared_ptr_fast<jmapgen_piece> &piece );
 
         /**
          * PieceType must be inheriting from jmapgen_piece. It must have constructor that accepts a
@@ -286,6 +294,12 @@ struct jmapgen_objects {
         void load_objects( const JsonObject &jsi, const std::string &member_name );
 
         void check( const std::string &oter_name ) const;
+        /** Works out how often each object is applied and compiles the pieces. */
+        void compile();
+
+        bool empty() const {
+            return objects.empty();
+        }
 
         void apply( mapgendata &dat ) const;
         void apply( mapgendata &dat, const point &offset ) const;
@@ -298,9 +312,17 @@ struct jmapgen_objects {
 
     private:
         /**
-         * Combination of where to place something and what to place.
+         * Combination of where to place something and what to place. @ref compile merges the
+         * repeat of the piece into @ref repeat if that doesn't change the result, otherwise it
+         * is rolled separately.
          */
-        using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
+        struct jmapgen_obj {
+            jmapgen_place where;
+            shared_ptr_fast<jmapgen_piece> what;
+            /** Used instead of the repeat of @ref where. */
+            jmapgen_int repeat;
+            cata::optional<jmapgen_int> what_repeat;
+        };
         std::vector<jmapgen_obj> objects;
         point m_offset;
         point mapgensize;
@@ -328,6 +350,7 @@ class mapgen_function_json_base
         virtual void setup_setmap_internal() { }
 
         void check_common( const std::string &oter_name ) const;
+        void compile_common();
 
         void formatted_set_incredibly_simple( map &m, const point &offset ) const;
 
@@ -347,6 +370,7 @@ class mapgen_function_json : public mapgen_function_json_base, public virtual ma
     public:
         void setup() override;
         void check( const std::string &oter_name ) const override;
+        void compile() override;
         void generate( mapgendata & ) override;
         mapgen_function_json( const std::string &s, int w,
                               const point &grid_offset = point_zero );
@@ -371,6 +395,7 @@ class update_mapgen_function_json : public mapgen_function_json_base
         void setup();
         bool setup_update( const JsonObject &jo );
         void check( const std::string &oter_name ) const;
+        void compile();
         bool update_map( const tripoint_abs_omt &omt_pos, const point &offset,
                          mission *miss, bool verify = false ) const;
         bool update_map( mapgendata &md, const point &offset = point_zero,
@@ -386,6 +411,7 @@ class mapgen_function_json_nested : public mapgen_function_json_base
     public:
         void setup();
         void check( const std::string &oter_name ) const;
+        void compile();
         mapgen_function_json_nested( const std::string &s );
         ~mapgen_function_json_nested() override = default;
 
@@ -425,6 +451,11 @@ bool has_mapgen_for( const std::string &key );
  * Sets the above after init, and initializes mapgen_function_json instances as well
  */
 void calculate_mapgen_weights(); // throws
+/**
+ * Resolves the ids the json mapgen functions refer to, after all game data has been loaded
+ * and finalized. Must run after @ref calculate_mapgen_weights.
+ */
+void compile_mapgen();
 
 void check_mapgen_definitions();
 
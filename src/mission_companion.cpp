@@ -1169,7 +1169,7 @@ void talk_function::field_harvest( npc &p, const std::string &place )
         player_character.cash += ( number_plants * tmp.price( true ) - number_plots * 2 ) / 100;
     } else {
         if( tmp.count_by_charges() ) {
-            tmp.charges = 1;
+            tmp.set_charges( 1 );
         }
         for( int i = 0; i < number_plants; ++i ) {
             //Should be dropped at your feet once greedy companions can be controlled
@@ -1181,7 +1181,7 @@ void talk_function::field_harvest( npc &p, const std::string &place )
     const islot_seed &seed_data = *tmp.type->seed;
     if( seed_data.spawn_seeds ) {
         if( tmp.count_by_charges() ) {
-            tmp.charges = 1;
+            tmp.set_charges( 1 );
         }
         for( int i = 0; i < number_seeds; ++i ) {
             player_character.i_add( tmp );
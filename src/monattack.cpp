@@ -4765,7 +4765,7 @@ bool mattack::riotbot( monster *z )
             z->anger = 0;
 
             item handcuffs( "e_handcuffs", 0 );
-            handcuffs.charges = handcuffs.type->maximum_charges();
+            handcuffs.set_charges( handcuffs.type->maximum_charges() );
             handcuffs.active = true;
             handcuffs.set_var( "HANDCUFFS_X", foe->posx() );
             handcuffs.set_var( "HANDCUFFS_Y", foe->posy() );
@@ -4786,7 +4786,7 @@ bool mattack::riotbot( monster *z )
                          _( "You deftly slip out of the handcuffs just as the robot closes them.  The robot didn't seem to notice!" ) );
                 foe->i_add( handcuffs );
             } else {
-                handcuffs.item_tags.insert( "NO_UNWIELD" );
+                handcuffs.set_flag( "NO_UNWIELD" );
                 foe->wield( foe->i_add( handcuffs ) );
                 foe->moves -= 300;
                 add_msg( _( "The robot puts handcuffs on you." ) );
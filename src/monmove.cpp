@@ -440,12 +440,8 @@ void monster::plan()
                 continue;
             }
 
-            for( const weak_ptr_fast<monster> &weak : fac.second ) {
-                const shared_ptr_fast<monster> shared = weak.lock();
-                if( !shared ) {
-                    continue;
-                }
-                monster &mon = *shared;
+            for( monster *member : fac.second ) {
+                monster &mon = *member;
                 float rating = rate_target( mon, dist, smart_planning );
                 if( rating == dist ) {
                     ++valid_targets;
@@ -479,12 +475,8 @@ void monster::plan()
     }
     swarms = swarms && target == nullptr; // Only swarm if we have no target
     if( group_morale || swarms ) {
-        for( const weak_ptr_fast<monster> &weak : myfaction_iter->second ) {
-            const shared_ptr_fast<monster> shared = weak.lock();
-            if( !shared ) {
-                continue;
-            }
-            monster &mon = *shared;
+        for( monster *member : myfaction_iter->second ) {
+            monster &mon = *member;
             float rating = rate_target( mon, dist, smart_planning );
             if( group_morale && rating <= 10 ) {
                 morale += 10 - rating;
@@ -6,6 +6,7 @@
 #include <tuple>
 #include <unordered_map>
 
+#include "avatar.h"
 #include "bodypart.h"
 #include "catacharset.h"
 #include "character.h"
@@ -2173,6 +2174,7 @@ void monster::process_turn()
 
 void monster::die( Creature *nkiller )
 {
+    avatar::invalidate_visible_creatures();
     if( dead ) {
         // We are already dead, don't die again, note that monster::dead is
         // *only* set to true in this function!
@@ -2377,7 +2379,7 @@ void monster::drop_items_on_death()
         for( const auto &it : dropped ) {
             if( ( it->is_armor() || it->is_pet_armor() ) && !it->is_gun() ) {
                 // handle wearable guns as a special case
-                it->item_tags.insert( "FILTHY" );
+                it->set_flag( "FILTHY" );
             }
         }
     }
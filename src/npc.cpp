@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "auto_pickup.h"
+#include "avatar.h"
 #include "basecamp.h"
 #include "bodypart.h"
 #include "catacharset.h"
@@ -199,7 +200,7 @@ standard_npc::standard_npc( const std::string &name, const tripoint &pos,
 
     for( item &e : worn ) {
         if( e.has_flag( "VARSIZE" ) ) {
-            e.item_tags.insert( "FIT" );
+            e.set_flag( "FIT" );
         }
     }
 }
@@ -577,7 +578,7 @@ void starting_clothes( npc &who, const npc_class_id &type, bool male )
     who.worn.clear();
     for( item &it : ret ) {
         if( it.has_flag( "VARSIZE" ) ) {
-            it.item_tags.insert( "FIT" );
+            it.set_flag( "FIT" );
         }
         if( who.can_wear( it ).success() ) {
             it.on_wear( who );
@@ -631,7 +632,7 @@ void starting_inv( npc &who, const npc_class_id &type )
         item tmp = random_item_from( type, "misc" ).in_its_container();
         if( !tmp.is_null() ) {
             if( !one_in( 3 ) && tmp.has_flag( "VARSIZE" ) ) {
-                tmp.item_tags.insert( "FIT" );
+                tmp.set_flag( "FIT" );
             }
             if( who.can_pickVolume( tmp ) ) {
                 res.push_back( tmp );
@@ -683,6 +684,7 @@ void npc::set_known_to_u( bool known )
 
 void npc::setpos( const tripoint &pos )
 {
+    avatar::invalidate_visible_creatures();
     position = pos;
     const point_abs_om pos_om_old( sm_to_om_copy( submap_coords ) );
     submap_coords = get_map().get_abs_sub().xy() + point( pos.x / SEEX, pos.y / SEEY );
@@ -2494,6 +2496,7 @@ void npc::reboot()
 
 void npc::die( Creature *nkiller )
 {
+    avatar::invalidate_visible_creatures();
     if( dead ) {
         // We are already dead, don't die again, note that npc::dead is
         // *only* set to true in this function!
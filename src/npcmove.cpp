@@ -3490,7 +3490,7 @@ static void npc_throw( npc &np, item &it, const tripoint &pos )
     int stack_size = -1;
     if( it.count_by_charges() ) {
         stack_size = it.charges;
-        it.charges = 1;
+        it.set_charges( 1 );
     }
     if( !np.is_hallucination() ) { // hallucinations only pretend to throw
         np.throw_item( pos, it );
@@ -3499,7 +3499,7 @@ static void npc_throw( npc &np, item &it, const tripoint &pos )
     if( stack_size == -1 || stack_size == 1 ) {
         np.i_rem( &it );
     } else {
-        it.charges = stack_size - 1;
+        it.set_charges( stack_size - 1 );
     }
 }
 
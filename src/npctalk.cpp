@@ -1314,11 +1314,11 @@ void parse_tags( std::string &phrase, const Character &u, const Character &me,
             phrase.replace( fa, l, format_money( tmp.price( true ) ) );
         } else if( tag == "<topic_item_my_total_price>" ) {
             item tmp( item_type );
-            tmp.charges = me.charges_of( item_type );
+            tmp.set_charges( me.charges_of( item_type ) );
             phrase.replace( fa, l, format_money( tmp.price( true ) ) );
         } else if( tag == "<topic_item_your_total_price>" ) {
             item tmp( item_type );
-            tmp.charges = u.charges_of( item_type );
+            tmp.set_charges( u.charges_of( item_type ) );
             phrase.replace( fa, l, format_money( tmp.price( true ) ) );
         } else if( !tag.empty() ) {
             debugmsg( "Bad tag.  '%s' (%d - %d)", tag.c_str(), fa, fb );
@@ -1918,7 +1918,7 @@ void talk_effect_fun_t::set_bulk_trade_accept( bool is_trade, bool is_npc )
         const std::unique_ptr<talker> &buyer = is_npc ? d.alpha : d.beta;
         int seller_has = seller->charges_of( d.cur_item );
         item tmp( d.cur_item );
-        tmp.charges = seller_has;
+        tmp.set_charges( seller_has );
         if( is_trade ) {
             int price = tmp.price( true ) * ( is_npc ? -1 : 1 ) + d.beta->debt();
             if( d.beta->get_faction() && !d.beta->get_faction()->currency.is_empty() ) {
@@ -60,7 +60,7 @@ void npc_trading::transfer_items( std::vector<item_pricing> &stuff, player &give
         int count = npc_gives ? ip.u_has : ip.npc_has;
 
         if( ip.charges ) {
-            gift.charges = charges;
+            gift.set_charges( charges );
             receiver.i_add( gift );
         } else {
             for( int i = 0; i < count; i++ ) {
@@ -696,7 +696,8 @@ bool npc_trading::trade( npc &np, int cost, const std::string &deal )
                 continue;
             }
             if( it->has_var( "trade_charges" ) && it->count_by_charges() ) {
-                it->charges -= static_cast<int>( it->get_var( "trade_charges", 0 ) );
+                it->set_charges( it->charges -
+                                 static_cast<int>( it->get_var( "trade_charges", 0 ) ) );
                 if( it->charges <= 0 ) {
                     loc_ptr->remove_item();
                 } else {
@@ -61,6 +61,9 @@ bool keycode_mode;
 std::map<std::string, std::string> TILESETS; // All found tilesets: <name, tileset_dir>
 std::map<std::string, std::string> SOUNDPACKS; // All found soundpacks: <name, soundpack_dir>
 
+/** Set once @ref options_manager::init has run; option handles are not refreshed before. */
+static bool options_initialized = false;
+
 options_manager &get_options()
 {
     static options_manager single_instance;
@@ -775,6 +778,7 @@ void options_manager::cOpt::setNext()
             fSet = fMin;
         }
     }
+    options_manager::notify_changed();
 }
 
 //set to previous item
@@ -813,6 +817,7 @@ void options_manager::cOpt::setPrev()
             fSet = fMax;
         }
     }
+    options_manager::notify_changed();
 }
 
 //set value
@@ -826,6 +831,7 @@ void options_manager::cOpt::setValue( float fSetIn )
     if( fSet < fMin || fSet > fMax ) {
         fSet = fDefault;
     }
+    options_manager::notify_changed();
 }
 
 //set value
@@ -839,6 +845,7 @@ void options_manager::cOpt::setValue( int iSetIn )
     if( iSet < iMin || iSet > iMax ) {
         iSet = iDefault;
     }
+    options_manager::notify_changed();
 }
 
 //set value
@@ -881,6 +888,7 @@ void options_manager::cOpt::setValue( const std::string &sSetIn )
             debugmsg( "invalid floating point option: %s", sSetIn );
         }
     }
+    options_manager::notify_changed();
 }
 
 /** Fill a mapping with values.
@@ -1100,6 +1108,9 @@ void options_manager::init()
     for( Page &p : pages_ ) {
         p.removeRepeatedEmptyLines();
     }
+
+    options_initialized = true;
+    notify_changed();
 }
 
 void options_manager::add_options_general()
@@ -2935,6 +2946,7 @@ std::string options_manager::show( bool ingame, const bool world_options_only,
             if( ingame && world_options_changed ) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            notify_changed();
         }
     }
 
@@ -3040,6 +3052,8 @@ static void update_options_cache()
     fov_3d = ::get_option<bool>( "FOV_3D" );
     fov_3d_z_range = ::get_option<int>( "FOV_3D_Z_RANGE" );
     keycode_mode = ::get_option<std::string>( "SDL_KEYBOARD_MODE" ) == "keycode";
+
+    options_manager::notify_changed();
 }
 
 bool options_manager::save()
@@ -3151,6 +3165,60 @@ void options_manager::set_world_options( options_container *options )
     } else {
         world_options = options;
     }
+    notify_changed();
+}
+
+const options_manager::cOpt *options_manager::find_option( const std::string &name ) const
+{
+    if( world_options.has_value() ) {
+        const auto wopt = ( *world_options )->find( name );
+        if( wopt != ( *world_options )->end() ) {
+            return &wopt->second;
+        }
+    }
+    const auto opt = options.find( name );
+    return opt != options.end() ? &opt->second : nullptr;
+}
+
+static std::vector<option_handle_base *> &option_handles()
+{
+    static std::vector<option_handle_base *> handles;
+    return handles;
+}
+
+void options_manager::notify_changed()
+{
+    if( !options_initialized ) {
+        return;
+    }
+    for( option_handle_base *handle : option_handles() ) {
+        handle->refresh();
+    }
+}
+
+option_handle_base::option_handle_base( const std::string &name ) : name_( name )
+{
+    option_handles().push_back( this );
+}
+
+option_handle_base::~option_handle_base()
+{
+    std::vector<option_handle_base *> &handles = option_handles();
+    handles.erase( std::remove( handles.begin(), handles.end(), this ), handles.end() );
+}
+
+const options_manager::cOpt *option_handle_base::lookup( const std::string &name )
+{
+    return options_initialized ? get_options().find_option( name ) : nullptr;
+}
+
+void option_handle_base::refresh()
+{
+    const options_manager::cOpt *opt = lookup( name_ );
+    if( opt == nullptr && options_initialized ) {
+        debugmsg( "option handle refers to non-existing option %s", name_ );
+    }
+    update( opt );
 }
 
 void options_manager::update_global_locale()
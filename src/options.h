@@ -233,6 +233,14 @@ class options_manager
         bool has_option( const std::string &name ) const;
 
         cOpt &get_option( const std::string &name );
+        /** Like @ref get_option, but returns nullptr for missing options and never inserts. */
+        const cOpt *find_option( const std::string &name ) const;
+
+        /**
+         * Refresh every registered @ref option_handle. Called whenever an option value
+         * or the set of active world options may have changed.
+         */
+        static void notify_changed();
 
         //add hidden external option with value
         void add_external( const std::string &sNameIn, const std::string &sPageIn, const std::string &sType,
@@ -334,4 +342,63 @@ inline T get_option( const std::string &name )
     return get_options().get_option( name ).value_as<T>();
 }
 
+class option_handle_base
+{
+    public:
+        option_handle_base( const option_handle_base & ) = delete;
+        option_handle_base &operator=( const option_handle_base & ) = delete;
+
+        const std::string &name() const {
+            return name_;
+        }
+    protected:
+        explicit option_handle_base( const std::string &name );
+        virtual ~option_handle_base();
+
+        /** The option called @p name, or nullptr if options have not been initialized yet. */
+        static const options_manager::cOpt *lookup( const std::string &name );
+        /** Re-read the value, raising a debugmsg if the option doesn't exist once options are initialized. */
+        void refresh();
+    private:
+        friend class options_manager;
+        /** Re-read the value from @p opt, which is nullptr if the option doesn't exist (yet). */
+        virtual void update( const options_manager::cOpt *opt ) = 0;
+
+        std::string name_;
+};
+
+/**
+ * Typed, cached view of a single option, for code that reads it every turn or every frame.
+ * Handles register themselves on construction and are refreshed by
+ * @ref options_manager::notify_changed, so reading one is a plain load instead of a
+ * string lookup plus conversion. Meant to be declared with static storage duration:
+ *
+ *     static const option_handle<bool> opt_autosave( "AUTOSAVE" );
+ *     if( opt_autosave ) { ... }
+ *
+ * Until @ref options_manager::init has run, the handle holds a value-initialized T. A handle
+ * whose option doesn't exist holds one as well and raises a debugmsg, like @ref get_option.
+ */
+template<typename T>
+class option_handle : public option_handle_base
+{
+    public:
+        explicit option_handle( const std::string &name ) : option_handle_base( name ) {
+            refresh();
+        }
+
+        const T &get() const {
+            return value_;
+        }
+        operator const T &() const {
+            return value_;
+        }
+    private:
+        void update( const options_manager::cOpt *opt ) override {
+            value_ = opt != nullptr ? opt->value_as<T>() : T();
+        }
+
+        T value_ = T();
+};
+
 #endif // CATA_SRC_OPTIONS_H
@@ -2012,7 +2012,8 @@ void scrollingcombattext::add( const point &pos, direction p_oDir,
                                const std::string &p_sText2, const game_message_type p_gmt2,
                                const std::string &p_sType )
 {
-    if( get_option<bool>( "ANIMATION_SCT" ) ) {
+    static const option_handle<bool> option_ANIMATION_SCT( "ANIMATION_SCT" );
+    if( option_ANIMATION_SCT ) {
 
         int iCurStep = 0;
 
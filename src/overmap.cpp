@@ -1030,6 +1030,11 @@ overmap::overmap( const point_abs_om &p ) : loc( p )
                   rsettings_id.c_str() ); // gonna die now =[
     }
     settings = rsit->second;
+    world_seed = g->get_seed();
+    city_size = get_option<int>( "CITY_SIZE" );
+    city_spacing = get_option<int>( "CITY_SPACING" );
+    wander_spawns = get_option<bool>( "WANDER_SPAWNS" );
+    disable_animal_clash = get_option<bool>( "DISABLE_ANIMAL_CLASH" );
 
     init_layers();
 }
@@ -1046,6 +1051,12 @@ void overmap::populate( overmap_special_batch &enabled_specials )
 }
 
 void overmap::populate()
+{
+    overmap_special_batch enabled_specials = get_enabled_specials();
+    populate( enabled_specials );
+}
+
+overmap_special_batch overmap::get_enabled_specials() const
 {
     overmap_special_batch enabled_specials = overmap_specials::get_default_batch( loc );
 
@@ -1089,24 +1100,30 @@ void overmap::populate()
         }
     }
 
-    populate( enabled_specials );
+    return enabled_specials;
 }
 
 oter_id overmap::get_default_terrain( int z ) const
 {
-    if( z == 0 ) {
-        return settings.default_oter.id();
-    } else {
-        // // TODO: Get rid of the hard-coded ids.
-        static const oter_str_id open_air( "open_air" );
-        static const oter_str_id empty_rock( "empty_rock" );
+    return default_terrain[z + OVERMAP_DEPTH];
+}
 
-        return z > 0 ? open_air.id() : empty_rock.id();
+void overmap::resolve_default_terrain()
+{
+    // // TODO: Get rid of the hard-coded ids.
+    static const oter_str_id open_air( "open_air" );
+    static const oter_str_id empty_rock( "empty_rock" );
+
+    for( int k = 0; k < OVERMAP_LAYERS; ++k ) {
+        const int z = k - OVERMAP_DEPTH;
+        default_terrain[k] = z == 0 ? settings.default_oter.id() :
+                             z > 0 ? open_air.id() : empty_rock.id();
     }
 }
 
 void overmap::init_layers()
 {
+    resolve_default_terrain();
     for( int k = 0; k < OVERMAP_LAYERS; ++k ) {
         const oter_id tid = get_default_terrain( k - OVERMAP_DEPTH );
 
@@ -1128,6 +1145,9 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
     }
 
     layer[p.z() + OVERMAP_DEPTH].terrain[p.x()][p.y()] = id;
+    if( !travel_cost_rasters.empty() ) {
+        travel_cost_rasters.clear();
+    }
 }
 
 const oter_id &overmap::ter( const tripoint_om_omt &p ) const
@@ -1438,16 +1458,20 @@ void overmap::set_scent( const tripoint_abs_omt &loc, const scent_trace &new_sce
     scents[loc] = new_scent;
 }
 
-void overmap::generate( const overmap *north, const overmap *east,
-                        const overmap *south, const overmap *west,
-                        overmap_special_batch &enabled_specials )
+// Overmaps are part of the world, so their stream derives from the world seed.
+static rng_stream generation_stream( unsigned int world_seed, const point_abs_om &p )
 {
-    if( g->gametype() == special_game_type::DEFENSE ) {
-        dbg( D_INFO ) << "overmap::generate skipped in Defense special game mode!";
-        return;
-    }
+    return rng_stream_for( rng_context::overmap, world_seed ).split( tripoint( p.raw(), 0 ) );
+}
 
-    dbg( D_INFO ) << "overmap::generate start…";
+void overmap::generate( const overmap_border *north, const overmap_border *east,
+                        const overmap_border *south, const overmap_border *west,
+                        overmap_special_batch &enabled_specials )
+{
+    // Each overmap has its own sequence, so the result does not depend on what was
+    // generated before it or on which thread it is generated.
+    rng_stream stream = generation_stream( world_seed, loc );
+    rng_engine_scope use_stream( stream.engine() );
 
     populate_connections_out_from_neighbors( north, east, south, west );
 
@@ -1483,7 +1507,6 @@ void overmap::generate( const overmap *north, const overmap *east,
     // Place the monsters, now that the terrain is laid out
     place_mongroups();
     place_radios();
-    dbg( D_INFO ) << "overmap::generate done";
 }
 
 bool overmap::generate_sub( const int z )
@@ -2134,11 +2157,11 @@ void overmap::signal_hordes( const tripoint_rel_sm &p_rel, const int sig_power )
     }
 }
 
-void overmap::populate_connections_out_from_neighbors( const overmap *north, const overmap *east,
-        const overmap *south, const overmap *west )
+void overmap::populate_connections_out_from_neighbors( const overmap_border *north,
+        const overmap_border *east, const overmap_border *south, const overmap_border *west )
 {
     const auto populate_for_side =
-        [&]( const overmap * adjacent,
+        [&]( const overmap_border * adjacent,
              const std::function<bool( const tripoint_om_omt & )> &should_include,
     const std::function<tripoint_om_omt( const tripoint_om_omt & )> &build_point ) {
         if( adjacent == nullptr ) {
@@ -2307,7 +2330,6 @@ void overmap::place_forest_trails()
 void overmap::place_forest_trailheads()
 {
     // No trailheads if there are no cities.
-    const int city_size = get_option<int>( "CITY_SIZE" );
     if( city_size <= 0 ) {
         return;
     }
@@ -2360,7 +2382,8 @@ void overmap::place_forests()
     const oter_id forest( "forest" );
     const oter_id forest_thick( "forest_thick" );
 
-    const om_noise::om_noise_layer_forest f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_forest f( global_base_point(), world_seed );
+    const std::vector<float> noise = f.noise_grid( point_om_omt( 0, 0 ), point( OMAPX, OMAPY ) );
 
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
@@ -2373,7 +2396,7 @@ void overmap::place_forests()
                 continue;
             }
 
-            const float n = f.noise_at( p.xy() );
+            const float n = noise[y * OMAPX + x];
 
             // If the noise here meets our threshold, turn it into a forest.
             if( n > settings.overmap_forest.noise_threshold_forest_thick ) {
@@ -2387,10 +2410,12 @@ void overmap::place_forests()
 
 void overmap::place_lakes()
 {
-    const om_noise::om_noise_layer_lake f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_lake f( global_base_point(), world_seed );
+    // Every point of the overmap is tested at least once, so compute them all up front.
+    const om_noise::om_noise_layer_cache noise( f );
 
     const auto is_lake = [&]( const point_om_omt & p ) {
-        return f.noise_at( p ) > settings.overmap_lake.noise_threshold_lake;
+        return noise.noise_at( p ) > settings.overmap_lake.noise_threshold_lake;
     };
 
     const oter_id lake_surface( "lake_surface" );
@@ -2522,8 +2547,8 @@ void overmap::place_lakes()
     }
 }
 
-void overmap::place_rivers( const overmap *north, const overmap *east, const overmap *south,
-                            const overmap *west )
+void overmap::place_rivers( const overmap_border *north, const overmap_border *east,
+                            const overmap_border *south, const overmap_border *west )
 {
     if( settings.river_scale == 0.0 ) {
         return;
@@ -2541,15 +2566,14 @@ void overmap::place_rivers( const overmap *north, const overmap *east, const ove
 
     if( north != nullptr ) {
         for( int i = 2; i < OMAPX - 2; i++ ) {
-            const tripoint_om_omt p_neighbour( i, OMAPY - 1, 0 );
             const tripoint_om_omt p_mine( i, 0, 0 );
 
-            if( is_river( north->ter( p_neighbour ) ) ) {
+            if( is_river( north->ground[i] ) ) {
                 ter_set( p_mine, river_center );
             }
-            if( is_river( north->ter( p_neighbour ) ) &&
-                is_river( north->ter( p_neighbour + point_east ) ) &&
-                is_river( north->ter( p_neighbour + point_west ) ) ) {
+            if( is_river( north->ground[i] ) &&
+                is_river( north->ground[i + 1] ) &&
+                is_river( north->ground[i - 1] ) ) {
                 if( one_in( river_chance ) && ( river_start.empty() ||
                                                 river_start[river_start.size() - 1].x() < ( i - 6 ) * river_scale ) ) {
                     river_start.push_back( p_mine.xy() );
@@ -2560,15 +2584,14 @@ void overmap::place_rivers( const overmap *north, const overmap *east, const ove
     size_t rivers_from_north = river_start.size();
     if( west != nullptr ) {
         for( int i = 2; i < OMAPY - 2; i++ ) {
-            const tripoint_om_omt p_neighbour( OMAPX - 1, i, 0 );
             const tripoint_om_omt p_mine( 0, i, 0 );
 
-            if( is_river( west->ter( p_neighbour ) ) ) {
+            if( is_river( west->ground[i] ) ) {
                 ter_set( p_mine, river_center );
             }
-            if( is_river( west->ter( p_neighbour ) ) &&
-                is_river( west->ter( p_neighbour + point_north ) ) &&
-                is_river( west->ter( p_neighbour + point_south ) ) ) {
+            if( is_river( west->ground[i] ) &&
+                is_river( west->ground[i - 1] ) &&
+                is_river( west->ground[i + 1] ) ) {
                 if( one_in( river_chance ) && ( river_start.size() == rivers_from_north ||
                                                 river_start[river_start.size() - 1].y() < ( i - 6 ) * river_scale ) ) {
                     river_start.push_back( p_mine.xy() );
@@ -2578,15 +2601,14 @@ void overmap::place_rivers( const overmap *north, const overmap *east, const ove
     }
     if( south != nullptr ) {
         for( int i = 2; i < OMAPX - 2; i++ ) {
-            const tripoint_om_omt p_neighbour( i, 0, 0 );
             const tripoint_om_omt p_mine( i, OMAPY - 1, 0 );
 
-            if( is_river( south->ter( p_neighbour ) ) ) {
+            if( is_river( south->ground[i] ) ) {
                 ter_set( p_mine, river_center );
             }
-            if( is_river( south->ter( p_neighbour ) ) &&
-                is_river( south->ter( p_neighbour + point_east ) ) &&
-                is_river( south->ter( p_neighbour + point_west ) ) ) {
+            if( is_river( south->ground[i] ) &&
+                is_river( south->ground[i + 1] ) &&
+                is_river( south->ground[i - 1] ) ) {
                 if( river_end.empty() ||
                     river_end[river_end.size() - 1].x() < i - 6 ) {
                     river_end.push_back( p_mine.xy() );
@@ -2597,15 +2619,14 @@ void overmap::place_rivers( const overmap *north, const overmap *east, const ove
     size_t rivers_to_south = river_end.size();
     if( east != nullptr ) {
         for( int i = 2; i < OMAPY - 2; i++ ) {
-            const tripoint_om_omt p_neighbour( 0, i, 0 );
             const tripoint_om_omt p_mine( OMAPX - 1, i, 0 );
 
-            if( is_river( east->ter( p_neighbour ) ) ) {
+            if( is_river( east->ground[i] ) ) {
                 ter_set( p_mine, river_center );
             }
-            if( is_river( east->ter( p_neighbour ) ) &&
-                is_river( east->ter( p_neighbour + point_north ) ) &&
-                is_river( east->ter( p_neighbour + point_south ) ) ) {
+            if( is_river( east->ground[i] ) &&
+                is_river( east->ground[i - 1] ) &&
+                is_river( east->ground[i + 1] ) ) {
                 if( river_end.size() == rivers_to_south ||
                     river_end[river_end.size() - 1].y() < i - 6 ) {
                     river_end.push_back( p_mine.xy() );
@@ -2704,7 +2725,7 @@ void overmap::place_swamps()
     const oter_id forest_water( "forest_water" );
 
     // Get a layer of noise to use in conjunction with our river buffered floodplain.
-    const om_noise::om_noise_layer_floodplain f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_floodplain f( global_base_point(), world_seed );
 
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
@@ -2731,8 +2752,8 @@ void overmap::place_swamps()
     }
 }
 
-void overmap::place_roads( const overmap *north, const overmap *east, const overmap *south,
-                           const overmap *west )
+void overmap::place_roads( const overmap_border *north, const overmap_border *east,
+                           const overmap_border *south, const overmap_border *west )
 {
     const string_id<overmap_connection> local_road( "local_road" );
     std::vector<tripoint_om_omt> &roads_out = connections_out[local_road];
@@ -2888,11 +2909,11 @@ spawns happen at... <cue Clue music>
 20:56 <kevingranade>: game:pawn_mon() in game.cpp:7380*/
 void overmap::place_cities()
 {
-    int op_city_size = get_option<int>( "CITY_SIZE" );
+    int op_city_size = city_size;
     if( op_city_size <= 0 ) {
         return;
     }
-    int op_city_spacing = get_option<int>( "CITY_SPACING" );
+    int op_city_spacing = city_spacing;
 
     // spacing dictates how much of the map is covered in cities
     //   city  |  cities  |   size N cities per overmap
@@ -3005,7 +3026,7 @@ void overmap::build_city_street(
     int croad = cs;
 
     if( dir == om_direction::type::invalid ) {
-        debugmsg( "Invalid road direction." );
+        generation_error( "Invalid road direction." );
         return;
     }
 
@@ -3260,7 +3281,8 @@ void overmap::build_anthill( const tripoint_om_omt &p, int s )
         }
     }
     if( queenpoints.empty() ) {
-        debugmsg( "No queenpoints when building anthill, anthill over %s", ter( p ).id().str() );
+        generation_error( string_format( "No queenpoints when building anthill, anthill over %s",
+                                         ter( p ).id().str() ) );
     }
     const tripoint_om_omt target = random_entry( queenpoints );
     ter_set( target, oter_id( "ants_queen" ) );
@@ -3539,8 +3561,8 @@ void overmap::build_connection(
         const overmap_connection::subtype *subtype = connection.pick_subtype_for( ter_id );
 
         if( !subtype ) {
-            debugmsg( "No suitable subtype of connection \"%s\" found for \"%s\".", connection.id.c_str(),
-                      ter_id.id().c_str() );
+            generation_error( string_format( "No suitable subtype of connection \"%s\" found for \"%s\".",
+                                             connection.id.c_str(), ter_id.id().c_str() ) );
             return;
         }
 
@@ -3592,7 +3614,8 @@ void overmap::build_connection(
             }
 
             if( new_line == om_lines::invalid ) {
-                debugmsg( "Invalid path for connection \"%s\".", connection.id.c_str() );
+                generation_error( string_format( "Invalid path for connection \"%s\".",
+                                                 connection.id.c_str() ) );
                 return;
             }
 
@@ -4186,29 +4209,11 @@ void overmap::place_specials( overmap_special_batch &enabled_specials )
     return placement.instances_placed <
            placement.special_details->occurrences.min;
 } ) ) {
-        // Randomly select from among the nearest uninitialized overmap positions.
-        int previous_distance = 0;
-        std::vector<point_abs_om> nearest_candidates;
-        // Since this starts at enabled_specials::origin, it will only place new overmaps
-        // in the 5x5 area surrounding the initial overmap, bounding the amount of work we will do.
-        for( const point_abs_om &candidate_addr : closest_points_first(
-                 custom_overmap_specials.get_origin(), 2 ) ) {
-            if( !overmap_buffer.has( candidate_addr ) ) {
-                int current_distance = square_dist( pos(), candidate_addr );
-                if( nearest_candidates.empty() || current_distance == previous_distance ) {
-                    nearest_candidates.push_back( candidate_addr );
-                    previous_distance = current_distance;
-                } else {
-                    break;
-                }
-            }
-        }
-        if( !nearest_candidates.empty() ) {
-            std::shuffle( nearest_candidates.begin(), nearest_candidates.end(), rng_get_engine() );
-            point_abs_om new_om_addr = nearest_candidates.front();
-            overmap_buffer.create_custom_overmap( new_om_addr, custom_overmap_specials );
+        if( defer_neighbour_specials ) {
+            // The overmap buffer can only be touched from the main thread.
+            deferred_specials = custom_overmap_specials;
         } else {
-            add_msg( _( "Unable to place all configured specials, some missions may fail to initialize." ) );
+            place_specials_on_neighbours( custom_overmap_specials );
         }
     }
     // Then fill in non-mandatory specials.
@@ -4254,11 +4259,68 @@ void overmap::place_specials( overmap_special_batch &enabled_specials )
     }
 }
 
+void overmap::place_specials_on_neighbours( overmap_special_batch &custom_overmap_specials )
+{
+    // Randomly select from among the nearest uninitialized overmap positions.
+    int previous_distance = 0;
+    std::vector<point_abs_om> nearest_candidates;
+    // Since this starts at enabled_specials::origin, it will only place new overmaps
+    // in the 5x5 area surrounding the initial overmap, bounding the amount of work we will do.
+    for( const point_abs_om &candidate_addr : closest_points_first(
+             custom_overmap_specials.get_origin(), 2 ) ) {
+        if( !overmap_buffer.has( candidate_addr ) ) {
+            int current_distance = square_dist( pos(), candidate_addr );
+            if( nearest_candidates.empty() || current_distance == previous_distance ) {
+                nearest_candidates.push_back( candidate_addr );
+                previous_distance = current_distance;
+            } else {
+                break;
+            }
+        }
+    }
+    if( !nearest_candidates.empty() ) {
+        std::shuffle( nearest_candidates.begin(), nearest_candidates.end(), rng_get_engine() );
+        point_abs_om new_om_addr = nearest_candidates.front();
+        overmap_buffer.create_custom_overmap( new_om_addr, custom_overmap_specials );
+    } else {
+        add_msg( _( "Unable to place all configured specials, some missions may fail to initialize." ) );
+    }
+}
+
+void overmap::generation_error( const std::string &message )
+{
+    if( defer_neighbour_specials ) {
+        generation_errors.push_back( message );
+    } else {
+        debugmsg( "%s", message );
+    }
+}
+
+void overmap::report_generation_errors()
+{
+    for( const std::string &message : generation_errors ) {
+        debugmsg( "%s", message );
+    }
+    generation_errors.clear();
+}
+
+void overmap::place_deferred_specials()
+{
+    if( !deferred_specials ) {
+        return;
+    }
+    overmap_special_batch specials = *deferred_specials;
+    deferred_specials.reset();
+    rng_stream stream = generation_stream( world_seed, loc ).split( 1 );
+    rng_engine_scope use_stream( stream.engine() );
+    place_specials_on_neighbours( specials );
+}
+
 void overmap::place_mongroups()
 {
     // Cities are full of zombies
     for( city &elem : cities ) {
-        if( get_option<bool>( "WANDER_SPAWNS" ) ) {
+        if( wander_spawns ) {
             if( !one_in( 16 ) || elem.size > 5 ) {
                 mongroup m( GROUP_ZOMBIE,
                             tripoint_om_sm( project_to<coords::sm>( elem.pos ), 0 ),
@@ -4272,7 +4334,7 @@ void overmap::place_mongroups()
         }
     }
 
-    if( get_option<bool>( "DISABLE_ANIMAL_CLASH" ) ) {
+    if( disable_animal_clash ) {
         // Figure out where swamps are, and place swamp monsters
         for( int x = 3; x < OMAPX - 3; x += 7 ) {
             for( int y = 3; y < OMAPY - 3; y += 7 ) {
@@ -4366,19 +4428,49 @@ void overmap::open( overmap_special_batch &enabled_specials )
         const std::string plrfilename = overmapbuffer::player_filename( loc );
         read_from_file_optional( plrfilename, std::bind( &overmap::unserialize_view, this, _1 ) );
     } else { // No map exists!  Prepare neighbors, and generate one.
-        std::vector<const overmap *> pointers;
-        // Fetch south and north
-        for( int i = -1; i <= 1; i += 2 ) {
-            pointers.push_back( overmap_buffer.get_existing( loc + point( 0, i ) ) );
+        std::array<cata::optional<overmap_border>, 4> borders;
+        for( om_direction::type dir : om_direction::all ) {
+            const overmap *adjacent = overmap_buffer.get_existing( loc + om_direction::displace( dir ) );
+            if( adjacent != nullptr ) {
+                borders[static_cast<int>( dir )] = adjacent->border( om_direction::opposite( dir ) );
+            }
         }
-        // Fetch east and west
-        for( int i = -1; i <= 1; i += 2 ) {
-            pointers.push_back( overmap_buffer.get_existing( loc + point( i, 0 ) ) );
+        const auto border_ptr = [&borders]( om_direction::type dir ) {
+            const cata::optional<overmap_border> &border = borders[static_cast<int>( dir )];
+            return border ? &*border : nullptr;
+        };
+        if( g->gametype() == special_game_type::DEFENSE ) {
+            dbg( D_INFO ) << "overmap::generate skipped in Defense special game mode!";
+            return;
         }
+        dbg( D_INFO ) << "overmap::generate start…";
+        generate( border_ptr( om_direction::type::north ), border_ptr( om_direction::type::east ),
+                  border_ptr( om_direction::type::south ), border_ptr( om_direction::type::west ),
+                  enabled_specials );
+        dbg( D_INFO ) << "overmap::generate done";
+    }
+}
 
-        // pointers looks like (north, south, west, east)
-        generate( pointers[0], pointers[3], pointers[1], pointers[2], enabled_specials );
+overmap_border overmap::border( const om_direction::type side ) const
+{
+    overmap_border result;
+    // The edge as the neighbour on that side sees it: the coordinate along the edge and
+    // the fixed coordinate across it.
+    const bool along_x = side == om_direction::type::north || side == om_direction::type::south;
+    const int across = side == om_direction::type::south ? OMAPY - 1 :
+                       side == om_direction::type::east ? OMAPX - 1 : 0;
+    const auto on_edge = [&]( const tripoint_om_omt & p ) {
+        return ( along_x ? p.y() : p.x() ) == across;
+    };
+    for( int i = 0; i < OMAPX; i++ ) {
+        result.ground[i] = ter( along_x ? tripoint_om_omt( i, across, 0 ) :
+                                tripoint_om_omt( across, i, 0 ) );
+    }
+    for( const auto &kv : connections_out ) {
+        std::vector<tripoint_om_omt> &points = result.connections_out[kv.first];
+        std::copy_if( kv.second.begin(), kv.second.end(), std::back_inserter( points ), on_edge );
     }
+    return result;
 }
 
 // Note: this may throw io errors from std::ofstream
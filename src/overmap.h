@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <climits>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <iosfwd>
@@ -160,6 +161,17 @@ class overmap_special_batch
         point_abs_om origin_overmap;
 };
 
+/**
+ * What generating an overmap needs to know about an already generated neighbour: the
+ * ground terrain along the neighbour's edge facing it and the connections leaving there.
+ */
+struct overmap_border {
+    /** Ground terrain of the edge, indexed by the coordinate along it. */
+    std::array<oter_id, OMAPX> ground;
+    /** The points of the neighbour's @ref overmap::connections_out that lie on the edge. */
+    std::map<string_id<overmap_connection>, std::vector<tripoint_om_omt>> connections_out;
+};
+
 static const std::map<std::string, oter_flags> oter_flags_map = {
     { "KNOWN_DOWN", oter_flags::known_down },
     { "KNOWN_UP", oter_flags::known_up },
@@ -217,6 +229,9 @@ class overmap
             return loc;
         }
 
+        /** The border of the edge of this overmap in direction @p side. */
+        overmap_border border( om_direction::type side ) const;
+
         void save() const;
 
         /**
@@ -347,6 +362,7 @@ class overmap
 
     private:
         friend class overmapbuffer;
+        friend class overmap_generation_service;
 
         std::vector<shared_ptr_fast<npc>> npcs;
 
@@ -356,19 +372,58 @@ class overmap
         std::array<map_layer, OVERMAP_LAYERS> layer;
         std::unordered_map<tripoint_abs_omt, scent_trace> scents;
 
+        /**
+         * Travel cost of each terrain of a z-level for one kind of NPC path, by z-level and
+         * kind. Filled on demand by overmapbuffer::get_npc_path, dropped by @ref ter_set.
+         */
+        mutable std::unordered_map<int, std::vector<int16_t>> travel_cost_rasters;
+
         // Records the locations where a given overmap special was placed, which
         // can be used after placement to lookup whether a given location was created
         // as part of a special.
         std::unordered_map<tripoint_om_omt, overmap_special_id> overmap_special_placements;
 
         regional_settings settings;
+        /**
+         * The terrain of untouched tiles by z-level, from @ref settings. Resolved to ids on the
+         * main thread, string ids cache their lookup and must not be resolved while generating.
+         */
+        std::array<oter_id, OVERMAP_LAYERS> default_terrain;
+        /** Seed of the world this overmap is in, read on the main thread for the same reason. */
+        unsigned int world_seed = 0;
+        /** The options generation depends on, read on the main thread as well. */
+        int city_size = 0;
+        int city_spacing = 0;
+        bool wander_spawns = false;
+        bool disable_animal_clash = false;
 
         oter_id get_default_terrain( int z ) const;
+        void resolve_default_terrain();
+
+        /**
+         * Set while generating off the main thread. Mandatory specials that don't fit are
+         * then kept in @ref deferred_specials instead of being placed on new neighbours,
+         * and errors are kept in @ref generation_errors.
+         */
+        bool defer_neighbour_specials = false;
+        cata::optional<overmap_special_batch> deferred_specials;
 
         // Initialize
         void init_layers();
+        // The default specials, filtered by the region settings
+        overmap_special_batch get_enabled_specials() const;
         // open existing overmap, or generate a new one
         void open( overmap_special_batch &enabled_specials );
+        // Places the specials kept in @ref deferred_specials, must run on the main thread
+        void place_deferred_specials();
+        /**
+         * Passes @p message to debugmsg, or keeps it for @ref report_generation_errors
+         * while generating off the main thread.
+         */
+        void generation_error( const std::string &message );
+        std::vector<std::string> generation_errors;
+        // Passes the errors kept by @ref generation_error to debugmsg, must run on the main thread
+        void report_generation_errors();
     public:
 
         /**
@@ -388,8 +443,8 @@ class overmap
         // Save per-player overmap view data.
         void serialize_view( std::ostream &fout ) const;
     private:
-        void generate( const overmap *north, const overmap *east,
-                       const overmap *south, const overmap *west,
+        void generate( const overmap_border *north, const overmap_border *east,
+                       const overmap_border *south, const overmap_border *west,
                        overmap_special_batch &enabled_specials );
         bool generate_sub( int z );
         bool generate_over( int z );
@@ -410,17 +465,17 @@ class overmap
         void place_river( point_om_omt pa, point_om_omt pb );
         void place_forests();
         void place_lakes();
-        void place_rivers( const overmap *north, const overmap *east, const overmap *south,
-                           const overmap *west );
+        void place_rivers( const overmap_border *north, const overmap_border *east,
+                           const overmap_border *south, const overmap_border *west );
         void place_swamps();
         void place_forest_trails();
         void place_forest_trailheads();
 
-        void place_roads( const overmap *north, const overmap *east, const overmap *south,
-                          const overmap *west );
+        void place_roads( const overmap_border *north, const overmap_border *east,
+                          const overmap_border *south, const overmap_border *west );
 
-        void populate_connections_out_from_neighbors( const overmap *north, const overmap *east,
-                const overmap *south, const overmap *west );
+        void populate_connections_out_from_neighbors( const overmap_border *north,
+                const overmap_border *east, const overmap_border *south, const overmap_border *west );
 
         // City Building
         overmap_special_id pick_random_building_to_place( int town_dist ) const;
@@ -479,6 +534,8 @@ class overmap
          * @param enabled_specials specifies what specials to place, and tracks how many have been placed.
          **/
         void place_specials( overmap_special_batch &enabled_specials );
+        /** Places mandatory specials that didn't fit on a new overmap next to this one. */
+        void place_specials_on_neighbours( overmap_special_batch &custom_overmap_specials );
         /**
          * Walk over the overmap and attempt to place specials.
          * @param enabled_specials vector of objects that track specials being placed.
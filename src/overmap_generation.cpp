@@ -0,0 +1,187 @@
+#include "overmap_generation.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "omdata.h"
+#include "overmap.h"
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+/** Upper limit of worker threads, generation of a few neighbours doesn't need more. */
+static constexpr unsigned int max_workers = 4;
+
+struct overmap_generation_service::job {
+    std::unique_ptr<overmap> om;
+    overmap_special_batch specials;
+    /** Borders of the neighbours that existed when the job was queued, by om_direction. */
+    std::array<cata::optional<overmap_border>, 4> borders;
+    /** Queued neighbours that have to be done first, by om_direction. */
+    std::array<std::shared_ptr<job>, 4> depends_on;
+    /** Borders of the generated overmap, for the jobs depending on this one. */
+    std::array<cata::optional<overmap_border>, 4> own_borders;
+    bool running = false;
+    bool done = false;
+
+    job( std::unique_ptr<overmap> new_om, overmap_special_batch enabled_specials ) :
+        om( std::move( new_om ) ), specials( std::move( enabled_specials ) ) {}
+
+    bool ready() const {
+        return std::all_of( depends_on.begin(), depends_on.end(),
+        []( const std::shared_ptr<job> &dep ) {
+            return dep == nullptr || dep->done;
+        } );
+    }
+};
+
+overmap_generation_service::overmap_generation_service() = default;
+
+overmap_generation_service::~overmap_generation_service()
+{
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        stopping = true;
+    }
+    changed.notify_all();
+    for( std::thread &worker : workers ) {
+        worker.join();
+    }
+}
+
+void overmap_generation_service::enqueue( std::unique_ptr<overmap> om,
+        const std::array<cata::optional<overmap_border>, 4> &borders )
+{
+    overmap_special_batch specials = om->get_enabled_specials();
+    std::shared_ptr<job> new_job = std::make_shared<job>( std::move( om ), std::move( specials ) );
+    new_job->borders = borders;
+    const point_abs_om pos = new_job->om->pos();
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        for( om_direction::type dir : om_direction::all ) {
+            const auto neighbour = jobs_by_pos.find( pos + om_direction::displace( dir ) );
+            if( neighbour != jobs_by_pos.end() ) {
+                new_job->depends_on[static_cast<int>( dir )] = neighbour->second;
+            }
+        }
+        jobs.push_back( new_job );
+        jobs_by_pos.emplace( pos, new_job );
+        if( workers.empty() ) {
+            const unsigned int cores = std::thread::hardware_concurrency();
+            const unsigned int count = std::min( cores > 1 ? cores - 1 : 1u, max_workers );
+            for( unsigned int i = 0; i < count; ++i ) {
+                workers.emplace_back( &overmap_generation_service::work, this );
+            }
+        }
+    }
+    changed.notify_all();
+}
+
+bool overmap_generation_service::is_queued( const point_abs_om &p ) const
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    return jobs_by_pos.count( p ) > 0;
+}
+
+std::unique_ptr<overmap> overmap_generation_service::take( const point_abs_om &p )
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    const auto iter = jobs_by_pos.find( p );
+    if( iter == jobs_by_pos.end() ) {
+        return nullptr;
+    }
+    std::shared_ptr<job> wanted = iter->second;
+    changed.wait( lock, [&wanted]() {
+        return wanted->done;
+    } );
+    jobs_by_pos.erase( p );
+    jobs.erase( std::find( jobs.begin(), jobs.end(), wanted ) );
+    return std::move( wanted->om );
+}
+
+std::vector<std::unique_ptr<overmap>> overmap_generation_service::take_finished()
+{
+    std::vector<std::unique_ptr<overmap>> result;
+    std::unique_lock<std::mutex> lock( mutex );
+    for( auto iter = jobs.begin(); iter != jobs.end(); ) {
+        if( !( *iter )->done ) {
+            ++iter;
+            continue;
+        }
+        jobs_by_pos.erase( ( *iter )->om->pos() );
+        result.push_back( std::move( ( *iter )->om ) );
+        iter = jobs.erase( iter );
+    }
+    return result;
+}
+
+void overmap_generation_service::cancel()
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    // Jobs that did not start never will, the running ones have to finish first.
+    jobs.erase( std::remove_if( jobs.begin(), jobs.end(), []( const std::shared_ptr<job> &j ) {
+        return !j->running;
+    } ), jobs.end() );
+    changed.wait( lock, [this]() {
+        return std::all_of( jobs.begin(), jobs.end(), []( const std::shared_ptr<job> &j ) {
+            return j->done;
+        } );
+    } );
+    jobs.clear();
+    jobs_by_pos.clear();
+}
+
+std::shared_ptr<overmap_generation_service::job> overmap_generation_service::next_job()
+{
+    // Jobs only depend on jobs queued before them, so the first one not started whose
+    // dependencies are done is the one to run.
+    for( const std::shared_ptr<job> &j : jobs ) {
+        if( !j->running && j->ready() ) {
+            return j;
+        }
+    }
+    return nullptr;
+}
+
+void overmap_generation_service::work()
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    while( true ) {
+        std::shared_ptr<job> current;
+        changed.wait( lock, [&]() {
+            return stopping || ( current = next_job() ) != nullptr;
+        } );
+        if( stopping ) {
+            return;
+        }
+        current->running = true;
+        for( om_direction::type dir : om_direction::all ) {
+            const std::shared_ptr<job> &dep = current->depends_on[static_cast<int>( dir )];
+            if( dep != nullptr ) {
+                current->borders[static_cast<int>( dir )] =
+                    dep->own_borders[static_cast<int>( om_direction::opposite( dir ) )];
+            }
+            current->depends_on[static_cast<int>( dir )].reset();
+        }
+        lock.unlock();
+
+        overmap &om = *current->om;
+        const auto border_ptr = [&current]( om_direction::type dir ) {
+            const cata::optional<overmap_border> &border = current->borders[static_cast<int>( dir )];
+            return border ? &*border : nullptr;
+        };
+        om.defer_neighbour_specials = true;
+        om.generate( border_ptr( om_direction::type::north ), border_ptr( om_direction::type::east ),
+                     border_ptr( om_direction::type::south ), border_ptr( om_direction::type::west ),
+                     current->specials );
+        om.defer_neighbour_specials = false;
+        for( om_direction::type dir : om_direction::all ) {
+            current->own_borders[static_cast<int>( dir )] = om.border( dir );
+        }
+
+        lock.lock();
+        current->done = true;
+        changed.notify_all();
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef CATA_SRC_OVERMAP_GENERATION_H
+#define CATA_SRC_OVERMAP_GENERATION_H
+
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "coordinates.h"
+#include "optional.h"
+
+class overmap;
+struct overmap_border;
+
+/**
+ * Generates new overmaps on background threads, so that the main thread finds them ready
+ * when it first touches them.
+ *
+ * Overmaps are generated in the order they are queued: a queued overmap waits for its
+ * queued neighbours to be done and is generated from their borders, exactly as if they
+ * had been generated before it on the main thread. Together with the per-overmap random
+ * sequence this makes the result independent of the threads and their timing.
+ *
+ * Only the queued overmaps and their borders are touched off the main thread, finished
+ * overmaps are handed back to the main thread to be added to the overmap buffer.
+ */
+class overmap_generation_service
+{
+    public:
+        overmap_generation_service();
+        ~overmap_generation_service();
+
+        /**
+         * Queues the new overmap @p om for generation. @p borders are the borders of its
+         * neighbours that already exist, by om_direction, neighbours that are queued
+         * themselves are waited for instead.
+         */
+        void enqueue( std::unique_ptr<overmap> om,
+                      const std::array<cata::optional<overmap_border>, 4> &borders );
+        bool is_queued( const point_abs_om &p ) const;
+        /** Waits for the queued overmap at @p p and hands it out, nullptr if it is not queued. */
+        std::unique_ptr<overmap> take( const point_abs_om &p );
+        /** Hands out the overmaps that are done, in the order they were queued. */
+        std::vector<std::unique_ptr<overmap>> take_finished();
+        /** Drops all queued overmaps, waiting for those that are being generated. */
+        void cancel();
+
+    private:
+        struct job;
+
+        void work();
+        std::shared_ptr<job> next_job();
+
+        mutable std::mutex mutex;
+        std::condition_variable changed;
+        /** The jobs not handed out yet, in the order they were queued. */
+        std::vector<std::shared_ptr<job>> jobs;
+        std::unordered_map<point_abs_om, std::shared_ptr<job>> jobs_by_pos;
+        std::vector<std::thread> workers;
+        bool stopping = false;
+};
+
+#endif // CATA_SRC_OVERMAP_GENERATION_H
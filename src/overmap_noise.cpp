@@ -1,5 +1,6 @@
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
 
 #include "overmap_noise.h"
 #include "simplexnoise.h"
@@ -7,6 +8,47 @@
 namespace om_noise
 {
 
+namespace
+{
+
+/** Coordinate arrays of a rectangle of points, as taken by the batched noise functions. */
+struct noise_grid_input {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+
+    noise_grid_input( const point_abs_omt &min, const point &size, float seed ) {
+        const size_t count = static_cast<size_t>( std::max( size.x, 0 ) ) * std::max( size.y, 0 );
+        x.reserve( count );
+        y.reserve( count );
+        z.assign( count, seed );
+        for( int j = 0; j < size.y; j++ ) {
+            for( int i = 0; i < size.x; i++ ) {
+                x.push_back( min.x() + i );
+                y.push_back( min.y() + j );
+            }
+        }
+    }
+
+    size_t size() const {
+        return z.size();
+    }
+};
+
+} // namespace
+
+std::vector<float> om_noise_layer::noise_grid( const point_om_omt &min, const point &size ) const
+{
+    std::vector<float> result;
+    result.reserve( static_cast<size_t>( std::max( size.x, 0 ) ) * std::max( size.y, 0 ) );
+    for( int j = 0; j < size.y; j++ ) {
+        for( int i = 0; i < size.x; i++ ) {
+            result.push_back( noise_at( min + point( i, j ) ) );
+        }
+    }
+    return result;
+}
+
 float om_noise_layer_forest::noise_at( const point_om_omt &local_omt_pos ) const
 {
     const point_abs_omt p = global_omt_pos( local_omt_pos );
@@ -19,6 +61,25 @@ float om_noise_layer_forest::noise_at( const point_om_omt &local_omt_pos ) const
     return std::max( 0.0f, r - d * 0.5f );
 }
 
+std::vector<float> om_noise_layer_forest::noise_grid( const point_om_omt &min,
+        const point &size ) const
+{
+    const noise_grid_input in( global_omt_pos( min ), size, get_seed() );
+    std::vector<float> r( in.size() );
+    std::vector<float> d( in.size() );
+    scaled_octave_noise_3d( 8, 0.5, 0.03, 0, 1, in.x.data(), in.y.data(), in.z.data(), r.data(),
+                            in.size() );
+    scaled_octave_noise_3d( 12, 0.5, 0.07, 0, 1, in.x.data(), in.y.data(), in.z.data(), d.data(),
+                            in.size() );
+    for( size_t i = 0; i < in.size(); i++ ) {
+        // Round through float exactly as noise_at does.
+        const float rr = std::pow( r[i], 2.0f );
+        const float dd = std::pow( d[i], 3.0f );
+        r[i] = std::max( 0.0f, rr - dd * 0.5f );
+    }
+    return r;
+}
+
 float om_noise_layer_floodplain::noise_at( const point_om_omt &local_omt_pos ) const
 {
     const point_abs_omt p = global_omt_pos( local_omt_pos );
@@ -35,4 +96,31 @@ float om_noise_layer_lake::noise_at( const point_om_omt &local_omt_pos ) const
     return r;
 }
 
+std::vector<float> om_noise_layer_lake::noise_grid( const point_om_omt &min,
+        const point &size ) const
+{
+    const noise_grid_input in( global_omt_pos( min ), size, get_seed() );
+    std::vector<float> r( in.size() );
+    scaled_octave_noise_3d( 16, 0.5, 0.002, 0, 1, in.x.data(), in.y.data(), in.z.data(), r.data(),
+                            in.size() );
+    for( float &v : r ) {
+        v = std::pow( v, 4.0f );
+    }
+    return r;
+}
+
+om_noise_layer_cache::om_noise_layer_cache( const om_noise_layer &layer ) :
+    layer( layer ), values( layer.noise_grid( point_om_omt( 0, 0 ), point( OMAPX, OMAPY ) ) )
+{
+}
+
+float om_noise_layer_cache::noise_at( const point_om_omt &local_omt_pos ) const
+{
+    const point p = local_omt_pos.raw();
+    if( p.x < 0 || p.y < 0 || p.x >= OMAPX || p.y >= OMAPY ) {
+        return layer.noise_at( local_omt_pos );
+    }
+    return values[p.y * OMAPX + p.x];
+}
+
 } // namespace om_noise
@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_OVERMAP_NOISE_H
 #define CATA_SRC_OVERMAP_NOISE_H
 
+#include <vector>
+
 #include "coordinates.h"
 #include "game_constants.h"
 #include "point.h"
@@ -21,6 +23,12 @@ class om_noise_layer
          * @param omt_local point location in overmap terrain local coordinates.
          */
         virtual float noise_at( const point_om_omt &omt_local ) const = 0;
+        /**
+         * Noise values for the @p size rectangle of points starting at @p min, row by row
+         * (index is y * size.x + x). Matches noise_at for every point; subclasses override it
+         * to compute the whole rectangle with the batched noise functions.
+         */
+        virtual std::vector<float> noise_grid( const point_om_omt &min, const point &size ) const;
         virtual ~om_noise_layer() = default;
     protected:
         /**
@@ -56,6 +64,7 @@ class om_noise_layer_forest : public om_noise_layer
         }
 
         float noise_at( const point_om_omt &local_omt_pos ) const override;
+        std::vector<float> noise_grid( const point_om_omt &min, const point &size ) const override;
 };
 
 class om_noise_layer_floodplain : public om_noise_layer
@@ -76,6 +85,23 @@ class om_noise_layer_lake : public om_noise_layer
         }
 
         float noise_at( const point_om_omt &local_omt_pos ) const override;
+        std::vector<float> noise_grid( const point_om_omt &min, const point &size ) const override;
+};
+
+/**
+ * Noise of a layer precomputed for the whole overmap in one batch, for callers that look at
+ * (nearly) every point. Points outside the overmap fall back to the layer's noise_at.
+ */
+class om_noise_layer_cache
+{
+    public:
+        explicit om_noise_layer_cache( const om_noise_layer &layer );
+
+        float noise_at( const point_om_omt &local_omt_pos ) const;
+
+    private:
+        const om_noise_layer &layer;
+        std::vector<float> values;
 };
 
 } // namespace om_noise
@@ -202,15 +202,21 @@ static void update_note_preview( const std::string &note,
     wnoutrefresh( *w_preview_map );
 }
 
-static weather_type_id get_weather_at_point( const tripoint_abs_omt &pos )
+// Weather calculation is a bit expensive, so it's cached for the current turn.
+static std::map<tripoint_abs_omt, weather_type_id> &get_weather_cache()
 {
-    // Weather calculation is a bit expensive, so it's cached here.
     static std::map<tripoint_abs_omt, weather_type_id> weather_cache;
     static time_point last_weather_display = calendar::before_time_starts;
     if( last_weather_display != calendar::turn ) {
         last_weather_display = calendar::turn;
         weather_cache.clear();
     }
+    return weather_cache;
+}
+
+static weather_type_id get_weather_at_point( const tripoint_abs_omt &pos )
+{
+    std::map<tripoint_abs_omt, weather_type_id> &weather_cache = get_weather_cache();
     auto iter = weather_cache.find( pos );
     if( iter == weather_cache.end() ) {
         // TODO: fix point types
@@ -223,6 +229,32 @@ static weather_type_id get_weather_at_point( const tripoint_abs_omt &pos )
     return iter->second;
 }
 
+/** Fill the weather cache for all of @p points at once, see @ref get_weather_at_point. */
+static void prefetch_weather_at_points( const std::vector<tripoint_abs_omt> &points )
+{
+    std::map<tripoint_abs_omt, weather_type_id> &weather_cache = get_weather_cache();
+    // Batched per weather generator, as the points may span several regions.
+    std::map<const weather_generator *, std::vector<tripoint_abs_omt>> missing;
+    for( const tripoint_abs_omt &pos : points ) {
+        if( weather_cache.count( pos ) == 0 ) {
+            missing[&overmap_buffer.get_settings( pos ).weather].push_back( pos );
+        }
+    }
+    for( const auto &batch : missing ) {
+        std::vector<std::pair<tripoint, time_point>> queries;
+        queries.reserve( batch.second.size() );
+        for( const tripoint_abs_omt &pos : batch.second ) {
+            // TODO: fix point types
+            queries.emplace_back( project_to<coords::ms>( pos ).raw(), calendar::turn );
+        }
+        const std::vector<w_point> weather = batch.first->get_weather( queries, g->get_seed() );
+        for( size_t i = 0; i < weather.size(); ++i ) {
+            weather_cache.emplace( batch.second[i],
+                                   batch.first->get_weather_conditions( weather[i], g->weather.next_instance_allowed ) );
+        }
+    }
+}
+
 static bool get_scent_glyph( const tripoint_abs_omt &pos, nc_color &ter_color,
                              std::string &ter_sym )
 {
@@ -677,6 +709,17 @@ void draw(
         }
     }
 
+    if( viewing_weather ) {
+        std::vector<tripoint_abs_omt> weather_points;
+        weather_points.reserve( om_map_width * om_map_height );
+        for( int i = 0; i < om_map_width; ++i ) {
+            for( int j = 0; j < om_map_height; ++j ) {
+                weather_points.push_back( corner + point( i, j ) );
+            }
+        }
+        prefetch_weather_at_points( weather_points );
+    }
+
     for( int i = 0; i < om_map_width; ++i ) {
         for( int j = 0; j < om_map_height; ++j ) {
             const tripoint_abs_omt omp = corner + point( i, j );
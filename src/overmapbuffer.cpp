@@ -3,9 +3,11 @@
 #include <algorithm>
 #include <cassert>
 #include <climits>
+#include <functional>
 #include <iterator>
 #include <list>
 #include <map>
+#include <queue>
 #include <tuple>
 #include <type_traits>
 
@@ -32,6 +34,7 @@
 #include "optional.h"
 #include "overmap.h"
 #include "overmap_connection.h"
+#include "overmap_generation.h"
 #include "overmap_types.h"
 #include "path_info.h"
 #include "point.h"
@@ -47,10 +50,13 @@ class map_extra;
 overmapbuffer overmap_buffer;
 
 overmapbuffer::overmapbuffer()
-    : last_requested_overmap( nullptr )
+    : generation( std::make_unique<overmap_generation_service>() ),
+      last_requested_overmap( nullptr )
 {
 }
 
+overmapbuffer::~overmapbuffer() = default;
+
 const city_reference city_reference::invalid{ nullptr, tripoint_abs_sm(), -1 };
 
 int city_reference::get_distance_from_bounds() const
@@ -86,6 +92,18 @@ overmap &overmapbuffer::get( const point_abs_om &p )
         return *( last_requested_overmap = it->second.get() );
     }
 
+    if( std::unique_ptr<overmap> generated = generation->take( p ) ) {
+        return adopt_generated( std::move( generated ) );
+    }
+    // A neighbour generated later in the background would not see this overmap, so
+    // finish them first and generate this one from their borders.
+    for( om_direction::type dir : om_direction::all ) {
+        const point_abs_om neighbour = p + om_direction::displace( dir );
+        if( std::unique_ptr<overmap> generated = generation->take( neighbour ) ) {
+            adopt_generated( std::move( generated ) );
+        }
+    }
+
     // That constructor loads an existing overmap or creates a new one.
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
     new_om.populate();
@@ -98,6 +116,47 @@ overmap &overmapbuffer::get( const point_abs_om &p )
     return new_om;
 }
 
+overmap &overmapbuffer::adopt_generated( std::unique_ptr<overmap> om )
+{
+    overmap &new_om = *( overmaps[ om->pos() ] = std::move( om ) );
+    new_om.report_generation_errors();
+    new_om.place_deferred_specials();
+    fix_mongroups( new_om );
+    fix_npcs( new_om );
+    last_requested_overmap = &new_om;
+    return new_om;
+}
+
+void overmapbuffer::pregenerate_around( const point_abs_om &center, const int radius )
+{
+    for( std::unique_ptr<overmap> &generated : generation->take_finished() ) {
+        adopt_generated( std::move( generated ) );
+    }
+    if( g->gametype() == special_game_type::DEFENSE ) {
+        // Nothing is generated there, see overmap::open.
+        return;
+    }
+    for( const point_abs_om &p : closest_points_first( center, radius ) ) {
+        if( overmaps.count( p ) > 0 || generation->is_queued( p ) ||
+            file_exist( terrain_filename( p ) ) ) {
+            continue;
+        }
+        // Queued neighbours are waited for by the generation service, the others are
+        // looked up just like overmap::open does.
+        std::array<cata::optional<overmap_border>, 4> borders;
+        for( om_direction::type dir : om_direction::all ) {
+            const point_abs_om neighbour_pos = p + om_direction::displace( dir );
+            if( generation->is_queued( neighbour_pos ) ) {
+                continue;
+            }
+            if( const overmap *neighbour = get_existing( neighbour_pos ) ) {
+                borders[static_cast<int>( dir )] = neighbour->border( om_direction::opposite( dir ) );
+            }
+        }
+        generation->enqueue( std::make_unique<overmap>( p ), borders );
+    }
+}
+
 void overmapbuffer::create_custom_overmap( const point_abs_om &p, overmap_special_batch &specials )
 {
     if( last_requested_overmap != nullptr ) {
@@ -205,6 +264,7 @@ void overmapbuffer::save()
 
 void overmapbuffer::clear()
 {
+    generation->cancel();
     overmaps.clear();
     known_non_existing.clear();
     last_requested_overmap = nullptr;
@@ -261,6 +321,11 @@ overmap *overmapbuffer::get_existing( const point_abs_om &p )
     if( it != overmaps.end() ) {
         return last_requested_overmap = it->second.get();
     }
+    if( generation->is_queued( p ) ) {
+        // Being generated already, waiting for it is cheaper than what the caller
+        // would do about a missing overmap.
+        return &get( p );
+    }
     if( known_non_existing.count( p ) > 0 ) {
         // This overmap does not exist on disk (this has already been
         // checked in a previous call of this function).
@@ -706,6 +771,180 @@ std::vector<tripoint_abs_omt> overmapbuffer::get_npc_path( const tripoint_abs_om
     return get_npc_path( src, dest, ptype );
 }
 
+// Travel cost of a terrain for an NPC path, or -1 if the path can't go there. The parts
+// of the path type that depend on the player (seen, dangerous) are not considered here.
+static int npc_travel_cost( const oter_id &oter, const path_type &ptype )
+{
+    const bool is_road = is_ot_match( "road", oter, ot_match_type::type ) ||
+                         is_ot_match( "bridge", oter, ot_match_type::type ) ||
+                         is_ot_match( "road_nesw_manhole", oter, ot_match_type::type );
+    const bool is_open_air = is_ot_match( "open_air", oter, ot_match_type::type );
+    if( ptype.only_road && !is_road ) {
+        return -1;
+    }
+    if( ptype.only_water && !is_river_or_lake( oter ) ) {
+        return -1;
+    }
+    if( ptype.only_air && !is_open_air ) {
+        return -1;
+    }
+    int travel_cost = static_cast<int>( oter->get_travel_cost() );
+    if( is_ot_match( "empty_rock", oter, ot_match_type::type ) ) {
+        return -1;
+    } else if( is_open_air ) {
+        if( ptype.only_air ) {
+            travel_cost += 1;
+        } else {
+            return -1;
+        }
+    } else if( is_ot_match( "forest", oter, ot_match_type::type ) ) {
+        travel_cost = 10;
+    } else if( is_ot_match( "forest_water", oter, ot_match_type::type ) ) {
+        travel_cost = 15;
+    } else if( is_road ) {
+        travel_cost = 1;
+    } else if( is_river_or_lake( oter ) ) {
+        if( ptype.amphibious || ptype.only_water ) {
+            travel_cost = 1;
+        } else {
+            return -1;
+        }
+    }
+    return travel_cost;
+}
+
+const std::vector<int16_t> &overmapbuffer::travel_cost_raster( const overmap &om, int z,
+        const path_type &ptype )
+{
+    // Only these parts of the path type change the terrain costs.
+    const int kind = ( ptype.only_road ? 1 : 0 ) | ( ptype.only_water ? 2 : 0 ) |
+                     ( ptype.amphibious ? 4 : 0 ) | ( ptype.only_air ? 8 : 0 );
+    std::vector<int16_t> &raster = om.travel_cost_rasters[( z + OVERMAP_DEPTH ) * 16 + kind];
+    if( raster.empty() ) {
+        raster.resize( OMAPX * OMAPY );
+        const auto &terrain = om.layer[z + OVERMAP_DEPTH].terrain;
+        for( int y = 0; y < OMAPY; y++ ) {
+            for( int x = 0; x < OMAPX; x++ ) {
+                raster[y * OMAPX + x] = npc_travel_cost( terrain[x][y], ptype );
+            }
+        }
+    }
+    return raster;
+}
+
+/**
+ * Shortest route between two road tiles that only uses road tiles. The roads are contracted
+ * on the fly: only junctions, dead ends and the endpoints become graph nodes, the chains of
+ * road between them are walked as single weighted edges. Returns the tiles of the route from
+ * @p finish back to @p start, or nothing if there is none.
+ */
+template<typename IsRoad>
+static std::vector<point> find_road_path( const point &start, const point &finish,
+        const point &max, IsRoad is_road )
+{
+    std::vector<point> result;
+    const auto road_at = [&]( const point & p ) {
+        return p.x >= 0 && p.y >= 0 && p.x < max.x && p.y < max.y && is_road( p );
+    };
+    if( start == finish || !road_at( start ) || !road_at( finish ) ) {
+        return result;
+    }
+    const auto is_node = [&]( const point & p ) {
+        if( p == start || p == finish ) {
+            return true;
+        }
+        int neighbours = 0;
+        for( const point &offset : four_adjacent_offsets ) {
+            neighbours += road_at( p + offset ) ? 1 : 0;
+        }
+        return neighbours != 2;
+    };
+    // Follows the road leaving @p from in direction @p dir up to the next node, calling
+    // @p visit with every tile after @p from. Returns that node and the length of the chain.
+    const auto walk = [&]( const point & from, int dir, const std::function<void( const point & )>
+    &visit ) {
+        point prev = from;
+        point cur = from + four_adjacent_offsets[dir];
+        int length = 1;
+        while( true ) {
+            if( visit ) {
+                visit( cur );
+            }
+            if( is_node( cur ) ) {
+                break;
+            }
+            for( const point &offset : four_adjacent_offsets ) {
+                const point next = cur + offset;
+                if( next != prev && road_at( next ) ) {
+                    prev = cur;
+                    cur = next;
+                    break;
+                }
+            }
+            length++;
+        }
+        return std::make_pair( cur, length );
+    };
+
+    struct visited_node {
+        int cost;
+        point parent;
+        int dir;
+    };
+    std::unordered_map<point, visited_node> visited;
+    using open_node = std::pair<int, point>;
+    const auto cmp = []( const open_node & a, const open_node & b ) {
+        return a.first > b.first;
+    };
+    std::priority_queue<open_node, std::vector<open_node>, decltype( cmp )> open( cmp );
+    visited.emplace( start, visited_node{ 0, start, -1 } );
+    open.emplace( manhattan_dist( start, finish ), start );
+    while( !open.empty() ) {
+        const point cur = open.top().second;
+        const int cur_priority = open.top().first;
+        open.pop();
+        const int cur_cost = visited[cur].cost;
+        if( cur_priority != cur_cost + manhattan_dist( cur, finish ) ) {
+            // a stale entry, the node was reached cheaper since
+            continue;
+        }
+        if( cur == finish ) {
+            break;
+        }
+        for( int dir = 0; dir < 4; dir++ ) {
+            if( !road_at( cur + four_adjacent_offsets[dir] ) ) {
+                continue;
+            }
+            const std::pair<point, int> edge = walk( cur, dir, nullptr );
+            const int cost = cur_cost + edge.second;
+            const auto iter = visited.find( edge.first );
+            if( iter != visited.end() && iter->second.cost <= cost ) {
+                continue;
+            }
+            visited[edge.first] = visited_node{ cost, cur, dir };
+            open.emplace( cost + manhattan_dist( edge.first, finish ), edge.first );
+        }
+    }
+
+    if( visited.count( finish ) == 0 ) {
+        return result;
+    }
+    // Expand the chains of the route, from the start, then hand it out from the finish.
+    std::vector<point> nodes;
+    for( point p = finish; p != start; p = visited[p].parent ) {
+        nodes.push_back( p );
+    }
+    result.push_back( start );
+    for( auto iter = nodes.rbegin(); iter != nodes.rend(); ++iter ) {
+        const visited_node &node = visited[*iter];
+        walk( node.parent, node.dir, [&result]( const point & p ) {
+            result.push_back( p );
+        } );
+    }
+    std::reverse( result.begin(), result.end() );
+    return result;
+}
+
 std::vector<tripoint_abs_omt> overmapbuffer::get_npc_path(
     const tripoint_abs_omt &src, const tripoint_abs_omt &dest, path_type &ptype )
 {
@@ -724,59 +963,52 @@ std::vector<tripoint_abs_omt> overmapbuffer::get_npc_path(
     // Local destination - relative to base
     const point_rel_omt finish = ( dest - base ).xy();
 
-    const auto get_ter_at = [&]( const point_rel_omt & p ) {
-        return ter( base + p );
-    };
-    const auto estimate =
-    [&]( const pf::node<point_rel_omt> &cur, const pf::node<point_rel_omt> * ) {
-        const tripoint_abs_omt convert_result = base + tripoint_rel_omt( cur.pos, 0 );
-        if( ptype.only_known_by_player && !seen( convert_result ) ) {
-            return pf::rejected;
-        }
-        int res = 0;
-        const oter_id oter = get_ter_at( cur.pos );
-        int travel_cost = static_cast<int>( oter->get_travel_cost() );
-        if( ptype.avoid_danger && is_marked_dangerous( convert_result ) ) {
-            return pf::rejected;
+    // Neighbouring nodes mostly share an overmap, so remember the last one looked up.
+    point_abs_om last_om_pos;
+    const overmap *last_om = nullptr;
+    const std::vector<int16_t> *last_raster = nullptr;
+    // Travel cost of the terrain at the local point, -1 if the path can't go there.
+    const auto travel_cost_at = [&]( const point_rel_omt & p ) -> int {
+        const tripoint_abs_omt abs_p = base + p;
+        point_abs_om om_pos;
+        point_om_omt local;
+        std::tie( om_pos, local ) = project_remain<coords::om>( abs_p.xy() );
+        if( last_om == nullptr || om_pos != last_om_pos )
+        {
+            last_om = &get( om_pos );
+            last_om_pos = om_pos;
+            last_raster = &travel_cost_raster( *last_om, base.z(), ptype );
         }
-        if( ptype.only_road && ( !is_ot_match( "road", oter, ot_match_type::type ) &&
-                                 !is_ot_match( "bridge", oter, ot_match_type::type ) &&
-                                 !is_ot_match( "road_nesw_manhole", oter, ot_match_type::type ) ) ) {
-            return pf::rejected;
+        const tripoint_om_omt local_p( local, base.z() );
+        if( ptype.only_known_by_player && !last_om->seen( local_p ) )
+        {
+            return -1;
         }
-        if( ptype.only_water && !is_river_or_lake( oter ) ) {
-            return pf::rejected;
+        if( ptype.avoid_danger && last_om->is_marked_dangerous( local_p ) )
+        {
+            return -1;
         }
-        if( ptype.only_air && ( !is_ot_match( "open_air", oter, ot_match_type::type ) ) ) {
-            return pf::rejected;
+        return ( *last_raster )[local.y() * OMAPX + local.x()];
+    };
+
+    if( ptype.only_road ) {
+        const std::vector<point> route = find_road_path( start.raw(), finish.raw(), ( 2 * O ).raw(),
+        [&]( const point & p ) {
+            return travel_cost_at( point_rel_omt( p ) ) >= 0;
+        } );
+        for( const point &p : route ) {
+            path.push_back( base + point_rel_omt( p ) );
         }
-        if( is_ot_match( "empty_rock", oter, ot_match_type::type ) ) {
+        return path;
+    }
+
+    const auto estimate =
+    [&]( const pf::node<point_rel_omt> &cur, const pf::node<point_rel_omt> * ) {
+        const int travel_cost = travel_cost_at( cur.pos );
+        if( travel_cost < 0 ) {
             return pf::rejected;
-        } else if( is_ot_match( "open_air", oter, ot_match_type::type ) ) {
-            if( ptype.only_air ) {
-                travel_cost += 1;
-            } else {
-                return pf::rejected;
-            }
-        } else if( is_ot_match( "forest", oter, ot_match_type::type ) ) {
-            travel_cost = 10;
-        } else if( is_ot_match( "forest_water", oter, ot_match_type::type ) ) {
-            travel_cost = 15;
-        } else if( is_ot_match( "road", oter, ot_match_type::type ) ||
-                   is_ot_match( "bridge", oter, ot_match_type::type ) ||
-                   is_ot_match( "road_nesw_manhole", oter, ot_match_type::type ) ) {
-            travel_cost = 1;
-        } else if( is_river_or_lake( oter ) ) {
-            if( ptype.amphibious || ptype.only_water ) {
-                travel_cost = 1;
-            } else {
-                return pf::rejected;
-            }
         }
-        res += travel_cost;
-        res += manhattan_dist( finish, cur.pos );
-
-        return res;
+        return travel_cost + manhattan_dist( finish, cur.pos );
     };
     pf::path<point_rel_omt> route = pf::find_path( start, finish, 2 * O, estimate );
     for( auto node : route.nodes ) {
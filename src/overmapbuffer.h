@@ -3,6 +3,7 @@
 #define CATA_SRC_OVERMAPBUFFER_H
 
 #include <array>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <set>
@@ -28,6 +29,7 @@ class map_extra;
 class monster;
 class npc;
 class overmap;
+class overmap_generation_service;
 class overmap_special_batch;
 class vehicle;
 struct mongroup;
@@ -128,6 +130,7 @@ class overmapbuffer
 {
     public:
         overmapbuffer();
+        ~overmapbuffer();
 
         static std::string terrain_filename( const point_abs_om & );
         static std::string player_filename( const point_abs_om & );
@@ -140,6 +143,11 @@ class overmapbuffer
         void save();
         void clear();
         void create_custom_overmap( const point_abs_om &, overmap_special_batch &specials );
+        /**
+         * Starts generating the new overmaps within @p radius of @p center on background
+         * threads and adds those that are done by now.
+         */
+        void pregenerate_around( const point_abs_om &center, int radius = 1 );
 
         /**
          * Uses global overmap terrain coordinates, creates the
@@ -359,6 +367,8 @@ class overmapbuffer
          * Get an existing overmap, does not create a new one
          * and may return NULL if the requested overmap does not
          * exist.
+         * An overmap that is still being generated in the background counts as existing,
+         * this waits for it to be done.
          * (x,y) are global overmap coordinates (same as @ref get).
          */
         overmap *get_existing( const point_abs_om &p );
@@ -484,8 +494,18 @@ class overmapbuffer
          * see omt_find_params for definitions of the terms
          */
         bool is_findable_location( const tripoint_abs_omt &location, const omt_find_params &params );
+        /**
+         * Travel cost of each terrain of @p om on z-level @p z for NPC paths of type @p ptype,
+         * -1 where such paths can't go. Built once, see overmap::travel_cost_rasters.
+         */
+        const std::vector<int16_t> &travel_cost_raster( const overmap &om, int z,
+                const path_type &ptype );
+
+        /** Adds an overmap that was generated in the background. */
+        overmap &adopt_generated( std::unique_ptr<overmap> om );
 
         std::unordered_map< point_abs_om, std::unique_ptr< overmap > > overmaps;
+        std::unique_ptr<overmap_generation_service> generation;
         /**
          * Set of overmap coordinates of overmaps that are known
          * to not exist on disk. See @ref get_existing for usage.
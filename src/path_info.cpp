@@ -308,6 +308,10 @@ std::string PATH_INFO::panel_options()
 {
     return config_dir_value + "panel_options.json";
 }
+std::string PATH_INFO::profile_trace()
+{
+    return config_dir_value + "profile_trace.json";
+}
 std::string PATH_INFO::safemode()
 {
     return config_dir_value + "safemode.json";
@@ -47,6 +47,7 @@ std::string moddir();
 std::string options();
 std::string panel_options();
 std::string player_base_save_path();
+std::string profile_trace();
 std::string safemode();
 std::string savedir();
 std::string sokoban();
@@ -18,6 +18,7 @@
 #include "mapdata.h"
 #include "optional.h"
 #include "point.h"
+#include "profiler.h"
 #include "submap.h"
 #include "trap.h"
 #include "type_id.h"
@@ -181,6 +182,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                                   const pathfinding_settings &settings,
                                   const std::set<tripoint> &pre_closed ) const
 {
+    CATA_PROFILE_ZONE( "pathfinding" );
     /* TODO: If the origin or destination is out of bound, figure out the closest
      * in-bounds point and go to that, then to the real origin/destination.
      */
@@ -254,7 +254,7 @@ bool pick_one_up( item_location &loc, int quantity, bool &got_water, bool &offer
     // Handle charges, quantity == 0 means move all
     if( quantity != 0 && newit.count_by_charges() ) {
         if( newit.charges > quantity ) {
-            newit.charges = quantity;
+            newit.set_charges( quantity );
         }
     }
 
@@ -312,7 +312,7 @@ bool pick_one_up( item_location &loc, int quantity, bool &got_water, bool &offer
                 //using original item, possibly modifying it
                 picked_up = player_character.wield( it );
                 if( picked_up ) {
-                    player_character.weapon.charges = newit.charges;
+                    player_character.weapon.set_charges( newit.charges );
                 }
                 if( player_character.weapon.invlet ) {
                     add_msg( m_info, _( "Wielding %c - %s" ), player_character.weapon.invlet,
@@ -346,7 +346,7 @@ bool pick_one_up( item_location &loc, int quantity, bool &got_water, bool &offer
                 // failed to add, do nothing
             } else if( &added_it == &it ) {
                 // merged to the original stack, restore original charges
-                it.charges -= newit.charges;
+                it.set_charges( it.charges - newit.charges );
             } else {
                 // successfully added
                 auto &entry = mapPickup[newit.tname()];
@@ -364,7 +364,7 @@ bool pick_one_up( item_location &loc, int quantity, bool &got_water, bool &offer
         // since the total charges of the original item may have changed
         // due to merging.
         if( orig_it.charges > newit.charges ) {
-            orig_it.charges -= newit.charges;
+            orig_it.set_charges( orig_it.charges - newit.charges );
         } else {
             loc.remove_item();
         }
@@ -976,7 +976,7 @@ void Pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
                         // Make a copy for calculating weight/volume
                         item temp = *stacked_here[i].front();
                         if( temp.count_by_charges() && getitem[i].count < temp.charges && getitem[i].count != 0 ) {
-                            temp.charges = getitem[i].count;
+                            temp.set_charges( getitem[i].count );
                         }
                         int num_picked = std::min( stacked_here[i].size(),
                                                    getitem[i].count == 0 ? stacked_here[i].size() : getitem[i].count );
@@ -1796,7 +1796,7 @@ item player::reduce_charges( item *it, int quantity )
     }
     it->mod_charges( -quantity );
     item result( *it );
-    result.charges = quantity;
+    result.set_charges( quantity );
     return result;
 }
 
@@ -2657,7 +2657,7 @@ bool player::add_or_drop_with_msg( item &it, const bool /*unloading*/, const ite
             put_into_vehicle_or_drop( *this, item_drop_reason::tumbling, { it } );
         } else if( &ni == &it ) {
             // merged into the original stack, restore original charges
-            it.charges = prev_charges;
+            it.set_charges( prev_charges );
             put_into_vehicle_or_drop( *this, item_drop_reason::tumbling, { it } );
         } else {
             // successfully added
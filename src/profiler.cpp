@@ -0,0 +1,164 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+#include "cata_utility.h"
+#include "json.h"
+#include "translations.h"
+
+namespace
+{
+
+struct zone_event {
+    const char *name;
+    profiler::clock::time_point start;
+    profiler::clock::duration duration;
+};
+
+/** The zones recorded by one thread, the buffers outlive their threads. */
+struct thread_buffer {
+    std::mutex mutex;
+    std::vector<zone_event> events;
+    /** The events before this index belong to earlier turns. */
+    size_t turn_start = 0;
+    int id = 0;
+};
+
+} // namespace
+
+/** Upper limit of zones recorded per thread, about 24 MiB. */
+static constexpr size_t max_events_per_thread = 1 << 20;
+
+static std::atomic<bool> profiler_recording( false );
+static std::mutex buffers_mutex;
+static std::vector<std::shared_ptr<thread_buffer>> buffers;
+static profiler::clock::time_point recording_start;
+static std::vector<std::pair<std::string, double>> last_turn_times;
+
+static thread_buffer &local_buffer()
+{
+    static thread_local std::shared_ptr<thread_buffer> buffer = []() {
+        std::shared_ptr<thread_buffer> new_buffer = std::make_shared<thread_buffer>();
+        std::lock_guard<std::mutex> lock( buffers_mutex );
+        new_buffer->id = static_cast<int>( buffers.size() );
+        buffers.push_back( new_buffer );
+        return new_buffer;
+    }();
+    return *buffer;
+}
+
+static double to_microseconds( const profiler::clock::duration &d )
+{
+    return std::chrono::duration<double, std::micro>( d ).count();
+}
+
+bool profiler::enabled()
+{
+    return profiler_recording.load( std::memory_order_relaxed );
+}
+
+void profiler::enable()
+{
+    std::lock_guard<std::mutex> lock( buffers_mutex );
+    for( const std::shared_ptr<thread_buffer> &buffer : buffers ) {
+        std::lock_guard<std::mutex> buffer_lock( buffer->mutex );
+        buffer->events.clear();
+        buffer->turn_start = 0;
+    }
+    last_turn_times.clear();
+    recording_start = clock::now();
+    profiler_recording.store( true );
+}
+
+void profiler::disable()
+{
+    profiler_recording.store( false );
+}
+
+profiler::zone::zone( const char *name ) : name( name ), recording( enabled() )
+{
+    if( recording ) {
+        start = clock::now();
+    }
+}
+
+profiler::zone::~zone()
+{
+    if( !recording ) {
+        return;
+    }
+    const clock::duration duration = clock::now() - start;
+    thread_buffer &buffer = local_buffer();
+    std::lock_guard<std::mutex> lock( buffer.mutex );
+    if( buffer.events.size() < max_events_per_thread ) {
+        buffer.events.push_back( { name, start, duration } );
+    }
+}
+
+void profiler::end_turn()
+{
+    if( !enabled() ) {
+        return;
+    }
+    last_turn_times.clear();
+    thread_buffer &buffer = local_buffer();
+    std::lock_guard<std::mutex> lock( buffer.mutex );
+    // Zones are recorded when they end, sort them back into the order they were entered.
+    std::vector<const zone_event *> turn;
+    for( size_t i = buffer.turn_start; i < buffer.events.size(); ++i ) {
+        turn.push_back( &buffer.events[i] );
+    }
+    std::stable_sort( turn.begin(), turn.end(), []( const zone_event * a, const zone_event * b ) {
+        return a->start < b->start;
+    } );
+    for( const zone_event *event : turn ) {
+        const auto iter = std::find_if( last_turn_times.begin(), last_turn_times.end(),
+        [event]( const std::pair<std::string, double> &entry ) {
+            return entry.first == event->name;
+        } );
+        const double ms = to_microseconds( event->duration ) / 1000.0;
+        if( iter == last_turn_times.end() ) {
+            last_turn_times.emplace_back( event->name, ms );
+        } else {
+            iter->second += ms;
+        }
+    }
+    buffer.turn_start = buffer.events.size();
+}
+
+const std::vector<std::pair<std::string, double>> &profiler::last_turn()
+{
+    return last_turn_times;
+}
+
+bool profiler::write_trace( const std::string &path )
+{
+    std::lock_guard<std::mutex> lock( buffers_mutex );
+    return write_to_file( path, [&]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_object();
+        jsout.member( "displayTimeUnit", "ms" );
+        jsout.member( "traceEvents" );
+        jsout.start_array();
+        for( const std::shared_ptr<thread_buffer> &buffer : buffers ) {
+            std::lock_guard<std::mutex> buffer_lock( buffer->mutex );
+            for( const zone_event &event : buffer->events ) {
+                jsout.start_object();
+                jsout.member( "name", event.name );
+                jsout.member( "ph", "X" );
+                jsout.member( "ts", to_microseconds( event.start - recording_start ) );
+                jsout.member( "dur", to_microseconds( event.duration ) );
+                jsout.member( "pid", 0 );
+                jsout.member( "tid", buffer->id );
+                jsout.end_object();
+            }
+        }
+        jsout.end_array();
+        jsout.end_object();
+    }, _( "profiler trace" ) );
+}
@@ -0,0 +1,68 @@
+#pragma once
+#ifndef CATA_SRC_PROFILER_H
+#define CATA_SRC_PROFILER_H
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Timing of the hot paths of the game, zones are placed with @ref CATA_PROFILE_ZONE.
+ *
+ * While the profiler is enabled, each zone is recorded into a buffer of the thread it
+ * ran on. The recording can be written as a Chrome trace, to be opened with
+ * chrome://tracing or Perfetto, and the zones of the last turn are summed up by name.
+ * While it is disabled a zone costs one atomic load.
+ */
+namespace profiler
+{
+
+using clock = std::chrono::steady_clock;
+
+bool enabled();
+/** Starts recording, dropping anything recorded before. */
+void enable();
+/** Stops recording, what was recorded is kept for @ref write_trace. */
+void disable();
+
+/** Times the scope it lives in, if the profiler was enabled when it started. */
+class zone
+{
+    public:
+        /** @p name is kept as is, it has to be a string literal. */
+        explicit zone( const char *name );
+        ~zone();
+
+        zone( const zone & ) = delete;
+        zone &operator=( const zone & ) = delete;
+
+    private:
+        const char *name;
+        clock::time_point start;
+        bool recording;
+};
+
+/**
+ * Ends a game turn: the zones the calling thread ran since the previous call are
+ * summed up into @ref last_turn.
+ */
+void end_turn();
+/** Milliseconds spent in each zone during the last turn, in the order they were entered. */
+const std::vector<std::pair<std::string, double>> &last_turn();
+
+/** Writes all recorded zones as Chrome trace_event JSON, returns false if that failed. */
+bool write_trace( const std::string &path );
+
+} // namespace profiler
+
+#if defined(CATA_PROFILER)
+#define CATA_PROFILE_ZONE_CONCAT( a, b ) a##b
+#define CATA_PROFILE_ZONE_VAR( line ) CATA_PROFILE_ZONE_CONCAT( profile_zone_, line )
+/** Times the rest of the enclosing scope as zone @p name, compiled out without CATA_PROFILER. */
+#define CATA_PROFILE_ZONE( name ) const profiler::zone CATA_PROFILE_ZONE_VAR( __LINE__ )( name )
+#else
+#define CATA_PROFILE_ZONE( name )
+#endif
+
+#endif // CATA_SRC_PROFILER_H
@@ -486,14 +486,14 @@ item recipe::create_result() const
 {
     item newit( result_, calendar::turn, item::default_charges_tag{} );
     if( charges ) {
-        newit.charges = *charges;
+        newit.set_charges( *charges );
     }
 
     if( !newit.craft_has_charges() ) {
-        newit.charges = 0;
+        newit.set_charges( 0 );
     } else if( result_mult != 1 ) {
         // TODO: Make it work for charge-less items
-        newit.charges *= result_mult;
+        newit.set_charges( newit.charges * result_mult );
     }
 
     if( contained ) {
@@ -521,7 +521,7 @@ std::vector<item> recipe::create_results( int batch ) const
         }
     } else {
         item newit = create_result();
-        newit.charges *= batch;
+        newit.set_charges( newit.charges * batch );
         items.push_back( newit );
     }
 
@@ -534,16 +534,16 @@ std::vector<item> recipe::create_byproducts( int batch ) const
     for( const auto &e : byproducts ) {
         item obj( e.first, calendar::turn, item::default_charges_tag{} );
         if( obj.has_flag( "VARSIZE" ) ) {
-            obj.item_tags.insert( "FIT" );
+            obj.set_flag( "FIT" );
         }
 
         if( obj.count_by_charges() ) {
-            obj.charges *= e.second * batch;
+            obj.set_charges( obj.charges * ( e.second * batch ) );
             bps.push_back( obj );
 
         } else {
             if( !obj.craft_has_charges() ) {
-                obj.charges = 0;
+                obj.set_charges( 0 );
             }
             for( int i = 0; i < e.second * batch; ++i ) {
                 bps.push_back( obj );
@@ -0,0 +1,113 @@
+#include "recipe_availability.h"
+
+#include <utility>
+
+#include "crafting.h"
+#include "crafting_inventory_view.h"
+#include "item.h"
+#include "itype.h"
+#include "recipe.h"
+#include "recipe_dictionary.h"
+#include "requirements.h"
+#include "type_id.h"
+#include "visitable.h"
+
+static const flag_id flag_FROZEN( "FROZEN" );
+
+bool recipe_availability_cache::item_summary::operator==( const item_summary &rhs ) const
+{
+    return amount == rhs.amount && charges == rhs.charges && rotten == rhs.rotten &&
+           frozen == rhs.frozen && no_component == rhs.no_component && filthy == rhs.filthy &&
+           full == rhs.full;
+}
+
+void recipe_availability_cache::update( const crafting_inventory_view &inv, bool debug_hs )
+{
+    if( debug_hs != this->debug_hs ) {
+        clear();
+        this->debug_hs = debug_hs;
+    }
+
+    std::unordered_map<itype_id, item_summary> current;
+    inv.visit_items( [&current]( const item * e ) {
+        item_summary &s = current[e->typeId()];
+        s.amount++;
+        s.charges += e->count_by_charges() ? e->charges : e->ammo_remaining();
+        if( e->rotten() ) {
+            s.rotten++;
+        }
+        if( e->has_flag( flag_FROZEN ) ) {
+            s.frozen++;
+        }
+        if( !e->allow_crafting_component() ) {
+            s.no_component++;
+        }
+        if( e->is_filthy() ) {
+            s.filthy++;
+        }
+        if( e->is_magazine() && e->ammo_remaining() > 0 &&
+            e->ammo_remaining() >= e->ammo_capacity( e->ammo_data()->ammo->type ) ) {
+            s.full++;
+        }
+        return VisitResponse::NEXT;
+    } );
+
+    if( !entries.empty() ) {
+        for( const auto &e : current ) {
+            const auto iter = summary.find( e.first );
+            if( iter == summary.end() || iter->second != e.second ) {
+                forget_recipes_using( e.first );
+            }
+        }
+        for( const auto &e : summary ) {
+            if( current.count( e.first ) == 0 ) {
+                forget_recipes_using( e.first );
+            }
+        }
+    }
+    summary = std::move( current );
+}
+
+void recipe_availability_cache::forget_recipes_using( const itype_id &type )
+{
+    for( const recipe *r : recipe_dict.using_item( type ) ) {
+        entries.erase( r );
+    }
+    for( const auto &qual : type->qualities ) {
+        for( const recipe *r : recipe_dict.using_quality( qual.first ) ) {
+            entries.erase( r );
+        }
+    }
+}
+
+const recipe_availability_cache::entry &recipe_availability_cache::get( const recipe &r,
+        const crafting_inventory_view &inv )
+{
+    const auto iter = entries.find( &r );
+    if( iter != entries.end() ) {
+        return iter->second;
+    }
+
+    entry result;
+    const auto all_items_filter = r.get_component_filter( recipe_filter_flags::none );
+    const auto no_rotten_filter = r.get_component_filter( recipe_filter_flags::no_rotten );
+    const deduped_requirement_data &req = r.deduped_requirements();
+    result.can_craft = req.can_make_with_inventory( inv, all_items_filter, 1,
+                       craft_flags::start_only );
+    result.can_craft_non_rotten = req.can_make_with_inventory( inv, no_rotten_filter, 1,
+                                  craft_flags::start_only );
+    result.apparently_craftable = r.simple_requirements().can_make_with_inventory( inv,
+                                  all_items_filter, 1, craft_flags::start_only );
+    return entries.emplace( &r, result ).first->second;
+}
+
+bool recipe_availability_cache::is_cached( const recipe &r ) const
+{
+    return entries.count( &r ) > 0;
+}
+
+void recipe_availability_cache::clear()
+{
+    summary.clear();
+    entries.clear();
+}
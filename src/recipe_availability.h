@@ -0,0 +1,63 @@
+#pragma once
+#ifndef CATA_SRC_RECIPE_AVAILABILITY_H
+#define CATA_SRC_RECIPE_AVAILABILITY_H
+
+#include <unordered_map>
+
+#include "type_id.h"
+
+class crafting_inventory_view;
+class recipe;
+
+/**
+ * Remembers whether a character had the tools and components for each recipe. When the items
+ * around the character change only the recipes using a changed item type (or a quality such
+ * an item provides) are checked again, see @ref recipe_dictionary::using_item.
+ * Proficiencies are not part of the cached result, they are cheap to check.
+ */
+class recipe_availability_cache
+{
+    public:
+        struct entry {
+            bool can_craft = false;
+            bool can_craft_non_rotten = false;
+            bool apparently_craftable = false;
+        };
+
+        /**
+         * Compares the items of @p inv with the ones seen by the last update and forgets
+         * the results of the recipes affected by the differences.
+         */
+        void update( const crafting_inventory_view &inv, bool debug_hs );
+        /** Returns the result for a single crafted batch of @p r, checking it if unknown. */
+        const entry &get( const recipe &r, const crafting_inventory_view &inv );
+        bool is_cached( const recipe &r ) const;
+        void clear();
+
+    private:
+        /** What the requirement checks can tell apart about the items of one type. */
+        struct item_summary {
+            int amount = 0;
+            int charges = 0;
+            int rotten = 0;
+            int frozen = 0;
+            /** Items that are not usable as components as they are, e.g. non-empty containers. */
+            int no_component = 0;
+            int filthy = 0;
+            /** Magazines as full as they get, the only ones FULL_MAGAZINE recipes accept. */
+            int full = 0;
+
+            bool operator==( const item_summary &rhs ) const;
+            bool operator!=( const item_summary &rhs ) const {
+                return !( *this == rhs );
+            }
+        };
+
+        void forget_recipes_using( const itype_id &type );
+
+        std::unordered_map<itype_id, item_summary> summary;
+        std::unordered_map<const recipe *, entry> entries;
+        bool debug_hs = false;
+};
+
+#endif // CATA_SRC_RECIPE_AVAILABILITY_H
@@ -44,8 +44,12 @@ void delete_if( std::map<recipe_id, recipe> &data,
 
 } // namespace
 
+static const itype_id itype_UPS_off( "UPS_off" );
+static const itype_id itype_adv_UPS_off( "adv_UPS_off" );
+
 static recipe null_recipe;
 static std::set<const recipe *> null_match;
+static const std::vector<const recipe *> null_recipes;
 
 static DynamicDataLoader::deferred_json deferred;
 
@@ -88,17 +92,6 @@ bool search_reqs( group gp, const std::string &txt )
         } );
     } );
 }
-// template specialization to make component searches easier
-template<>
-bool search_reqs( std::vector<std::vector<item_comp> >  gp,
-                  const std::string &txt )
-{
-    return std::any_of( gp.begin(), gp.end(), [&]( const std::vector<item_comp> &opts ) {
-        return std::any_of( opts.begin(), opts.end(), [&]( const item_comp & ic ) {
-            return lcmatch( item::nname( ic.type ), txt );
-        } );
-    } );
-}
 
 std::vector<const recipe *> recipe_subset::favorite() const
 {
@@ -147,6 +140,16 @@ std::vector<const recipe *> recipe_subset::search( const std::string &txt,
 {
     std::vector<const recipe *> res;
 
+    // Match each component type only once instead of once per recipe using it
+    std::set<const recipe *> matching_components;
+    if( key == search_type::component ) {
+        for( const auto &e : component ) {
+            if( lcmatch( item::nname( e.first ), txt ) ) {
+                matching_components.insert( e.second.begin(), e.second.end() );
+            }
+        }
+    }
+
     std::copy_if( recipes.begin(), recipes.end(), std::back_inserter( res ), [&]( const recipe * r ) {
         if( !*r || r->obsolete ) {
             return false;
@@ -162,7 +165,7 @@ std::vector<const recipe *> recipe_subset::search( const std::string &txt,
                 return lcmatch( r->skill_used->name(), txt );
 
             case search_type::component:
-                return search_reqs( r->simple_requirements().get_components(), txt );
+                return matching_components.count( r ) > 0;
 
             case search_type::tool:
                 return search_reqs( r->simple_requirements().get_tools(), txt );
@@ -218,15 +221,15 @@ recipe_subset recipe_subset::difference( const recipe_subset &subset ) const
 
 std::vector<const recipe *> recipe_subset::search_result( const itype_id &item ) const
 {
+    const std::vector<const recipe *> &producing = recipe_dict.producing( item );
     std::vector<const recipe *> res;
 
-    std::copy_if( recipes.begin(), recipes.end(), std::back_inserter( res ), [&]( const recipe * r ) {
-        if( r->obsolete ) {
-            return false;
-        }
-        return item == r->result() ||
-               ( r->has_byproducts() && r->byproducts.find( item ) != r->byproducts.end() );
+    std::copy_if( producing.begin(), producing.end(), std::back_inserter( res ),
+    [&]( const recipe * r ) {
+        return recipes.count( r ) > 0;
     } );
+    // Keep the order of the subset
+    std::sort( res.begin(), res.end() );
 
     return res;
 }
@@ -466,6 +469,75 @@ void recipe_dictionary::finalize()
     }
 
     recipe_dict.find_items_on_loops();
+    recipe_dict.build_indexes();
+}
+
+void recipe_dictionary::build_indexes()
+{
+    recipes_using_item.clear();
+    recipes_using_quality.clear();
+    recipes_producing.clear();
+
+    const auto add_unique = []( std::vector<const recipe *> &vec, const recipe * r ) {
+        if( vec.empty() || vec.back() != r ) {
+            vec.push_back( r );
+        }
+    };
+
+    for( const auto &e : recipes ) {
+        const recipe *r = &e.second;
+        if( r->obsolete ) {
+            continue;
+        }
+        const requirement_data &reqs = r->simple_requirements();
+        bool uses_charges = false;
+        for( const auto &opts : reqs.get_components() ) {
+            for( const item_comp &comp : opts ) {
+                add_unique( recipes_using_item[comp.type], r );
+            }
+        }
+        for( const auto &opts : reqs.get_tools() ) {
+            for( const tool_comp &tool : opts ) {
+                add_unique( recipes_using_item[tool.type], r );
+                uses_charges = uses_charges || tool.by_charges();
+            }
+        }
+        // Tools with the USE_UPS flag may draw their charges from any UPS
+        if( uses_charges ) {
+            add_unique( recipes_using_item[itype_UPS_off], r );
+            add_unique( recipes_using_item[itype_adv_UPS_off], r );
+        }
+        for( const auto &opts : reqs.get_qualities() ) {
+            for( const quality_requirement &qual : opts ) {
+                add_unique( recipes_using_quality[qual.type], r );
+            }
+        }
+
+        add_unique( recipes_producing[r->result()], r );
+        if( r->has_byproducts() ) {
+            for( const auto &bp : r->byproducts ) {
+                add_unique( recipes_producing[bp.first], r );
+            }
+        }
+    }
+}
+
+const std::vector<const recipe *> &recipe_dictionary::using_item( const itype_id &id ) const
+{
+    const auto iter = recipes_using_item.find( id );
+    return iter != recipes_using_item.end() ? iter->second : null_recipes;
+}
+
+const std::vector<const recipe *> &recipe_dictionary::using_quality( const quality_id &id ) const
+{
+    const auto iter = recipes_using_quality.find( id );
+    return iter != recipes_using_quality.end() ? iter->second : null_recipes;
+}
+
+const std::vector<const recipe *> &recipe_dictionary::producing( const itype_id &id ) const
+{
+    const auto iter = recipes_producing.find( id );
+    return iter != recipes_producing.end() ? iter->second : null_recipes;
 }
 
 void recipe_dictionary::reset()
@@ -475,6 +547,9 @@ void recipe_dictionary::reset()
     recipe_dict.recipes.clear();
     recipe_dict.uncraft.clear();
     recipe_dict.items_on_loops.clear();
+    recipe_dict.recipes_using_item.clear();
+    recipe_dict.recipes_using_quality.clear();
+    recipe_dict.recipes_producing.clear();
 }
 
 void recipe_dictionary::delete_if( const std::function<bool( const recipe & )> &pred )
@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -41,6 +42,13 @@ class recipe_dictionary
 
         bool is_item_on_loop( const itype_id & ) const;
 
+        /** Returns all recipes using the item as a component or tool in any alternative */
+        const std::vector<const recipe *> &using_item( const itype_id &id ) const;
+        /** Returns all recipes requiring the tool quality at any level */
+        const std::vector<const recipe *> &using_quality( const quality_id &id ) const;
+        /** Returns all recipes having the item as their result or a byproduct */
+        const std::vector<const recipe *> &producing( const itype_id &id ) const;
+
         /** Returns disassembly recipe (or null recipe if no match) */
         static const recipe &get_uncraft( const itype_id &id );
 
@@ -66,9 +74,14 @@ class recipe_dictionary
         std::set<const recipe *> autolearn;
         std::set<const recipe *> blueprints;
         std::unordered_set<itype_id> items_on_loops;
+        /** Inverted indexes from requirements and results to the recipes, see @ref using_item */
+        std::unordered_map<itype_id, std::vector<const recipe *>> recipes_using_item;
+        std::unordered_map<quality_id, std::vector<const recipe *>> recipes_using_quality;
+        std::unordered_map<itype_id, std::vector<const recipe *>> recipes_producing;
 
         static void finalize_internal( std::map<recipe_id, recipe> &obj );
         void find_items_on_loops();
+        void build_indexes();
 };
 
 extern recipe_dictionary recipe_dict;
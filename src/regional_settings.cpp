@@ -1039,6 +1039,15 @@ overmap_special_id building_bin::pick() const
     return *buildings.pick();
 }
 
+std::vector<overmap_special_id> building_bin::get_all_buildings() const
+{
+    std::vector<overmap_special_id> result;
+    for( const weighted_object<int, overmap_special_id> &building : buildings ) {
+        result.push_back( building.obj );
+    }
+    return result;
+}
+
 void building_bin::clear()
 {
     finalized = false;
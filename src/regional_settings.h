@@ -32,6 +32,8 @@ class building_bin
         building_bin() = default;
         void add( const overmap_special_id &building, int weight );
         overmap_special_id pick() const;
+        /** All buildings of the bin, the terrains among them turned into specials already */
+        std::vector<overmap_special_id> get_all_buildings() const;
         std::vector<std::string> all;
         void clear();
         void finalize();
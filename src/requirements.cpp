@@ -16,6 +16,7 @@
 #include "cata_utility.h"
 #include "character.h"
 #include "color.h"
+#include "crafting_inventory_view.h"
 #include "debug.h"
 #include "enum_traits.h"
 #include "game.h"
@@ -641,7 +642,8 @@ std::vector<std::string> requirement_data::get_folded_tools_list( int width, nc_
     return output_buffer;
 }
 
-bool requirement_data::can_make_with_inventory( const inventory &crafting_inv,
+template<typename Inventory>
+bool requirement_data::can_make_with_inventory( const Inventory &crafting_inv,
         const std::function<bool( const item & )> &filter, int batch, craft_flags flags ) const
 {
     if( get_player_character().has_trait( trait_DEBUG_HS ) ) {
@@ -665,8 +667,8 @@ bool requirement_data::can_make_with_inventory( const inventory &crafting_inv,
     return retval;
 }
 
-template<typename T>
-bool requirement_data::has_comps( const inventory &crafting_inv,
+template<typename Inventory, typename T>
+bool requirement_data::has_comps( const Inventory &crafting_inv,
                                   const std::vector< std::vector<T> > &vec,
                                   const std::function<bool( const item & )> &filter,
                                   int batch, craft_flags flags )
@@ -702,8 +704,9 @@ bool requirement_data::has_comps( const inventory &crafting_inv,
     return retval;
 }
 
+template<typename Inventory>
 bool quality_requirement::has(
-    const inventory &crafting_inv, const std::function<bool( const item & )> &, int,
+    const Inventory &crafting_inv, const std::function<bool( const item & )> &, int,
     craft_flags, const std::function<void( int )> & ) const
 {
     if( get_player_character().has_trait( trait_DEBUG_HS ) ) {
@@ -722,8 +725,9 @@ nc_color quality_requirement::get_color( bool has_one, const inventory &,
     return has_one ? c_dark_gray : c_red;
 }
 
+template<typename Inventory>
 bool tool_comp::has(
-    const inventory &crafting_inv, const std::function<bool( const item & )> &filter, int batch,
+    const Inventory &crafting_inv, const std::function<bool( const item & )> &filter, int batch,
     craft_flags flags, const std::function<void( int )> &visitor ) const
 {
     if( get_player_character().has_trait( trait_DEBUG_HS ) ) {
@@ -754,8 +758,9 @@ nc_color tool_comp::get_color( bool has_one, const inventory &crafting_inv,
     return has_one ? c_dark_gray : c_red;
 }
 
+template<typename Inventory>
 bool item_comp::has(
-    const inventory &crafting_inv, const std::function<bool( const item & )> &filter, int batch,
+    const Inventory &crafting_inv, const std::function<bool( const item & )> &filter, int batch,
     craft_flags, const std::function<void( int )> & ) const
 {
     if( get_player_character().has_trait( trait_DEBUG_HS ) ) {
@@ -794,7 +799,8 @@ const T *requirement_data::find_by_type( const std::vector< std::vector<T> > &ve
     return nullptr;
 }
 
-bool requirement_data::check_enough_materials( const inventory &crafting_inv,
+template<typename Inventory>
+bool requirement_data::check_enough_materials( const Inventory &crafting_inv,
         const std::function<bool( const item & )> &filter, int batch ) const
 {
     bool retval = true;
@@ -812,8 +818,10 @@ bool requirement_data::check_enough_materials( const inventory &crafting_inv,
     return retval;
 }
 
-bool requirement_data::check_enough_materials( const item_comp &comp, const inventory &crafting_inv,
-        const std::function<bool( const item & )> &filter, int batch ) const
+template<typename Inventory>
+bool requirement_data::check_enough_materials( const item_comp &comp,
+        const Inventory &crafting_inv, const std::function<bool( const item & )> &filter,
+        int batch ) const
 {
     if( comp.available != available_status::a_true ) {
         return false;
@@ -1432,8 +1440,9 @@ deduped_requirement_data::deduped_requirement_data( const requirement_data &in,
     }
 }
 
+template<typename Inventory>
 bool deduped_requirement_data::can_make_with_inventory(
-    const inventory &crafting_inv, const std::function<bool( const item & )> &filter,
+    const Inventory &crafting_inv, const std::function<bool( const item & )> &filter,
     int batch, craft_flags flags ) const
 {
     return std::any_of( alternatives().begin(), alternatives().end(),
@@ -1470,3 +1479,30 @@ const requirement_data *deduped_requirement_data::select_alternative(
         feasible_alternatives( inv, filter, batch, flags );
     return crafter.select_requirements( all_reqs, 1, inv, filter );
 }
+
+// explicit template initialization for the inventory types requirements are checked against
+template bool quality_requirement::has( const inventory &,
+                                        const std::function<bool( const item & )> &, int, craft_flags,
+                                        const std::function<void( int )> & ) const;
+template bool quality_requirement::has( const crafting_inventory_view &,
+                                        const std::function<bool( const item & )> &, int, craft_flags,
+                                        const std::function<void( int )> & ) const;
+template bool tool_comp::has( const inventory &, const std::function<bool( const item & )> &,
+                              int, craft_flags, const std::function<void( int )> & ) const;
+template bool tool_comp::has( const crafting_inventory_view &,
+                              const std::function<bool( const item & )> &, int, craft_flags,
+                              const std::function<void( int )> & ) const;
+template bool item_comp::has( const inventory &, const std::function<bool( const item & )> &,
+                              int, craft_flags, const std::function<void( int )> & ) const;
+template bool item_comp::has( const crafting_inventory_view &,
+                              const std::function<bool( const item & )> &, int, craft_flags,
+                              const std::function<void( int )> & ) const;
+template bool requirement_data::can_make_with_inventory( const inventory &,
+        const std::function<bool( const item & )> &, int, craft_flags ) const;
+template bool requirement_data::can_make_with_inventory( const crafting_inventory_view &,
+        const std::function<bool( const item & )> &, int, craft_flags ) const;
+template bool deduped_requirement_data::can_make_with_inventory( const inventory &,
+        const std::function<bool( const item & )> &, int, craft_flags ) const;
+template bool deduped_requirement_data::can_make_with_inventory(
+    const crafting_inventory_view &, const std::function<bool( const item & )> &, int,
+    craft_flags ) const;
@@ -91,7 +91,8 @@ struct tool_comp : public component {
 
     void load( const JsonValue &value );
     void dump( JsonOut &jsout ) const;
-    bool has( const inventory &crafting_inv, const std::function<bool( const item & )> &filter,
+    template<typename Inventory>
+    bool has( const Inventory &crafting_inv, const std::function<bool( const item & )> &filter,
               int batch = 1, craft_flags = craft_flags::none,
               const std::function<void( int )> &visitor = std::function<void( int )>() ) const;
     std::string to_string( int batch = 1, int avail = 0 ) const;
@@ -109,7 +110,8 @@ struct item_comp : public component {
 
     void load( const JsonValue &value );
     void dump( JsonOut &jsout ) const;
-    bool has( const inventory &crafting_inv, const std::function<bool( const item & )> &filter,
+    template<typename Inventory>
+    bool has( const Inventory &crafting_inv, const std::function<bool( const item & )> &filter,
               int batch = 1, craft_flags = craft_flags::none,
               const std::function<void( int )> &visitor = std::function<void( int )>() ) const;
     std::string to_string( int batch = 1, int avail = 0 ) const;
@@ -148,7 +150,8 @@ struct quality_requirement {
 
     void load( const JsonValue &value );
     void dump( JsonOut &jsout ) const;
-    bool has( const inventory &crafting_inv, const std::function<bool( const item & )> &filter,
+    template<typename Inventory>
+    bool has( const Inventory &crafting_inv, const std::function<bool( const item & )> &filter,
               int = 0, craft_flags = craft_flags::none,
               const std::function<void( int )> &visitor = std::function<void( int )>() ) const;
     std::string to_string( int batch = 1, int avail = 0 ) const;
@@ -190,8 +193,8 @@ struct enum_traits<requirement_display_flags> {
  * Load from an entry of a json array:
  *   void load(const JsonValue &value);
  * Check whether the player has fulfills the requirement with this crafting
- * inventory (or by mutation):
- *   bool has(const inventory &crafting_inv) const;
+ * inventory or crafting_inventory_view (or by mutation):
+ *   bool has(const Inventory &crafting_inv) const;
  * A textual representation of the requirement:
  *   std::string to_string() const;
  * Consistency check:
@@ -309,10 +312,12 @@ struct requirement_data {
 
         /**
          * Returns true if the requirements are fufilled by the filtered inventory
+         * (an inventory or a crafting_inventory_view).
          * @param filter should be recipe::get_component_filter() if used with a recipe
          * or is_crafting_component otherwise.
          */
-        bool can_make_with_inventory( const inventory &crafting_inv,
+        template<typename Inventory>
+        bool can_make_with_inventory( const Inventory &crafting_inv,
                                       const std::function<bool( const item & )> &filter, int batch = 1,
                                       craft_flags = craft_flags::none ) const;
 
@@ -360,9 +365,11 @@ struct requirement_data {
 
         bool blacklisted = false;
 
-        bool check_enough_materials( const inventory &crafting_inv,
+        template<typename Inventory>
+        bool check_enough_materials( const Inventory &crafting_inv,
                                      const std::function<bool( const item & )> &filter, int batch = 1 ) const;
-        bool check_enough_materials( const item_comp &comp, const inventory &crafting_inv,
+        template<typename Inventory>
+        bool check_enough_materials( const item_comp &comp, const Inventory &crafting_inv,
                                      const std::function<bool( const item & )> &filter, int batch = 1 ) const;
 
         template<typename T>
@@ -376,9 +383,9 @@ struct requirement_data {
         template<typename T>
         static std::string print_missing_objs( const std::string &header,
                                                const std::vector< std::vector<T> > &objs );
-        template<typename T>
+        template<typename Inventory, typename T>
         static bool has_comps(
-            const inventory &crafting_inv, const std::vector< std::vector<T> > &vec,
+            const Inventory &crafting_inv, const std::vector< std::vector<T> > &vec,
             const std::function<bool( const item & )> &filter, int batch = 1,
             craft_flags = craft_flags::none );
 
@@ -444,8 +451,9 @@ class deduped_requirement_data
             Character &, const inventory &, const std::function<bool( const item & )> &filter,
             int batch = 1, craft_flags = craft_flags::none ) const;
 
+        template<typename Inventory>
         bool can_make_with_inventory(
-            const inventory &crafting_inv, const std::function<bool( const item & )> &filter,
+            const Inventory &crafting_inv, const std::function<bool( const item & )> &filter,
             int batch = 1, craft_flags = craft_flags::none ) const;
 
         bool is_too_complex() const {
@@ -1,22 +1,24 @@
 #include "rng.h"
 
+#include <atomic>
 #include <cmath>
 #include <chrono>
 #include <utility>
 
 #include "calendar.h"
 #include "cata_utility.h"
+#include "point.h"
 
 unsigned int rng_bits()
 {
     // Whole uint range.
-    static std::uniform_int_distribution<unsigned int> rng_uint_dist;
+    static thread_local std::uniform_int_distribution<unsigned int> rng_uint_dist;
     return rng_uint_dist( rng_get_engine() );
 }
 
 int rng( int lo, int hi )
 {
-    static std::uniform_int_distribution<int> rng_int_dist;
+    static thread_local std::uniform_int_distribution<int> rng_int_dist;
     if( lo > hi ) {
         std::swap( lo, hi );
     }
@@ -25,7 +27,7 @@ int rng( int lo, int hi )
 
 double rng_float( double lo, double hi )
 {
-    static std::uniform_real_distribution<double> rng_real_dist;
+    static thread_local std::uniform_real_distribution<double> rng_real_dist;
     if( lo > hi ) {
         std::swap( lo, hi );
     }
@@ -34,13 +36,15 @@ double rng_float( double lo, double hi )
 
 double normal_roll( double mean, double stddev )
 {
-    static std::normal_distribution<double> rng_normal_dist;
-    return rng_normal_dist( rng_get_engine(), std::normal_distribution<>::param_type( mean, stddev ) );
+    // Not kept around: it caches every second value, which would then leak into or out of
+    // an rng_engine_scope.
+    std::normal_distribution<double> rng_normal_dist( mean, stddev );
+    return rng_normal_dist( rng_get_engine() );
 }
 
 double exponential_roll( double lambda )
 {
-    static std::exponential_distribution<double> rng_exponential_dist;
+    static thread_local std::exponential_distribution<double> rng_exponential_dist;
     return rng_exponential_dist( rng_get_engine(),
                                  std::exponential_distribution<>::param_type( lambda ) );
 }
@@ -79,6 +83,36 @@ int dice( int number, int sides )
     return ret;
 }
 
+int rng( rng_stream &stream, int lo, int hi )
+{
+    rng_engine_scope use_stream( stream.engine() );
+    return rng( lo, hi );
+}
+
+double rng_float( rng_stream &stream, double lo, double hi )
+{
+    rng_engine_scope use_stream( stream.engine() );
+    return rng_float( lo, hi );
+}
+
+bool one_in( rng_stream &stream, int chance )
+{
+    rng_engine_scope use_stream( stream.engine() );
+    return one_in( chance );
+}
+
+bool x_in_y( rng_stream &stream, double x, double y )
+{
+    rng_engine_scope use_stream( stream.engine() );
+    return x_in_y( x, y );
+}
+
+int dice( rng_stream &stream, int number, int sides )
+{
+    rng_engine_scope use_stream( stream.engine() );
+    return dice( number, sides );
+}
+
 // probabilistically round a double to an int
 // 1.3 has a 70% chance of rounding to 1, 30% chance to 2.
 int roll_remainder( double value )
@@ -121,17 +155,87 @@ double rng_normal( double lo, double hi )
     return clamp( val, lo, hi );
 }
 
+/** Engine of the innermost @ref rng_engine_scope of this thread, if any. */
+static thread_local cata_default_random_engine *scoped_engine = nullptr;
+
+rng_engine_scope::rng_engine_scope( cata_default_random_engine &engine ) : previous( scoped_engine )
+{
+    scoped_engine = &engine;
+}
+
+rng_engine_scope::~rng_engine_scope()
+{
+    scoped_engine = previous;
+}
+
 cata_default_random_engine &rng_get_engine()
 {
+    if( scoped_engine != nullptr ) {
+        return *scoped_engine;
+    }
     // NOLINTNEXTLINE(cata-determinism)
     static cata_default_random_engine eng(
         std::chrono::high_resolution_clock::now().time_since_epoch().count() );
     return eng;
 }
 
+/** Set by @ref rng_set_engine_seed or on first use, 0 until then. */
+static std::atomic<uint64_t> base_seed( 0 );
+
 void rng_set_engine_seed( unsigned int seed )
 {
     if( seed != 0 ) {
         rng_get_engine().seed( seed );
+        base_seed = seed;
+    }
+}
+
+uint64_t rng_base_seed()
+{
+    uint64_t seed = base_seed;
+    if( seed == 0 ) {
+        // NOLINTNEXTLINE(cata-determinism)
+        const uint64_t now = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        // Another thread may have picked one in the meantime, keep that.
+        seed = now | 1;
+        uint64_t expected = 0;
+        if( !base_seed.compare_exchange_strong( expected, seed ) ) {
+            seed = expected;
+        }
     }
+    return seed;
+}
+
+// SplitMix64 finalizer, spreads every bit of the input over the whole output.
+static uint64_t mix_seed( uint64_t x )
+{
+    x = ( x ^ ( x >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    x = ( x ^ ( x >> 27 ) ) * 0x94D049BB133111EBULL;
+    return x ^ ( x >> 31 );
+}
+
+rng_stream::rng_stream( uint64_t seed ) : key( seed ),
+    eng( static_cast<cata_default_random_engine::result_type>( mix_seed( seed ) ) )
+{
+}
+
+rng_stream rng_stream::split( uint64_t sub_key ) const
+{
+    return rng_stream( mix_seed( key + 0x9E3779B97F4A7C15ULL ) ^ mix_seed( sub_key ) );
+}
+
+rng_stream rng_stream::split( const tripoint &p ) const
+{
+    return split( static_cast<uint32_t>( p.x ) ).split( static_cast<uint32_t>( p.y ) )
+           .split( static_cast<uint32_t>( p.z ) );
+}
+
+rng_stream rng_stream_for( rng_context ctx )
+{
+    return rng_stream_for( ctx, rng_base_seed() );
+}
+
+rng_stream rng_stream_for( rng_context ctx, uint64_t seed )
+{
+    return rng_stream( seed ).split( static_cast<uint64_t>( ctx ) );
 }
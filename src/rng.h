@@ -3,6 +3,7 @@
 #define CATA_SRC_RNG_H
 
 #include <array>
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <iterator>
@@ -27,6 +28,72 @@ using cata_default_random_engine = std::minstd_rand0;
 cata_default_random_engine &rng_get_engine();
 unsigned int rng_bits();
 
+/**
+ * While alive, all PRNG functions called on the current thread draw from the given engine
+ * instead of the global one. Used to give work that runs off the main thread (or has to
+ * be reproducible on its own) a separate, seeded sequence. Scopes nest.
+ */
+class rng_engine_scope
+{
+    public:
+        explicit rng_engine_scope( cata_default_random_engine &engine );
+        ~rng_engine_scope();
+
+        rng_engine_scope( const rng_engine_scope & ) = delete;
+        rng_engine_scope &operator=( const rng_engine_scope & ) = delete;
+
+    private:
+        cata_default_random_engine *previous;
+};
+
+/** The seed given to @ref rng_set_engine_seed, or one picked from the time if there was none. */
+uint64_t rng_base_seed();
+
+/** Top level contexts of @ref rng_stream. */
+enum class rng_context : int {
+    overmap,
+    submap,
+    creature,
+    turn,
+};
+
+/**
+ * A separate, reproducible sequence of random numbers for one context of the game, e.g.
+ * an overmap or a submap being generated, a creature or a turn. A stream only depends on
+ * its seed and the keys it was split with, not on what drew random numbers before, so work
+ * on different streams can run in any order or on other threads and give the same result.
+ * Creating and splitting a stream is a few multiplications, no state is shared.
+ *
+ * \code
+ * rng_stream stream = rng_stream_for( rng_context::submap ).split( abs_sub_pos );
+ * if( one_in( stream, 4 ) ) { ...
+ * \endcode
+ */
+class rng_stream
+{
+    public:
+        explicit rng_stream( uint64_t seed );
+
+        /** The stream of the sub-context @p key. Does not draw from this stream. */
+        rng_stream split( uint64_t key ) const;
+        rng_stream split( const tripoint &p ) const;
+
+        uint64_t seed() const {
+            return key;
+        }
+        cata_default_random_engine &engine() {
+            return eng;
+        }
+
+    private:
+        uint64_t key;
+        cata_default_random_engine eng;
+};
+
+/** The stream of the context @p ctx, derived from @p seed, which defaults to @ref rng_base_seed. */
+rng_stream rng_stream_for( rng_context ctx );
+rng_stream rng_stream_for( rng_context ctx, uint64_t seed );
+
 int rng( int lo, int hi );
 double rng_float( double lo, double hi );
 bool one_in( int chance );
@@ -34,6 +101,13 @@ bool one_turn_in( const time_duration &duration );
 bool x_in_y( double x, double y );
 int dice( int number, int sides );
 
+// The same, drawing from the given stream instead of the engine of the thread.
+int rng( rng_stream &stream, int lo, int hi );
+double rng_float( rng_stream &stream, double lo, double hi );
+bool one_in( rng_stream &stream, int chance );
+bool x_in_y( rng_stream &stream, double x, double y );
+int dice( rng_stream &stream, int number, int sides );
+
 // Returns x + x_in_y( x-int(x), 1 )
 int roll_remainder( double value );
 inline int roll_remainder( float value )
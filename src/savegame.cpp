@@ -470,6 +470,7 @@ void overmap::unserialize( std::istream &fin )
                 if( rit != region_settings_map.end() ) {
                     // TODO: optimize
                     settings = rit->second;
+                    resolve_default_terrain();
                 }
             }
         } else if( name == "mongroups" ) {
@@ -1269,8 +1270,7 @@ void faction_manager::deserialize( JsonIn &jsin )
 
 void Creature_tracker::deserialize( JsonIn &jsin )
 {
-    monsters_list.clear();
-    monsters_by_location.clear();
+    clear();
     jsin.start_array();
     while( !jsin.end_array() ) {
         // TODO: would be nice if monster had a constructor using JsonIn or similar, so this could be one statement.
@@ -7,6 +7,7 @@
 #include <bitset>
 #include <climits>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <iterator>
 #include <limits>
@@ -202,6 +203,8 @@ void item_contents::deserialize( JsonIn &jsin )
 {
     JsonObject data = jsin.get_object();
     data.read( "contents", contents );
+    adopt_pockets();
+    invalidate_outer_totals();
 }
 
 void item_pocket::serialize( JsonOut &json ) const
@@ -218,6 +221,8 @@ void item_pocket::deserialize( JsonIn &jsin )
 {
     JsonObject data = jsin.get_object();
     data.read( "contents", contents );
+    adopt_contents();
+    invalidate_totals();
     int saved_type_int;
     data.read( "pocket_type", saved_type_int );
     _saved_type = static_cast<item_pocket::pocket_type>( saved_type_int );
@@ -2346,6 +2351,21 @@ void item::io( Archive &archive )
     archive.io( "mission_id", mission_id, -1 );
     archive.io( "player_id", player_id, -1 );
     archive.io( "item_vars", item_vars, io::empty_default_tag() );
+    // -1 means no override
+    int64_t weight_override_mg = weight_override ? units::to_milligram( *weight_override ) : -1;
+    archive.io( "weight_override", weight_override_mg, static_cast<int64_t>( -1 ) );
+    int volume_override_ml = volume_override ? units::to_milliliter( *volume_override ) : -1;
+    archive.io( "volume_override", volume_override_ml, -1 );
+    if( Archive::is_input::value ) {
+        weight_override.reset();
+        if( weight_override_mg >= 0 ) {
+            weight_override = units::from_milligram( weight_override_mg );
+        }
+        volume_override.reset();
+        if( volume_override_ml >= 0 ) {
+            volume_override = units::from_milliliter( volume_override_ml );
+        }
+    }
     // TODO: change default to empty string
     archive.io( "name", corpse_name, std::string() );
     archive.io( "owner", owner, owner.NULL_ID() );
@@ -2361,6 +2381,12 @@ void item::io( Archive &archive )
     archive.io( "techniques", techniques, io::empty_default_tag() );
     archive.io( "faults", faults, io::empty_default_tag() );
     archive.io( "item_tags", item_tags, io::empty_default_tag() );
+    if( Archive::is_input::value ) {
+        item_tag_bits.clear();
+        for( const std::string &flag : item_tags ) {
+            item_tag_bits.set( flag_id( flag ) );
+        }
+    }
     archive.io( "components", components, io::empty_default_tag() );
     archive.io( "specific_energy", specific_energy, -10 );
     archive.io( "temperature", temperature, 0 );
@@ -2413,7 +2439,7 @@ void item::io( Archive &archive )
 
     // Items may have acquired the ENCUMBRANCE_UPDATE flag, but are not armor and will never be worn and will never loose it.
     // This removes the flag unconditionally. It is a temporary flag, which is removed during the game nearly immediately after setting.
-    item_tags.erase( "ENCUMBRANCE_UPDATE" );
+    unset_flag( "ENCUMBRANCE_UPDATE" );
 
     if( note_read ) {
         snip_id = SNIPPET.migrate_hash_to_id( note );
@@ -2434,8 +2460,7 @@ void item::io( Archive &archive )
         active = true;
     }
     if( !active &&
-        ( item_tags.count( "HOT" ) > 0 || item_tags.count( "COLD" ) > 0 ||
-          item_tags.count( "WET" ) > 0 ) ) {
+        ( has_own_flag( "HOT" ) || has_own_flag( "COLD" ) || has_own_flag( "WET" ) ) ) {
         // Some hot/cold items from legacy saves may be inactive
         active = true;
     }
@@ -2457,13 +2482,23 @@ void item::io( Archive &archive )
         }
     }
 
+    // Weight and volume overrides used to be stored as item variables
+    if( has_var( "weight" ) ) {
+        weight_override = units::from_milligram( std::stoll( get_var( "weight" ) ) );
+        erase_var( "weight" );
+    }
+    if( has_var( "volume" ) ) {
+        volume_override = get_var( "volume", 0 ) * units::legacy_volume_factor;
+        erase_var( "volume" );
+    }
+
     // Remove stored translated gerund in favor of storing the inscription tool type
     item_vars.erase( "item_label_type" );
     item_vars.erase( "item_note_type" );
 
     current_phase = static_cast<phase_id>( cur_phase );
     // override phase if frozen, needed for legacy save
-    if( item_tags.count( "FROZEN" ) && current_phase == phase_id::LIQUID ) {
+    if( has_own_flag( "FROZEN" ) && current_phase == phase_id::LIQUID ) {
         current_phase = phase_id::SOLID;
     }
 
@@ -2508,6 +2543,9 @@ void item::deserialize( JsonIn &jsin )
     const JsonObject data = jsin.get_object();
     io::JsonObjectInputArchive archive( data );
     io( archive );
+    // The archive is a copy of data, let data report the members neither of them read.
+    archive.allow_omitted_members();
+    data.copy_visited_members( archive );
     // made for fast forwarding time from 0.D to 0.E
     if( savegame_loading_version < 27 ) {
         legacy_fast_forward_time();
@@ -2526,12 +2564,17 @@ void item::deserialize( JsonIn &jsin )
         update_modified_pockets();
         contents.combine( read_contents );
 
-        if( data.has_object( "contents" ) && data.get_object( "contents" ).has_array( "items" ) ) {
-            // migration for nested containers. leave until after 0.F
-            std::list<item> items;
-            data.get_object( "contents" ).read( "items", items );
-            for( const item &it : items ) {
-                migrate_content_item( it );
+        if( data.has_object( "contents" ) ) {
+            // The contents were read above, this only looks for the old item list.
+            const JsonObject legacy_contents = data.get_object( "contents" );
+            legacy_contents.allow_omitted_members();
+            if( legacy_contents.has_array( "items" ) ) {
+                // migration for nested containers. leave until after 0.F
+                std::list<item> items;
+                legacy_contents.read( "items", items );
+                for( const item &it : items ) {
+                    migrate_content_item( it );
+                }
             }
         }
     }
@@ -2702,7 +2745,7 @@ void vehicle_part::deserialize( JsonIn &jsin )
         if( !base.ammo_types().empty() ) {
             ammo_set( legacy_fuel, data.get_int( "amount" ) );
         }
-        base.item_tags.insert( "VEHICLE" );
+        base.set_flag( "VEHICLE" );
     }
 
     if( data.has_int( "hp" ) && id.obj().durability > 0 ) {
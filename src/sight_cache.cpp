@@ -0,0 +1,100 @@
+#include "sight_cache.h"
+
+#include <utility>
+
+#include "game_constants.h"
+#include "point.h"
+
+// Layout of an entry: the key (both endpoints), the result bit, then the generation.
+// A generation of 0 marks an empty slot.
+static constexpr int coord_bits = 8;
+static constexpr int z_bits = 5;
+static constexpr int point_bits = 2 * coord_bits + z_bits;
+static constexpr int key_bits = 2 * point_bits;
+static constexpr int generation_bits = 64 - key_bits - 1;
+static constexpr uint64_t key_mask = ( uint64_t( 1 ) << key_bits ) - 1;
+static constexpr uint64_t visible_bit = uint64_t( 1 ) << key_bits;
+static constexpr uint64_t max_generation = ( uint64_t( 1 ) << generation_bits ) - 1;
+
+static_assert( MAPSIZE_X <= 1 << coord_bits && MAPSIZE_Y <= 1 << coord_bits,
+               "sight_cache key does not fit the reality bubble" );
+static_assert( OVERMAP_LAYERS <= 1 << z_bits, "sight_cache key does not fit the z-levels" );
+
+static constexpr int set_bits = 15;
+static constexpr int ways = 4;
+static constexpr size_t num_entries = ( size_t( 1 ) << set_bits ) * ways;
+
+static uint64_t pack_point( const tripoint &p )
+{
+    return static_cast<uint64_t>( p.x ) << ( coord_bits + z_bits ) |
+           static_cast<uint64_t>( p.y ) << z_bits |
+           static_cast<uint64_t>( p.z + OVERMAP_DEPTH );
+}
+
+// Points must be inside the reality bubble. The pair is ordered, so the key is the same
+// both ways and the cache stays reflexive.
+static uint64_t pack_key( const tripoint &from, const tripoint &to )
+{
+    uint64_t a = pack_point( from );
+    uint64_t b = pack_point( to );
+    if( b < a ) {
+        std::swap( a, b );
+    }
+    return a << point_bits | b;
+}
+
+static size_t set_start( const uint64_t key )
+{
+    return static_cast<size_t>( ( key * 0x9E3779B97F4A7C15ULL ) >> ( 64 - set_bits ) ) * ways;
+}
+
+sight_cache::sight_cache() : entries( new std::atomic<uint64_t>[num_entries] )
+{
+    for( size_t i = 0; i < num_entries; ++i ) {
+        entries[i].store( 0, std::memory_order_relaxed );
+    }
+}
+
+int sight_cache::get( const tripoint &from, const tripoint &to ) const
+{
+    const uint64_t key = pack_key( from, to );
+    const size_t start = set_start( key );
+    for( size_t i = start; i < start + ways; ++i ) {
+        const uint64_t entry = entries[i].load( std::memory_order_relaxed );
+        if( ( entry & key_mask ) == key && entry >> ( key_bits + 1 ) == generation ) {
+            return ( entry & visible_bit ) ? 1 : 0;
+        }
+    }
+    return -1;
+}
+
+void sight_cache::insert( const tripoint &from, const tripoint &to, const bool visible )
+{
+    const uint64_t key = pack_key( from, to );
+    const size_t start = set_start( key );
+    const uint64_t entry = generation << ( key_bits + 1 ) | ( visible ? visible_bit : 0 ) | key;
+    // Reuse the slot of the same key or a stale one, otherwise evict a way picked by the
+    // low bits of the key so that different keys of the same set evict different ways.
+    size_t target = start + key % ways;
+    for( size_t i = start; i < start + ways; ++i ) {
+        const uint64_t old = entries[i].load( std::memory_order_relaxed );
+        if( ( old & key_mask ) == key || old >> ( key_bits + 1 ) != generation ) {
+            target = i;
+            break;
+        }
+    }
+    entries[target].store( entry, std::memory_order_relaxed );
+}
+
+void sight_cache::invalidate()
+{
+    if( generation < max_generation ) {
+        ++generation;
+        return;
+    }
+    // The generation wrapped around, old entries could match again.
+    generation = 1;
+    for( size_t i = 0; i < num_entries; ++i ) {
+        entries[i].store( 0, std::memory_order_relaxed );
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+#ifndef CATA_SRC_SIGHT_CACHE_H
+#define CATA_SRC_SIGHT_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+struct tripoint;
+
+/**
+ * Fixed size, set-associative cache of line of sight results between two points of the
+ * reality bubble. Each entry is a single atomic word holding the packed endpoints, the
+ * result and the generation it was stored in, so lookups neither allocate nor lock and
+ * may run concurrently with each other.
+ * Bumping the generation (@ref invalidate) drops all entries at once.
+ */
+class sight_cache
+{
+    public:
+        sight_cache();
+
+        /** Cached result for the pair of points: 1 if visible, 0 if not, -1 if unknown. */
+        int get( const tripoint &from, const tripoint &to ) const;
+        void insert( const tripoint &from, const tripoint &to, bool visible );
+        /** Forgets all entries. Must not run concurrently with @ref get or @ref insert. */
+        void invalidate();
+
+    private:
+        std::unique_ptr<std::atomic<uint64_t>[]> entries;
+        uint64_t generation = 1;
+};
+
+#endif // CATA_SRC_SIGHT_CACHE_H
@@ -17,7 +17,9 @@
 
 #include "simplexnoise.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 /* 2D, 3D and 4D Simplex Noise functions return 'random' values in (-1, 1).
 
@@ -549,3 +551,263 @@ float dot( const int *g, const float x, const float y, const float z, const floa
 {
     return g[0] * x + g[1] * y + g[2] * z + g[3] * w;
 }
+
+namespace
+{
+// Number of points the batched functions work on at once.
+constexpr size_t noise_block = 8;
+
+// One corner of the simplex for every point of a block.
+struct noise_corner {
+    float x[noise_block];
+    float y[noise_block];
+    float z[noise_block];
+    float w[noise_block];
+    float gx[noise_block];
+    float gy[noise_block];
+    float gz[noise_block];
+    float gw[noise_block];
+    float n[noise_block];
+};
+
+// Contribution of a corner to the noise value, see the end of raw_noise_3d/raw_noise_4d.
+void corner_contribution_3d( noise_corner &c, const size_t count )
+{
+    for( size_t p = 0; p < count; ++p ) {
+        const float t0 = 0.6f - c.x[p] * c.x[p] - c.y[p] * c.y[p] - c.z[p] * c.z[p];
+        const float t = t0 * t0;
+        const float contribution = t * t * ( c.gx[p] * c.x[p] + c.gy[p] * c.y[p] + c.gz[p] * c.z[p] );
+        c.n[p] = t0 < 0 ? 0.0f : contribution;
+    }
+}
+
+void corner_contribution_4d( noise_corner &c, const size_t count )
+{
+    for( size_t p = 0; p < count; ++p ) {
+        const float t0 = 0.6f - c.x[p] * c.x[p] - c.y[p] * c.y[p] - c.z[p] * c.z[p] - c.w[p] * c.w[p];
+        const float t = t0 * t0;
+        const float contribution = t * t * ( c.gx[p] * c.x[p] + c.gy[p] * c.y[p] + c.gz[p] * c.z[p] +
+                                             c.gw[p] * c.w[p] );
+        c.n[p] = t0 < 0 ? 0.0f : contribution;
+    }
+}
+
+void raw_noise_3d_block( const float *x, const float *y, const float *z, float *out,
+                         const size_t count )
+{
+    const float F3 = 1.0f / 3.0f;
+    const float G3 = 1.0f / 6.0f;
+
+    int i[noise_block];
+    int j[noise_block];
+    int k[noise_block];
+    // Offsets of the second and third corners
+    int o1[3][noise_block];
+    int o2[3][noise_block];
+    noise_corner c[4];
+
+    for( size_t p = 0; p < count; ++p ) {
+        const float s = ( x[p] + y[p] + z[p] ) * F3;
+        i[p] = fastfloor( x[p] + s );
+        j[p] = fastfloor( y[p] + s );
+        k[p] = fastfloor( z[p] + s );
+        const float t = ( i[p] + j[p] + k[p] ) * G3;
+        const float x0 = x[p] - ( i[p] - t );
+        const float y0 = y[p] - ( j[p] - t );
+        const float z0 = z[p] - ( k[p] - t );
+
+        // Branch free version of the corner ordering in raw_noise_3d
+        const bool a = x0 >= y0;
+        const bool b = y0 >= z0;
+        const bool d = x0 >= z0;
+        o1[0][p] = a && ( b || d );
+        o1[1][p] = !a && b;
+        o1[2][p] = !b && !( a && d );
+        o2[0][p] = a || ( b && d );
+        o2[1][p] = !a || b;
+        o2[2][p] = !b || ( !a && !d );
+
+        c[0].x[p] = x0;
+        c[0].y[p] = y0;
+        c[0].z[p] = z0;
+        c[1].x[p] = x0 - o1[0][p] + G3;
+        c[1].y[p] = y0 - o1[1][p] + G3;
+        c[1].z[p] = z0 - o1[2][p] + G3;
+        c[2].x[p] = x0 - o2[0][p] + 2.0f * G3;
+        c[2].y[p] = y0 - o2[1][p] + 2.0f * G3;
+        c[2].z[p] = z0 - o2[2][p] + 2.0f * G3;
+        c[3].x[p] = x0 - 1.0f + 3.0f * G3;
+        c[3].y[p] = y0 - 1.0f + 3.0f * G3;
+        c[3].z[p] = z0 - 1.0f + 3.0f * G3;
+    }
+
+    // Hashed gradients of the four corners
+    for( size_t p = 0; p < count; ++p ) {
+        const int ii = i[p] & 255;
+        const int jj = j[p] & 255;
+        const int kk = k[p] & 255;
+        const int gi[4] = {
+            perm[ii + perm[jj + perm[kk]]] % 12,
+            perm[ii + o1[0][p] + perm[jj + o1[1][p] + perm[kk + o1[2][p]]]] % 12,
+            perm[ii + o2[0][p] + perm[jj + o2[1][p] + perm[kk + o2[2][p]]]] % 12,
+            perm[ii + 1 + perm[jj + 1 + perm[kk + 1]]] % 12
+        };
+        for( int corner = 0; corner < 4; ++corner ) {
+            c[corner].gx[p] = grad3[gi[corner]][0];
+            c[corner].gy[p] = grad3[gi[corner]][1];
+            c[corner].gz[p] = grad3[gi[corner]][2];
+        }
+    }
+
+    for( noise_corner &corner : c ) {
+        corner_contribution_3d( corner, count );
+    }
+    for( size_t p = 0; p < count; ++p ) {
+        out[p] = 32.0f * ( c[0].n[p] + c[1].n[p] + c[2].n[p] + c[3].n[p] );
+    }
+}
+
+void raw_noise_4d_block( const float *x, const float *y, const float *z, const float *w,
+                         float *out, const size_t count )
+{
+    static const float F4 = ( std::sqrt( 5.0f ) - 1.0f ) / 4.0f;
+    static const float G4 = ( 5.0f - std::sqrt( 5.0f ) ) / 20.0f;
+
+    int i[noise_block];
+    int j[noise_block];
+    int k[noise_block];
+    int l[noise_block];
+    int order[noise_block];
+    noise_corner c[5];
+
+    for( size_t p = 0; p < count; ++p ) {
+        const float s = ( x[p] + y[p] + z[p] + w[p] ) * F4;
+        i[p] = fastfloor( x[p] + s );
+        j[p] = fastfloor( y[p] + s );
+        k[p] = fastfloor( z[p] + s );
+        l[p] = fastfloor( w[p] + s );
+        const float t = ( i[p] + j[p] + k[p] + l[p] ) * G4;
+        const float x0 = x[p] - ( i[p] - t );
+        const float y0 = y[p] - ( j[p] - t );
+        const float z0 = z[p] - ( k[p] - t );
+        const float w0 = w[p] - ( l[p] - t );
+        order[p] = ( x0 > y0 ? 32 : 0 ) + ( x0 > z0 ? 16 : 0 ) + ( y0 > z0 ? 8 : 0 ) +
+                   ( x0 > w0 ? 4 : 0 ) + ( y0 > w0 ? 2 : 0 ) + ( z0 > w0 ? 1 : 0 );
+        c[0].x[p] = x0;
+        c[0].y[p] = y0;
+        c[0].z[p] = z0;
+        c[0].w[p] = w0;
+    }
+
+    // Simplex traversal and hashed gradients of the five corners
+    for( size_t p = 0; p < count; ++p ) {
+        const int *const sc = simplex[order[p]];
+        const int ii = i[p] & 255;
+        const int jj = j[p] & 255;
+        const int kk = k[p] & 255;
+        const int ll = l[p] & 255;
+        for( int corner = 1; corner < 4; ++corner ) {
+            const int threshold = 4 - corner;
+            const int oi = sc[0] >= threshold ? 1 : 0;
+            const int oj = sc[1] >= threshold ? 1 : 0;
+            const int ok = sc[2] >= threshold ? 1 : 0;
+            const int ol = sc[3] >= threshold ? 1 : 0;
+            c[corner].x[p] = c[0].x[p] - oi + corner * G4;
+            c[corner].y[p] = c[0].y[p] - oj + corner * G4;
+            c[corner].z[p] = c[0].z[p] - ok + corner * G4;
+            c[corner].w[p] = c[0].w[p] - ol + corner * G4;
+            const int gi = perm[ii + oi + perm[jj + oj + perm[kk + ok + perm[ll + ol]]]] % 32;
+            c[corner].gx[p] = grad4[gi][0];
+            c[corner].gy[p] = grad4[gi][1];
+            c[corner].gz[p] = grad4[gi][2];
+            c[corner].gw[p] = grad4[gi][3];
+        }
+        c[4].x[p] = c[0].x[p] - 1.0f + 4.0f * G4;
+        c[4].y[p] = c[0].y[p] - 1.0f + 4.0f * G4;
+        c[4].z[p] = c[0].z[p] - 1.0f + 4.0f * G4;
+        c[4].w[p] = c[0].w[p] - 1.0f + 4.0f * G4;
+        const int gi0 = perm[ii + perm[jj + perm[kk + perm[ll]]]] % 32;
+        const int gi4 = perm[ii + 1 + perm[jj + 1 + perm[kk + 1 + perm[ll + 1]]]] % 32;
+        c[0].gx[p] = grad4[gi0][0];
+        c[0].gy[p] = grad4[gi0][1];
+        c[0].gz[p] = grad4[gi0][2];
+        c[0].gw[p] = grad4[gi0][3];
+        c[4].gx[p] = grad4[gi4][0];
+        c[4].gy[p] = grad4[gi4][1];
+        c[4].gz[p] = grad4[gi4][2];
+        c[4].gw[p] = grad4[gi4][3];
+    }
+
+    for( noise_corner &corner : c ) {
+        corner_contribution_4d( corner, count );
+    }
+    for( size_t p = 0; p < count; ++p ) {
+        out[p] = 27.0f * ( c[0].n[p] + c[1].n[p] + c[2].n[p] + c[3].n[p] + c[4].n[p] );
+    }
+}
+} // namespace
+
+// Batched 3D raw Simplex noise
+void raw_noise_3d( const float *x, const float *y, const float *z, float *out, const size_t n )
+{
+    for( size_t start = 0; start < n; start += noise_block ) {
+        const size_t count = std::min( noise_block, n - start );
+        raw_noise_3d_block( x + start, y + start, z + start, out + start, count );
+    }
+}
+
+// Batched 4D raw Simplex noise
+void raw_noise_4d( const float *x, const float *y, const float *z, const float *w, float *out,
+                   const size_t n )
+{
+    for( size_t start = 0; start < n; start += noise_block ) {
+        const size_t count = std::min( noise_block, n - start );
+        raw_noise_4d_block( x + start, y + start, z + start, w + start, out + start, count );
+    }
+}
+
+// Batched 3D Multi-octave Simplex noise.
+void octave_noise_3d( const float octaves, const float persistence, const float scale,
+                      const float *x, const float *y, const float *z, float *out, const size_t n )
+{
+    std::vector<float> fx( n );
+    std::vector<float> fy( n );
+    std::vector<float> fz( n );
+    std::vector<float> octave( n );
+    std::fill( out, out + n, 0.0f );
+
+    float frequency = scale;
+    float amplitude = 1.0f;
+    float maxAmplitude = 0.0f;
+
+    for( int i = 0; i < octaves; i++ ) {
+        for( size_t p = 0; p < n; ++p ) {
+            fx[p] = x[p] * frequency;
+            fy[p] = y[p] * frequency;
+            fz[p] = z[p] * frequency;
+        }
+        raw_noise_3d( fx.data(), fy.data(), fz.data(), octave.data(), n );
+        for( size_t p = 0; p < n; ++p ) {
+            out[p] += octave[p] * amplitude;
+        }
+
+        frequency *= 2;
+        maxAmplitude += amplitude;
+        amplitude *= persistence;
+    }
+
+    for( size_t p = 0; p < n; ++p ) {
+        out[p] /= maxAmplitude;
+    }
+}
+
+// Batched 3D Scaled Multi-octave Simplex noise.
+void scaled_octave_noise_3d( const float octaves, const float persistence, const float scale,
+                             const float loBound, const float hiBound,
+                             const float *x, const float *y, const float *z, float *out, const size_t n )
+{
+    octave_noise_3d( octaves, persistence, scale, x, y, z, out, n );
+    for( size_t p = 0; p < n; ++p ) {
+        out[p] = out[p] * ( hiBound - loBound ) / 2 + ( hiBound + loBound ) / 2;
+    }
+}
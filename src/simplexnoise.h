@@ -19,6 +19,8 @@
 #ifndef CATA_SRC_SIMPLEXNOISE_H
 #define CATA_SRC_SIMPLEXNOISE_H
 
+#include <cstddef>
+
 /* 2D, 3D and 4D Simplex Noise functions return 'random' values in (-1, 1).
 
 This algorithm was originally designed by Ken Perlin, but my code has been
@@ -115,6 +117,20 @@ float raw_noise_2d( float x, float y );
 float raw_noise_3d( float x, float y, float z );
 float raw_noise_4d( float x, float y, float, float w );
 
+// Batched Simplex noise
+// Evaluates @p n points at once, given as separate coordinate arrays, and writes the same
+// values the single point versions would return to @p out. The points are processed in
+// fixed size blocks with the arithmetic in plain loops over the block so the compiler can
+// vectorize it; only the permutation and gradient table lookups are done point by point.
+void raw_noise_3d( const float *x, const float *y, const float *z, float *out, size_t n );
+void raw_noise_4d( const float *x, const float *y, const float *z, const float *w, float *out,
+                   size_t n );
+void octave_noise_3d( float octaves, float persistence, float scale,
+                      const float *x, const float *y, const float *z, float *out, size_t n );
+void scaled_octave_noise_3d( float octaves, float persistence, float scale,
+                             float loBound, float hiBound,
+                             const float *x, const float *y, const float *z, float *out, size_t n );
+
 int fastfloor( float x );
 
 float dot( const int *g, float x, float y );
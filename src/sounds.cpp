@@ -7,6 +7,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include "avatar.h"
 #include "calendar.h"
 #include "character.h"
 #include "coordinate_conversions.h"
@@ -28,6 +29,7 @@
 #include "player.h"
 #include "player_activity.h"
 #include "point.h"
+#include "profiler.h"
 #include "rng.h"
 #include "safemode_ui.h"
 #include "string_formatter.h"
@@ -294,6 +296,7 @@ static int get_signal_for_hordes( const centroid &centr )
 
 void sounds::process_sounds()
 {
+    CATA_PROFILE_ZONE( "process_sounds" );
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
     const int weather_vol = get_weather().weather_id->sound_attn;
     for( const auto &this_centroid : sound_clusters ) {
@@ -1185,8 +1188,8 @@ void sfx::do_danger_music()
     }
     audio_muted = false;
     int hostiles = 0;
-    for( auto &critter : player_character.get_visible_creatures( 40 ) ) {
-        if( player_character.attitude_to( *critter ) == Creature::Attitude::HOSTILE ) {
+    for( const visible_creature &seen : get_avatar().visible_creatures() ) {
+        if( seen.distance <= 40 && seen.attitude == Creature::Attitude::HOSTILE ) {
             hostiles++;
         }
     }
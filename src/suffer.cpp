@@ -1199,9 +1199,9 @@ void Character::suffer_from_bad_bionics()
         mod_power_level( -10_kJ );
 
         if( weapon.typeId() == itype_e_handcuffs && weapon.charges > 0 ) {
-            weapon.charges -= rng( 1, 3 ) * 50;
+            weapon.set_charges( weapon.charges - rng( 1, 3 ) * 50 );
             if( weapon.charges < 1 ) {
-                weapon.charges = 1;
+                weapon.set_charges( 1 );
             }
 
             add_msg_if_player( m_good, _( "The %s seems to be affected by the discharge." ),
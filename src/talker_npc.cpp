@@ -457,7 +457,7 @@ static consumption_result try_consume( npc &p, item &it, std::string &reason )
         }
 
         p.consume_effects( to_eat );
-        to_eat.charges -= amount_used;
+        to_eat.set_charges( to_eat.charges - amount_used );
         p.moves -= 250;
     } else {
         debugmsg( "Unknown comestible type of item: %s\n", to_eat.tname() );
@@ -1473,7 +1473,7 @@ void veh_interact::calc_overview()
                     // but item::display_name tags use a space so this prevents
                     // needing *second* translation for the same thing with a
                     // space in front of it
-                    if( it.item_tags.count( "FROZEN" ) ) {
+                    if( it.has_own_flag( "FROZEN" ) ) {
                         specials += _( " (frozen)" );
                     } else if( it.rotten() ) {
                         specials += _( " (rotten)" );
@@ -3088,7 +3088,8 @@ void veh_interact::complete_vehicle( player &p )
             struct vehicle_part &pt = veh->part( vehicle_part );
             if( pt.is_tank() && src->is_container() && !src->contents.empty() ) {
                 item &contained = src->contents.legacy_front();
-                contained.charges -= pt.base.fill_with( contained, contained.charges );
+                contained.set_charges( contained.charges -
+                                       pt.base.fill_with( contained, contained.charges ) );
                 src->on_contents_changed();
 
                 if( pt.remaining_ammo_capacity() ) {
@@ -24,6 +24,7 @@
 #include "clzones.h"
 #include "colony.h"
 #include "coordinate_conversions.h"
+#include "crafting_inventory_view.h"
 #include "creature.h"
 #include "cuboid_rectangle.h"
 #include "debug.h"
@@ -265,7 +266,13 @@ vehicle::vehicle() : vehicle( vproto_id() )
     sm_pos = tripoint_zero;
 }
 
-vehicle::~vehicle() = default;
+vehicle::~vehicle()
+{
+    // Cables are loose parts, the part types may already be gone when the game shuts down.
+    if( !loose_parts.empty() ) {
+        invalidate_power_grids();
+    }
+}
 
 bool vehicle::player_in_control( const Character &p ) const
 {
@@ -2500,16 +2507,22 @@ std::vector<int> vehicle::parts_at_relative( const point &dp,
         }
         return res;
     } else {
-        const auto &iter = relative_parts.find( dp );
-        if( iter != relative_parts.end() ) {
-            return iter->second;
-        } else {
-            std::vector<int> res;
-            return res;
-        }
+        const mount_part_range here = parts_at_mount( dp );
+        return std::vector<int>( here.begin(), here.end() );
     }
 }
 
+mount_part_range vehicle::parts_at_mount( const point &dp ) const
+{
+    const point rel = dp - mount_grid_origin;
+    if( rel.x < 0 || rel.y < 0 || rel.x >= mount_grid_size.x || rel.y >= mount_grid_size.y ) {
+        return mount_part_range();
+    }
+    const int tile = rel.y * mount_grid_size.x + rel.x;
+    const int *data = mount_parts.data();
+    return mount_part_range( data + mount_part_offsets[tile], data + mount_part_offsets[tile + 1] );
+}
+
 cata::optional<vpart_reference> vpart_position::obstacle_at_part() const
 {
     const cata::optional<vpart_reference> part = part_with_feature( VPFLAG_OBSTACLE, true );
@@ -2580,13 +2593,9 @@ int vehicle::part_with_feature( int part, vpart_bitflags const flag, bool unbrok
     if( part_flag( part, flag ) && ( !unbroken || !parts[part].is_broken() ) ) {
         return part;
     }
-    const auto it = relative_parts.find( parts[part].mount );
-    if( it != relative_parts.end() ) {
-        const std::vector<int> &parts_here = it->second;
-        for( const int &i : parts_here ) {
-            if( part_flag( i, flag ) && ( !unbroken || !parts[i].is_broken() ) ) {
-                return i;
-            }
+    for( const int i : parts_at_mount( parts[part].mount ) ) {
+        if( part_flag( i, flag ) && ( !unbroken || !parts[i].is_broken() ) ) {
+            return i;
         }
     }
     return -1;
@@ -2740,7 +2749,7 @@ int vehicle::next_part_to_close( int p, bool outside ) const
 
 int vehicle::next_part_to_open( int p, bool outside ) const
 {
-    std::vector<int> parts_here = parts_at_relative( parts[p].mount, true );
+    const mount_part_range parts_here = parts_at_mount( parts[p].mount );
 
     // We want forwards, since we open the innermost thing first (curtains), and then the innermost thing (door)
     for( const int &elem : parts_here ) {
@@ -3016,7 +3025,7 @@ int vehicle::part_displayed_at( const point &dp ) const
     // it's clear where the magic number comes from.
     const int ON_ROOF_Z = 9;
 
-    std::vector<int> parts_in_square = parts_at_relative( dp, true );
+    const mount_part_range parts_in_square = parts_at_mount( dp );
 
     if( parts_in_square.empty() ) {
         return -1;
@@ -3053,8 +3062,7 @@ int vehicle::part_displayed_at( const point &dp ) const
 
 int vehicle::roof_at_part( const int part ) const
 {
-    std::vector<int> parts_in_square = parts_at_relative( parts[part].mount, true );
-    for( const int p : parts_in_square ) {
+    for( const int p : parts_at_mount( parts[part].mount ) ) {
         if( part_info( p ).location == "on_roof" || part_flag( p, "ROOF" ) ) {
             return p;
         }
@@ -3932,11 +3940,11 @@ double vehicle::coeff_air_drag() const
                   p.info().has_flag( "OPENABLE" ) );
     };
 
-    const auto d_protrusion = [&]( std::vector<int> parts_at ) {
+    const auto d_protrusion = [&]( const mount_part_range & parts_at ) {
         if( parts_at.size() > 1 ) {
             return false;
         } else {
-            return parts[ parts_at.front() ].info().has_flag( "PROTRUSION" );
+            return parts[ parts_at[0] ].info().has_flag( "PROTRUSION" );
         }
     };
     const auto d_check_min = [&]( int &value, const vehicle_part & p, bool test ) {
@@ -3955,7 +3963,7 @@ double vehicle::coeff_air_drag() const
             continue;
         }
         int col = parts[ p ].mount.y - mount_min.y;
-        std::vector<int> parts_at = parts_at_relative( parts[ p ].mount, true );
+        const mount_part_range parts_at = parts_at_mount( parts[ p ].mount );
         d_check_min( drag[ col ].pro, parts[ p ], d_protrusion( parts_at ) );
         for( int pa_index : parts_at ) {
             const vehicle_part &pa = parts[ pa_index ];
@@ -4958,53 +4966,68 @@ void vehicle::enumerate_vehicles( std::map<vehicle *, bool> &connected_vehicles,
 template <typename Func, typename Vehicle>
 int vehicle::traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action )
 {
-    // Breadth-first search! Initialize the queue with a pointer to ourselves and go!
-    std::queue< std::pair<Vehicle *, int> > connected_vehs;
-    std::set<Vehicle *> visited_vehs;
-    connected_vehs.push( std::make_pair( start_veh, 0 ) );
+    for( const std::pair<vehicle *, int> &connected : start_veh->power_grid() ) {
+        if( amount < 1 ) {
+            break; // No more charge to donate away.
+        }
+        const float loss_amount = ( static_cast<float>( amount ) * static_cast<float>
+                                    ( connected.second ) ) / 100.0f;
+        amount = action( connected.first, amount, static_cast<int>( loss_amount ) );
+    }
+    return amount;
+}
 
-    while( amount > 0 && !connected_vehs.empty() ) {
-        auto current_node = connected_vehs.front();
-        Vehicle *current_veh = current_node.first;
-        int current_loss = current_node.second;
+int vehicle::power_grids_version = 0;
 
-        visited_vehs.insert( current_veh );
-        connected_vehs.pop();
+void vehicle::invalidate_power_grids()
+{
+    power_grids_version++;
+}
+
+bool vehicle::has_power_cables() const
+{
+    return std::any_of( loose_parts.begin(), loose_parts.end(), [this]( int p ) {
+        return part_info( p ).has_flag( "POWER_TRANSFER" );
+    } );
+}
 
-        add_msg( m_debug, "Traversing graph with %d power", amount );
+const std::vector<std::pair<vehicle *, int>> &vehicle::power_grid() const
+{
+    if( power_grid_version == power_grids_version ) {
+        return power_grid_cache;
+    }
+    // Breadth-first search! Initialize the queue with ourselves and go!
+    std::vector<std::pair<vehicle *, int>> grid;
+    std::queue<std::pair<const vehicle *, int>> connected_vehs;
+    std::unordered_set<const vehicle *> visited_vehs{ this };
+    connected_vehs.emplace( this, 0 );
+    while( !connected_vehs.empty() ) {
+        const vehicle *current_veh = connected_vehs.front().first;
+        const int current_loss = connected_vehs.front().second;
+        connected_vehs.pop();
 
         for( int p : current_veh->loose_parts ) {
-            if( !current_veh->part_info( p ).has_flag( "POWER_TRANSFER" ) ) {
+            const vpart_info &info = current_veh->part_info( p );
+            if( !info.has_flag( "POWER_TRANSFER" ) ) {
                 continue; // ignore loose parts that aren't power transfer cables
             }
 
             vehicle *target_veh = vehicle::find_vehicle( current_veh->parts[p].target.second );
-            if( target_veh == nullptr || visited_vehs.count( target_veh ) > 0 ) {
+            if( target_veh == nullptr || !visited_vehs.insert( target_veh ).second ) {
                 // Either no destination here (that vehicle's rolled away or off-map) or
-                // we've already looked at that vehicle.
+                // we've already reached that vehicle.
                 continue;
             }
-
-            // Add this connected vehicle to the queue of vehicles to search next,
-            // but only if we haven't seen this one before.
-            if( visited_vehs.count( target_veh ) < 1 ) {
-                int target_loss = current_loss + current_veh->part_info( p ).epower;
-                connected_vehs.push( std::make_pair( target_veh, target_loss ) );
-
-                float loss_amount = ( static_cast<float>( amount ) * static_cast<float>( target_loss ) ) / 100.0f;
-                add_msg( m_debug, "Visiting remote %p with %d power (loss %f, which is %d percent)",
-                         static_cast<void *>( target_veh ), amount, loss_amount, target_loss );
-
-                amount = action( target_veh, amount, static_cast<int>( loss_amount ) );
-                add_msg( m_debug, "After remote %p, %d power", static_cast<void *>( target_veh ), amount );
-
-                if( amount < 1 ) {
-                    break; // No more charge to donate away.
-                }
-            }
+            const int target_loss = current_loss + info.epower;
+            grid.emplace_back( target_veh, target_loss );
+            connected_vehs.emplace( target_veh, target_loss );
         }
     }
-    return amount;
+    // Looking up off-map vehicles can load their submaps, which refreshes vehicles and so
+    // invalidates the grids, the version has to be taken afterwards.
+    power_grid_cache = std::move( grid );
+    power_grid_version = power_grids_version;
+    return power_grid_cache;
 }
 
 int vehicle::charge_battery( int amount, bool include_other_vehicles )
@@ -5258,7 +5281,7 @@ int vehicle::add_charges( int part, const item &itm )
     }
 
     item itm_copy = itm;
-    itm_copy.charges = ret;
+    itm_copy.set_charges( ret );
     return add_item( part, itm_copy ) ? ret : 0;
 }
 
@@ -5320,6 +5343,7 @@ cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item
     if( itm_copy.needs_processing() ) {
         active_items.add( *new_pos, p.mount );
     }
+    crafting_inventory_view::on_vehicle_item_added( *this, part, *new_pos );
 
     invalidate_mass();
     return cata::optional<vehicle_stack::iterator>( new_pos );
@@ -5550,6 +5574,8 @@ void vehicle::refresh()
     if( no_refresh ) {
         return;
     }
+    // Cables may have come or gone
+    invalidate_power_grids();
 
     alternators.clear();
     engines.clear();
@@ -5560,7 +5586,7 @@ void vehicle::refresh()
     water_wheels.clear();
     funnels.clear();
     emitters.clear();
-    relative_parts.clear();
+    mount_parts.clear();
     loose_parts.clear();
     wheelcache.clear();
     rail_wheelcache.clear();
@@ -5576,13 +5602,13 @@ void vehicle::refresh()
     all_wheels_on_one_axis = true;
     int first_wheel_y_mount = INT_MAX;
 
-    // Used to sort part list so it displays properly when examining
-    struct sort_veh_part_vector {
-        vehicle *veh;
-        inline bool operator()( const int p1, const int p2 ) {
-            return veh->part_info( p1 ).list_order < veh->part_info( p2 ).list_order;
-        }
-    } svpv = { this };
+    // Used to sort part list so it displays properly when examining, parts with the same
+    // list order are listed last added first
+    const auto list_order = [this]( const int p1, const int p2 ) {
+        const int order1 = part_info( p1 ).list_order;
+        const int order2 = part_info( p2 ).list_order;
+        return order1 < order2 || ( order1 == order2 && p1 > p2 );
+    };
 
     mount_min.x = 123;
     mount_min.y = 123;
@@ -5608,18 +5634,13 @@ void vehicle::refresh()
         }
         refresh_done = true;
 
-        // Build map of point -> all parts in that point
+        // Indexed by mount point once the bounding box is known
         const point pt = vp.mount();
         mount_min.x = std::min( mount_min.x, pt.x );
         mount_min.y = std::min( mount_min.y, pt.y );
         mount_max.x = std::max( mount_max.x, pt.x );
         mount_max.y = std::max( mount_max.y, pt.y );
-
-        // This will keep the parts at point pt sorted
-        std::vector<int>::iterator vii = std::lower_bound( relative_parts[pt].begin(),
-                                         relative_parts[pt].end(),
-                                         static_cast<int>( p ), svpv );
-        relative_parts[pt].insert( vii, p );
+        mount_parts.push_back( static_cast<int>( p ) );
 
         if( vpi.has_flag( VPFLAG_FLOATS ) ) {
             floating.push_back( p );
@@ -5727,6 +5748,31 @@ void vehicle::refresh()
         rail_wheel_bounding_box.p2 = point_zero;
     }
 
+    // Counting sort of the parts by grid tile, then by list order within each tile
+    mount_grid_origin = mount_min;
+    mount_grid_size = mount_max - mount_min + point_south_east;
+    const auto grid_tile = [this]( const int p ) {
+        const point rel = parts[p].mount - mount_grid_origin;
+        return rel.y * mount_grid_size.x + rel.x;
+    };
+    mount_part_offsets.assign( mount_grid_size.x * mount_grid_size.y + 1, 0 );
+    for( const int p : mount_parts ) {
+        mount_part_offsets[grid_tile( p ) + 1]++;
+    }
+    std::partial_sum( mount_part_offsets.begin(), mount_part_offsets.end(),
+                      mount_part_offsets.begin() );
+    std::vector<int> next_slot( mount_part_offsets.begin(), mount_part_offsets.end() - 1 );
+    std::vector<int> unsorted;
+    unsorted.swap( mount_parts );
+    mount_parts.resize( unsorted.size() );
+    for( const int p : unsorted ) {
+        mount_parts[next_slot[grid_tile( p )]++] = p;
+    }
+    for( size_t tile = 0; tile + 1 < mount_part_offsets.size(); ++tile ) {
+        std::sort( mount_parts.begin() + mount_part_offsets[tile],
+                   mount_parts.begin() + mount_part_offsets[tile + 1], list_order );
+    }
+
     // NB: using the _old_ pivot point, don't recalc here, we only do that when moving!
     precalc_mounts( 0, pivot_rotation[0], pivot_anchor[0] );
     check_environmental_effects = true;
@@ -7128,7 +7174,7 @@ tripoint vehicle::exhaust_dest( int part ) const
 {
     point p = parts[part].mount;
     // Move back from engine/muffler until we find an open space
-    while( relative_parts.find( p ) != relative_parts.end() ) {
+    while( !parts_at_mount( p ).empty() ) {
         p.x += ( velocity < 0 ? 1 : -1 );
     }
     point q = coord_translate( p );
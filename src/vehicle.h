@@ -597,6 +597,37 @@ struct label : public point {
     void serialize( JsonOut &json ) const;
 };
 
+/**
+ * Indices of the parts on one mount point of a vehicle, sorted by list order.
+ * Points into the vehicle's own cache and is invalidated by @ref vehicle::refresh.
+ */
+class mount_part_range
+{
+    public:
+        mount_part_range() = default;
+        mount_part_range( const int *first, const int *last ) : first( first ), last( last ) {}
+
+        const int *begin() const {
+            return first;
+        }
+        const int *end() const {
+            return last;
+        }
+        bool empty() const {
+            return first == last;
+        }
+        size_t size() const {
+            return last - first;
+        }
+        int operator[]( size_t i ) const {
+            return first[i];
+        }
+
+    private:
+        const int *first = nullptr;
+        const int *last = nullptr;
+};
+
 class RemovePartHandler;
 
 /**
@@ -758,6 +789,19 @@ class vehicle
         template <typename Func, typename Vehicle>
         static int traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action );
     public:
+        /**
+         * The vehicles connected to this one by POWER_TRANSFER parts, directly or over other
+         * vehicles, in breadth-first order. Each comes with the cable loss in percent summed
+         * along the path it was reached by. The result is kept until @ref invalidate_power_grids.
+         */
+        const std::vector<std::pair<vehicle *, int>> &power_grid() const;
+        /**
+         * Drops the cached power grids of all vehicles. Needed whenever parts are installed or
+         * removed, or a vehicle with power cables is moved or destroyed.
+         */
+        static void invalidate_power_grids();
+        /** Whether this has POWER_TRANSFER parts, only those vehicles can be part of a grid. */
+        bool has_power_cables() const;
         vehicle( const vproto_id &type_id, int init_veh_fuel = -1, int init_veh_status = -1 );
         vehicle();
         ~vehicle();
@@ -985,6 +1029,8 @@ class vehicle
 
         // returns the list of indices of parts at certain position (not accounting frame direction)
         std::vector<int> parts_at_relative( const point &dp, bool use_cache ) const;
+        /** Like parts_at_relative from the cache, but without copying the indices. */
+        mount_part_range parts_at_mount( const point &dp ) const;
 
         // returns index of part, inner to given, with certain flag, or -1
         int part_with_feature( int p, const std::string &f, bool unbroken ) const;
@@ -1822,8 +1868,13 @@ class vehicle
          * spawned with the default constructor).
          */
         vproto_id type;
-        // parts_at_relative(dp) is used a lot (to put it mildly)
-        std::map<point, std::vector<int>> relative_parts;
+        // parts_at_relative(dp) is used a lot (to put it mildly), so the parts are indexed
+        // by a grid over the bounding box of the mount points: the parts at grid tile i
+        // are mount_parts[mount_part_offsets[i]] up to mount_parts[mount_part_offsets[i + 1]]
+        std::vector<int> mount_parts;
+        std::vector<int> mount_part_offsets;
+        point mount_grid_origin;
+        point mount_grid_size;
         std::set<label> labels;            // stores labels
         std::set<std::string> tags;        // Properties of the vehicle
         // After fuel consumption, this tracks the remainder of fuel < 1, and applies it the next time.
@@ -1951,6 +2002,10 @@ class vehicle
         mutable bool in_water = false;
         // is the vehicle currently flying
         mutable bool is_flying = false;
+        // cached power_grid(), valid while power_grid_version matches power_grids_version
+        mutable std::vector<std::pair<vehicle *, int>> power_grid_cache;
+        mutable int power_grid_version = -1;
+        static int power_grids_version;
         bool flyable = true;
         int requested_z_change = 0;
 
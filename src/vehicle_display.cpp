@@ -151,7 +151,7 @@ int vehicle::print_part_list( const catacurses::window &win, int y1, const int m
     if( p < 0 || p >= static_cast<int>( parts.size() ) ) {
         return y1;
     }
-    std::vector<int> pl = this->parts_at_relative( parts[p].mount, true );
+    const mount_part_range pl = parts_at_mount( parts[p].mount );
     int y = y1;
     for( size_t i = 0; i < pl.size(); i++ ) {
         if( y >= max_y ) {
@@ -246,7 +246,7 @@ void vehicle::print_vparts_descs( const catacurses::window &win, int max_y, int
         return;
     }
 
-    std::vector<int> pl = this->parts_at_relative( parts[p].mount, true );
+    const mount_part_range pl = parts_at_mount( parts[p].mount );
     std::string msg;
 
     int lines = 0;
@@ -44,7 +44,7 @@ vehicle_part::vehicle_part( const vpart_id &vp, const point &dp, item &&obj )
     : mount( dp ), id( vp ), base( std::move( obj ) )
 {
     // Mark base item as being installed as a vehicle part
-    base.item_tags.insert( "VEHICLE" );
+    base.set_flag( "VEHICLE" );
 
     if( base.typeId() != vp->item ) {
         debugmsg( "incorrect vehicle part item, expected: %s, received: %s",
@@ -70,7 +70,7 @@ void vehicle_part::set_base( const item &new_base )
 item vehicle_part::properties_to_item() const
 {
     item tmp = base;
-    tmp.item_tags.erase( "VEHICLE" );
+    tmp.unset_flag( "VEHICLE" );
 
     // Cables get special handling: their target coordinates need to remain
     // stored, and if a cable actually drops, it should be half-connected.
@@ -79,7 +79,7 @@ item vehicle_part::properties_to_item() const
         const tripoint local_pos = here.getlocal( target.first );
         if( !here.veh_at( local_pos ) ) {
             // That vehicle ain't there no more.
-            tmp.item_tags.insert( "NO_DROP" );
+            tmp.set_flag( "NO_DROP" );
         }
 
         tmp.set_var( "source_x", target.first.x );
@@ -296,7 +296,7 @@ int vehicle_part::ammo_consume( int qty, const tripoint &pos )
     if( is_tank() && !base.contents.empty() ) {
         const int res = std::min( ammo_remaining(), qty );
         item &liquid = base.contents.legacy_front();
-        liquid.charges -= res;
+        liquid.set_charges( liquid.charges - res );
         if( liquid.charges == 0 ) {
             base.contents.clear_items();
         }
@@ -326,7 +326,7 @@ double vehicle_part::consume_energy( const itype_id &ftype, double energy_j )
             charges_to_use = fuel.charges;
             base.contents.clear_items();
         } else {
-            fuel.charges -= charges_to_use;
+            fuel.set_charges( fuel.charges - charges_to_use );
         }
         item fuel_consumed( ftype, calendar::turn, charges_to_use );
         return energy_p_mL * units::to_milliliter<int>( fuel_consumed.volume( true ) );
@@ -413,7 +413,7 @@ bool vehicle_part::fill_with( item &liquid, int qty )
         qty = charges_max;
     }
 
-    liquid.charges -= base.fill_with( liquid, qty );
+    liquid.set_charges( liquid.charges - base.fill_with( liquid, qty ) );
 
     return true;
 }
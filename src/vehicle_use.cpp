@@ -866,8 +866,10 @@ bool vehicle::fold_up()
     }
 
     if( can_be_folded ) {
-        bicycle.set_var( "weight", to_milligram( total_mass() ) );
-        bicycle.set_var( "volume", total_folded_volume() / units::legacy_volume_factor );
+        bicycle.set_weight_override( total_mass() );
+        // Folded vehicles keep their volume in whole legacy volume units.
+        bicycle.set_volume_override( total_folded_volume() / units::legacy_volume_factor *
+                                     units::legacy_volume_factor );
         bicycle.set_var( "name", string_format( _( "folded %s" ), name ) );
         bicycle.set_var( "vehicle_name", name );
         // TODO: a better description?
@@ -1374,10 +1376,10 @@ void vehicle::operate_planter()
                     v.erase( i );
                 } else {
                     item tmp = *i;
-                    tmp.charges = 1;
+                    tmp.set_charges( 1 );
                     tmp.set_age( 0_turns );
                     here.add_item( loc, tmp );
-                    i->charges--;
+                    i->set_charges( i->charges - 1 );
                 }
                 break;
             }
@@ -0,0 +1,2 @@
+// NOLINT(cata-header-guard)
+#define VERSION "ccc9fc1"
@@ -13,6 +13,7 @@
 #include "bionics.h"
 #include "character.h"
 #include "colony.h"
+#include "crafting_inventory_view.h"
 #include "debug.h"
 #include "inventory.h"
 #include "item.h"
@@ -443,6 +444,31 @@ VisitResponse visitable<inventory>::visit_items(
     return VisitResponse::NEXT;
 }
 
+/** @relates visitable */
+template <>
+VisitResponse visitable<crafting_inventory_view>::visit_items(
+    const std::function<VisitResponse( item *, item * )> &func )
+{
+    crafting_inventory_view *view = static_cast<crafting_inventory_view *>( this );
+    for( const std::vector<item_location> *locations : {
+             &view->own_items, &view->map_items
+         } ) {
+        for( const item_location &loc : *locations ) {
+            // Use the const getter, the view does not change the items.
+            item *it = const_cast<item *>( loc.get_item() );
+            if( it != nullptr && visit_internal( func, it ) == VisitResponse::ABORT ) {
+                return VisitResponse::ABORT;
+            }
+        }
+    }
+    for( item &it : view->pseudo_items ) {
+        if( visit_internal( func, &it ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
 /** @relates visitable */
 template <>
 VisitResponse visitable<Character>::visit_items(
@@ -710,6 +736,16 @@ std::list<item> visitable<map_cursor>::remove_items_with( const
     return res;
 }
 
+/** @relates visitable */
+template <>
+std::list<item> visitable<crafting_inventory_view>::remove_items_with( const
+        std::function<bool( const item &e )> &, int )
+{
+    // The view only refers to items owned by others, they have to be removed from there.
+    debugmsg( "Tried to remove items through a crafting inventory view" );
+    return std::list<item>();
+}
+
 /** @relates visitable */
 template <>
 std::list<item> visitable<map_selector>::remove_items_with( const
@@ -870,6 +906,37 @@ int visitable<inventory>::charges_of( const itype_id &what, int limit,
     return std::min( limit, res );
 }
 
+/** @relates visitable */
+template <>
+int visitable<crafting_inventory_view>::charges_of( const itype_id &what, int limit,
+        const std::function<bool( const item & )> &filter,
+        const std::function<void( int )> &visitor ) const
+{
+    if( what == itype_UPS ) {
+        int qty = 0;
+        qty = sum_no_wrap( qty, charges_of( itype_UPS_off ) );
+        qty = sum_no_wrap( qty, static_cast<int>( charges_of( itype_adv_UPS_off ) / 0.6 ) );
+        return std::min( qty, limit );
+    }
+    const auto &binned = static_cast<const crafting_inventory_view *>( this )->get_binned_items();
+    const auto iter = binned.find( what );
+    if( iter == binned.end() ) {
+        return 0;
+    }
+
+    int res = 0;
+    for( const safe_reference<item> &it : iter->second ) {
+        if( !it ) {
+            continue;
+        }
+        res = sum_no_wrap( res, charges_of_internal( *it, *this, what, limit, filter, visitor ) );
+        if( res >= limit ) {
+            break;
+        }
+    }
+    return std::min( limit, res );
+}
+
 /** @relates visitable */
 template <>
 int visitable<Character>::charges_of( const itype_id &what, int limit,
@@ -956,6 +1023,38 @@ int visitable<inventory>::amount_of( const itype_id &what, bool pseudo, int limi
     return std::min( limit, res );
 }
 
+/** @relates visitable */
+template <>
+int visitable<crafting_inventory_view>::amount_of( const itype_id &what, bool pseudo, int limit,
+        const std::function<bool( const item & )> &filter ) const
+{
+    const auto &binned = static_cast<const crafting_inventory_view *>( this )->get_binned_items();
+    const auto count_bin = [&]( const std::vector<safe_reference<item>> &bin ) {
+        int res = 0;
+        for( const safe_reference<item> &it : bin ) {
+            if( it ) {
+                res = sum_no_wrap( res, it->amount_of( what, pseudo, limit, filter ) );
+            }
+        }
+        return res;
+    };
+
+    int res = 0;
+    if( what.str() == "any" ) {
+        for( const auto &kv : binned ) {
+            res = sum_no_wrap( res, count_bin( kv.second ) );
+        }
+    } else {
+        const auto iter = binned.find( what );
+        if( iter == binned.end() ) {
+            return 0;
+        }
+        res = count_bin( iter->second );
+    }
+
+    return std::min( limit, res );
+}
+
 /** @relates visitable */
 template <>
 int visitable<Character>::amount_of( const itype_id &what, bool pseudo, int limit,
@@ -992,6 +1091,7 @@ bool visitable<T>::has_amount( const itype_id &what, int qty, bool pseudo,
 // explicit template initialization for all classes implementing the visitable interface
 template class visitable<item>;
 template class visitable<inventory>;
+template class visitable<crafting_inventory_view>;
 template class visitable<Character>;
 template class visitable<map_selector>;
 template class visitable<map_cursor>;
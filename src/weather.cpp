@@ -6,6 +6,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "activity_type.h"
@@ -236,7 +237,7 @@ void item::add_rain_to_container( bool acid, int charges )
     }
     item ret( "water", calendar::turn );
     const int capa = get_remaining_capacity_for_liquid( ret, true );
-    ret.charges = std::min( charges, capa );
+    ret.set_charges( std::min( charges, capa ) );
     if( contents.can_contain( ret ).success() ) {
         // This is easy. Just add 1 charge of the rain liquid to the container.
         if( !acid ) {
@@ -260,7 +261,7 @@ void item::add_rain_to_container( bool acid, int charges )
         int orig = liq.charges;
         int added = std::min( charges, capa );
         if( capa > 0 ) {
-            liq.charges += added;
+            liq.set_charges( liq.charges + added );
         }
 
         if( liq.typeId() == ret.typeId() || liq.typeId() == itype_water ) {
@@ -697,11 +698,16 @@ std::string weather_forecast( const point_abs_sm &abs_sm_pos )
     // TODO: wind direction and speed
     const time_point last_hour = calendar::turn - ( calendar::turn - calendar::turn_zero ) %
                                  1_hours;
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    std::vector<std::pair<tripoint, time_point>> queries;
+    for( time_point i = last_hour; i < last_hour + 6 * 12_hours; i += 1_hours ) {
+        queries.emplace_back( abs_ms_pos, i );
+    }
+    const std::vector<w_point> hourly = wgen.get_weather( queries, g->get_seed() );
     for( int d = 0; d < 6; d++ ) {
         weather_type_id forecast = WEATHER_NULL;
-        const auto wgen = get_weather().get_cur_weather_gen();
-        for( time_point i = last_hour + d * 12_hours; i < last_hour + ( d + 1 ) * 12_hours; i += 1_hours ) {
-            w_point w = wgen.get_weather( abs_ms_pos, i, g->get_seed() );
+        for( int h = d * 12; h < ( d + 1 ) * 12; h++ ) {
+            const w_point &w = hourly[h];
             forecast = std::max( forecast, wgen.get_weather_conditions( w, g->weather.next_instance_allowed ) );
             high = std::max( high, w.temperature );
             low = std::min( low, w.temperature );
@@ -1126,4 +1132,57 @@ void weather_manager::clear_temp_cache()
     temperature_cache.clear();
 }
 
+double weather_manager::get_past_weather_temperature( const tripoint &location,
+        const time_point &t )
+{
+    // Bounds the memory spent on places the player has long left; a month for a few
+    // hundred submaps is still well within this.
+    static constexpr size_t max_timelines = 1024;
+
+    const weather_generator &wgen = get_cur_weather_gen();
+    const unsigned seed = g->get_seed();
+    if( climate_gen != &wgen || climate_seed != seed ) {
+        climate_timelines.clear();
+        climate_gen = &wgen;
+        climate_seed = seed;
+    }
+
+    const tripoint sm = ms_to_sm_copy( location );
+    const tripoint sm_origin = sm_to_ms_copy( sm );
+    const int hour = to_hours<int>( t - calendar::turn_zero );
+    const auto hour_to_time = []( int h ) {
+        return calendar::turn_zero + time_duration::from_hours( h );
+    };
+
+    auto found = climate_timelines.find( sm );
+    if( found == climate_timelines.end() ) {
+        if( climate_timelines.size() >= max_timelines ) {
+            // Drop the timeline of the submap that was looked at the longest ago
+            climate_timelines.erase( std::min_element( climate_timelines.begin(), climate_timelines.end(),
+            []( const auto & a, const auto & b ) {
+                return a.second.last_used < b.second.last_used;
+            } ) );
+        }
+        found = climate_timelines.emplace( sm, climate_timeline() ).first;
+    }
+    climate_timeline &timeline = found->second;
+    timeline.last_used = ++climate_timeline_uses;
+    if( timeline.hourly.empty() ) {
+        timeline.first_hour = hour;
+    } else if( hour < timeline.first_hour ) {
+        std::vector<double> earlier;
+        earlier.reserve( timeline.first_hour - hour + timeline.hourly.size() );
+        for( int h = hour; h < timeline.first_hour; ++h ) {
+            earlier.push_back( wgen.get_weather_temperature( sm_origin, hour_to_time( h ), seed ) );
+        }
+        earlier.insert( earlier.end(), timeline.hourly.begin(), timeline.hourly.end() );
+        timeline.hourly = std::move( earlier );
+        timeline.first_hour = hour;
+    }
+    for( int h = timeline.first_hour + timeline.hourly.size(); h <= hour; ++h ) {
+        timeline.hourly.push_back( wgen.get_weather_temperature( sm_origin, hour_to_time( h ), seed ) );
+    }
+    return timeline.hourly[hour - timeline.first_hour];
+}
+
 ///@}
@@ -41,6 +41,7 @@ static constexpr int BODYTEMP_VERY_HOT = 8000;
 static constexpr int BODYTEMP_SCORCHING = 9500;
 ///@}
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -185,9 +186,30 @@ class weather_manager
         // Returns outdoor or indoor temperature of given location
         int get_temperature( const tripoint_abs_omt &location );
         void clear_temp_cache();
+        /**
+         * Outdoor temperature from the weather generator at the absolute map square
+         * @p location, as of the start of the hour containing @p t. Used by items catching
+         * up on time they spent outside the reality bubble. The hourly values are computed
+         * once per submap and then shared by everything in it.
+         */
+        double get_past_weather_temperature( const tripoint &location, const time_point &t );
         void on_load();
         static void serialize_all( JsonOut &json );
         static void unserialize_all( JsonIn &jsin );
+    private:
+        /** Hourly weather temperatures of one submap, starting at @ref first_hour. */
+        struct climate_timeline {
+            int first_hour = 0;
+            std::vector<double> hourly;
+            /** Value of @ref climate_timeline_uses when this was last looked at. */
+            int64_t last_used = 0;
+        };
+        /** Keyed by absolute submap position. */
+        std::unordered_map<tripoint, climate_timeline> climate_timelines;
+        int64_t climate_timeline_uses = 0;
+        /** What @ref climate_timelines was computed with; a change discards them. */
+        const weather_generator *climate_gen = nullptr;
+        unsigned climate_seed = 0;
 };
 
 weather_manager &get_weather();
@@ -6,6 +6,7 @@
 #include <random>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cata_utility.h"
 #include "game_constants.h"
@@ -70,13 +71,8 @@ static weather_gen_common get_common_data( const tripoint &location, const time_
 }
 
 static double weather_temperature_from_common_data( const weather_generator &wg,
-        const weather_gen_common &common, const time_point &t )
+        const weather_gen_common &common, const time_point &t, const double noise )
 {
-    const double x( common.x );
-    const double y( common.y );
-    const double z( common.z );
-
-    const unsigned modSEED = common.modSEED;
     const double seasonality = -common.cyf;
     // -1 in midwinter, +1 in midsummer
     const season_type season = common.season;
@@ -92,35 +88,59 @@ static double weather_temperature_from_common_data( const weather_generator &wg,
         dayv * daily_magnitude_K +
         seasonality * seasonality_magnitude_K );
 
-    const double T = baseline + raw_noise_4d( x, y, z, modSEED ) * noise_magnitude_K;
+    const double T = baseline + noise * noise_magnitude_K;
 
     // Convert from Celsius to Fahrenheit
     return T * 9 / 5 + 32;
 }
 
+static double weather_temperature_from_common_data( const weather_generator &wg,
+        const weather_gen_common &common, const time_point &t )
+{
+    return weather_temperature_from_common_data( wg, common, t,
+            raw_noise_4d( common.x, common.y, common.z, common.modSEED ) );
+}
+
 double weather_generator::get_weather_temperature( const tripoint &location, const time_point &t,
         unsigned seed ) const
 {
     return weather_temperature_from_common_data( *this, get_common_data( location, t, seed ), t );
 }
-w_point weather_generator::get_weather( const tripoint &location, const time_point &t,
-                                        unsigned seed ) const
-{
-    const weather_gen_common common = get_common_data( location, t, seed );
 
+/** The four noise values a @ref w_point is made from. */
+struct weather_noise {
+    float temperature = 0;
+    float wind = 0;
+    float humidity = 0;
+    float pressure = 0;
+};
+
+static weather_noise get_weather_noise( const weather_gen_common &common )
+{
     const double x( common.x );
     const double y( common.y );
     const double z( common.z );
-
     const unsigned modSEED = common.modSEED;
+
+    weather_noise result;
+    result.temperature = raw_noise_4d( x, y, z, modSEED );
+    result.wind = raw_noise_4d( x / 2.5, y / 2.5, z / 200, modSEED );
+    result.humidity = raw_noise_4d( x, y, z, modSEED + 101 );
+    result.pressure = raw_noise_4d( x, y, z, modSEED + 211 );
+    return result;
+}
+
+w_point weather_generator::get_weather( const weather_gen_common &common, const time_point &t,
+                                        const weather_noise &noise ) const
+{
     const double cyf( common.cyf );
     const double seasonality = -common.cyf;
     // -1 in midwinter, +1 in midsummer
     const season_type season = common.season;
 
     // Noise factors
-    const double T( weather_temperature_from_common_data( *this, common, t ) );
-    double W( raw_noise_4d( x / 2.5, y / 2.5, z / 200, modSEED ) * 10.0 );
+    const double T( weather_temperature_from_common_data( *this, common, t, noise.temperature ) );
+    double W( noise.wind * 10.0 );
 
     // Humidity variation
     double mod_h( 0 );
@@ -137,13 +157,13 @@ w_point weather_generator::get_weather( const tripoint &location, const time_poi
     double H = std::min( 100., std::max( 0.,
                                          base_humidity + mod_h + 100 * (
                                                  .15 * seasonality +
-                                                 raw_noise_4d( x, y, z, modSEED + 101 ) *
+                                                 noise.humidity *
                                                  .2 * ( -seasonality + 2 ) ) ) );
 
     // Pressure
     double P =
         base_pressure +
-        raw_noise_4d( x, y, z, modSEED + 211 ) *
+        noise.pressure *
         10 * ( -seasonality + 2 );
 
     // Wind power
@@ -166,6 +186,60 @@ w_point weather_generator::get_weather( const tripoint &location, const time_poi
     return w_point{ T, H, P, W, wind_desc, current_winddir, t };
 }
 
+w_point weather_generator::get_weather( const tripoint &location, const time_point &t,
+                                        unsigned seed ) const
+{
+    const weather_gen_common common = get_common_data( location, t, seed );
+    return get_weather( common, t, get_weather_noise( common ) );
+}
+
+std::vector<w_point> weather_generator::get_weather(
+    const std::vector<std::pair<tripoint, time_point>> &queries, unsigned seed ) const
+{
+    const size_t n = queries.size();
+    std::vector<weather_gen_common> common;
+    common.reserve( n );
+    for( const std::pair<tripoint, time_point> &q : queries ) {
+        common.push_back( get_common_data( q.first, q.second, seed ) );
+    }
+
+    // All four noise values of every query in one batch: temperature, wind, humidity, pressure.
+    std::vector<float> x( n * 4 );
+    std::vector<float> y( n * 4 );
+    std::vector<float> z( n * 4 );
+    std::vector<float> w( n * 4 );
+    for( size_t i = 0; i < n; ++i ) {
+        const weather_gen_common &c = common[i];
+        const float seeds[4] = {
+            static_cast<float>( c.modSEED ), static_cast<float>( c.modSEED ),
+            static_cast<float>( c.modSEED + 101 ), static_cast<float>( c.modSEED + 211 )
+        };
+        for( size_t k = 0; k < 4; ++k ) {
+            x[k * n + i] = c.x;
+            y[k * n + i] = c.y;
+            z[k * n + i] = c.z;
+            w[k * n + i] = seeds[k];
+        }
+        x[n + i] = c.x / 2.5;
+        y[n + i] = c.y / 2.5;
+        z[n + i] = c.z / 200;
+    }
+    std::vector<float> noise( n * 4 );
+    raw_noise_4d( x.data(), y.data(), z.data(), w.data(), noise.data(), n * 4 );
+
+    std::vector<w_point> result;
+    result.reserve( n );
+    for( size_t i = 0; i < n; ++i ) {
+        weather_noise wn;
+        wn.temperature = noise[i];
+        wn.wind = noise[n + i];
+        wn.humidity = noise[2 * n + i];
+        wn.pressure = noise[3 * n + i];
+        result.push_back( get_weather( common[i], queries[i].second, wn ) );
+    }
+    return result;
+}
+
 weather_type_id weather_generator::get_weather_conditions( const tripoint &location,
         const time_point &t, unsigned seed,
         std::map<weather_type_id, time_point> &next_instance_allowed ) const
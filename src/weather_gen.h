@@ -5,6 +5,7 @@
 #include <climits>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "calendar.h"
@@ -14,6 +15,8 @@
 
 class JsonObject;
 struct tripoint;
+struct weather_gen_common;
+struct weather_noise;
 
 struct w_point {
     double temperature = 0;
@@ -58,6 +61,12 @@ class weather_generator
          * relative position (relative to the map you called getabs on).
          */
         w_point get_weather( const tripoint &, const time_point &, unsigned ) const;
+        /**
+         * Same as the above for each (location, time) query, in order, but with the noise of
+         * all queries evaluated in one batch.
+         */
+        std::vector<w_point> get_weather( const std::vector<std::pair<tripoint, time_point>> &queries,
+                                          unsigned seed ) const;
         weather_type_id get_weather_conditions( const tripoint &, const time_point &,
                                                 unsigned seed, std::map<weather_type_id, time_point> &next_instance_allowed ) const;
         weather_type_id get_weather_conditions( const w_point &,
@@ -71,6 +80,9 @@ class weather_generator
         double get_weather_temperature( const tripoint &, const time_point &, unsigned ) const;
 
         static weather_generator load( const JsonObject &jo );
+    private:
+        w_point get_weather( const weather_gen_common &, const time_point &,
+                             const weather_noise & ) const;
 };
 
 #endif // CATA_SRC_WEATHER_GEN_H
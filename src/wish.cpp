@@ -573,7 +573,7 @@ void debug_menu::wishitem( player *p, const tripoint &pos )
                 granted = granted.in_its_container();
             }
             if( cb.has_flag ) {
-                granted.item_tags.insert( cb.flag );
+                granted.set_flag( cb.flag );
             }
             // If the item has an ammunition, this loads it to capacity, including magazines.
             if( !granted.ammo_default().is_null() ) {
@@ -597,7 +597,7 @@ void debug_menu::wishitem( player *p, const tripoint &pos )
                 if( p != nullptr ) {
                     if( granted.count_by_charges() ) {
                         if( amount > 0 ) {
-                            granted.charges = amount;
+                            granted.set_charges( amount );
                             if( p->can_stash( granted ) ) {
                                 p->i_add( granted );
                             } else {
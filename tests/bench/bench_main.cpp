@@ -0,0 +1,345 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_utility.h"
+#include "debug.h"
+#include "game.h"
+#include "game_state_helpers.h"
+#include "item.h"
+#include "json.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "point.h"
+#include "rng.h"
+#include "sounds.h"
+#include "type_id.h"
+#include "vehicle.h"
+#include "weather.h"
+#include "worldfactory.h"
+
+// cata_bench runs a scripted scenario for a number of turns without any UI and reports
+// where the time went as JSON, so that builds can be compared on the same seed.
+
+static std::atomic<unsigned long long> allocation_count( 0 );
+
+void *operator new( std::size_t size )
+{
+    allocation_count.fetch_add( 1, std::memory_order_relaxed );
+    if( void *p = std::malloc( size ? size : 1 ) ) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete( void *p ) noexcept
+{
+    std::free( p );
+}
+
+void operator delete( void *p, std::size_t ) noexcept
+{
+    std::free( p );
+}
+
+static const trait_id trait_DEBUG_NODMG( "DEBUG_NODMG" );
+
+static const vproto_id vehicle_prototype_car( "car" );
+
+static const tripoint bench_center( 60, 60, 0 );
+
+/** Vehicles of the convoy scenario and the point each is moved back to after every turn. */
+static std::vector<std::pair<vehicle *, tripoint>> convoy;
+
+static void build_walls( const tripoint &min, const tripoint &max )
+{
+    map &here = get_map();
+    for( const tripoint &p : here.points_in_rectangle( min, max ) ) {
+        if( p.x == min.x || p.x == max.x || p.y == min.y || p.y == max.y ) {
+            here.ter_set( p, ter_id( "t_wall_wood" ) );
+        }
+    }
+}
+
+// A walled shelter surrounded by zombies.
+static void setup_horde()
+{
+    build_test_map( ter_id( "t_dirt" ) );
+    build_walls( bench_center + tripoint( -4, -4, 0 ), bench_center + tripoint( 4, 4, 0 ) );
+    for( int i = 0; i < 64; ++i ) {
+        // Four lines of zombies, one on each side of the shelter
+        const int along = i / 4 - 8;
+        const tripoint sides[] = {
+            { along, -14, 0 }, { 14, along, 0 }, { -along, 14, 0 }, { -14, -along, 0 }
+        };
+        spawn_test_monster( "mon_zombie", bench_center + sides[i % 4] );
+    }
+}
+
+// A block of furnished rooms set on fire in a few places.
+static void setup_fire()
+{
+    map &here = get_map();
+    build_test_map( ter_id( "t_floor" ) );
+    const tripoint block_min = bench_center + tripoint( -20, -20, 0 );
+    for( int x = 0; x < 5; ++x ) {
+        for( int y = 0; y < 5; ++y ) {
+            const tripoint room = block_min + tripoint( x * 8, y * 8, 0 );
+            build_walls( room, room + tripoint( 8, 8, 0 ) );
+            for( int i = 2; i < 7; i += 2 ) {
+                here.furn_set( room + tripoint( i, 2, 0 ), furn_id( "f_bookcase" ) );
+                here.furn_set( room + tripoint( i, 5, 0 ), furn_id( "f_table" ) );
+            }
+        }
+    }
+    for( const point &p : {
+             point( 4, 4 ), point( 20, 12 ), point( 36, 28 ), point( 12, 36 )
+         } ) {
+        here.add_field( block_min + p, field_type_id( "fd_fire" ), 3 );
+    }
+    // Watch from outside of the block
+    get_avatar().setpos( bench_center + tripoint( -30, -30, 0 ) );
+}
+
+// A column of cars cruising, moved back to their start after every turn.
+static void setup_convoy()
+{
+    map &here = get_map();
+    build_test_map( ter_id( "t_pavement" ) );
+    for( int i = 0; i < 6; ++i ) {
+        const tripoint start = bench_center + tripoint( -20, -30 + i * 10, 0 );
+        vehicle *veh = here.add_vehicle( vehicle_prototype_car, start, -90, 100, 0 );
+        if( veh == nullptr ) {
+            debugmsg( "cata_bench failed to place a car at %s", start.to_string() );
+            continue;
+        }
+        veh->tags.insert( "IN_CONTROL_OVERRIDE" );
+        veh->engine_on = true;
+        veh->cruise_velocity = std::min( 30 * 100, veh->safe_ground_velocity( false ) );
+        veh->velocity = veh->cruise_velocity;
+        convoy.emplace_back( veh, veh->global_pos3() );
+    }
+}
+
+// A large base full of food rotting and lit candles.
+static void setup_base()
+{
+    map &here = get_map();
+    build_test_map( ter_id( "t_floor" ) );
+    build_walls( bench_center + tripoint( -25, -25, 0 ), bench_center + tripoint( 25, 25, 0 ) );
+    item candle( "candle_lit" );
+    candle.activate();
+    const item food( "meat_cooked" );
+    for( const tripoint &p : here.points_in_rectangle( bench_center + tripoint( -20, -20, 0 ),
+            bench_center + tripoint( 20, 20, 0 ) ) ) {
+        if( ( p.x + p.y ) % 3 == 0 ) {
+            here.add_item( p, food );
+        }
+        if( p.x % 8 == 0 && p.y % 8 == 0 ) {
+            here.add_item( p, candle );
+        }
+    }
+}
+
+static bool setup_scenario( const std::string &scenario )
+{
+    clear_map();
+    clear_vehicles();
+    avatar &player_character = get_avatar();
+    player_character.setpos( bench_center );
+    player_character.set_mutation( trait_DEBUG_NODMG );
+    if( scenario == "horde" ) {
+        setup_horde();
+    } else if( scenario == "fire" ) {
+        setup_fire();
+    } else if( scenario == "convoy" ) {
+        setup_convoy();
+    } else if( scenario == "base" ) {
+        setup_base();
+    } else {
+        return false;
+    }
+    map &here = get_map();
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0, true );
+    return true;
+}
+
+/** Milliseconds spent in each stage of the turn, in the order they run. */
+using stage_times = std::vector<std::pair<std::string, double>>;
+
+template<typename Stage>
+static void time_stage( stage_times &times, size_t &index, const char *name, Stage stage )
+{
+    const auto start = std::chrono::steady_clock::now();
+    stage();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() -
+            start;
+    if( times.size() <= index ) {
+        times.emplace_back( name, 0.0 );
+    }
+    times[index++].second += elapsed.count();
+}
+
+// The world side of game::do_turn, which itself waits for player input.
+static void simulate_turn( stage_times &times )
+{
+    map &here = get_map();
+    avatar &player_character = get_avatar();
+    size_t index = 0;
+    calendar::turn += 1_turns;
+    player_character.moves = 0;
+    time_stage( times, index, "weather", []() {
+        get_weather().update_weather();
+    } );
+    time_stage( times, index, "floor_caches", [&here]() {
+        here.build_floor_caches();
+        here.process_falling();
+    } );
+    time_stage( times, index, "vehmove", [&here]() {
+        here.vehmove();
+        for( const std::pair<vehicle *, tripoint> &veh : convoy ) {
+            here.displace_vehicle( *veh.first, veh.second - veh.first->global_pos3() );
+        }
+    } );
+    time_stage( times, index, "process_fields", [&here]() {
+        here.process_fields();
+    } );
+    time_stage( times, index, "process_items", [&here]() {
+        here.process_items();
+    } );
+    time_stage( times, index, "creature_in_field", [&here, &player_character]() {
+        here.creature_in_field( player_character );
+    } );
+    time_stage( times, index, "process_sounds", []() {
+        sounds::process_sounds();
+    } );
+    time_stage( times, index, "build_map_cache", [&here]() {
+        here.build_map_cache( here.get_abs_sub().z, true );
+    } );
+    time_stage( times, index, "monmove", []() {
+        g->monmove();
+    } );
+    time_stage( times, index, "player", [&player_character]() {
+        player_character.process_turn();
+    } );
+}
+
+static long peak_rss_kb()
+{
+#if defined(_WIN32)
+    return -1;
+#else
+    rusage usage;
+    if( getrusage( RUSAGE_SELF, &usage ) != 0 ) {
+        return -1;
+    }
+#if defined(__APPLE__)
+    // Reported in bytes rather than kilobytes
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+static std::string extract_argument( std::vector<std::string> &args, const std::string &tag,
+                                     const std::string &default_value )
+{
+    for( auto iter = args.begin(); iter != args.end(); ++iter ) {
+        if( string_starts_with( *iter, tag ) ) {
+            const std::string value = iter->substr( tag.size() );
+            args.erase( iter );
+            return value;
+        }
+    }
+    return default_value;
+}
+
+int main( int argc, const char *argv[] )
+{
+    std::vector<std::string> args( argv + 1, argv + argc );
+    const std::string scenario = extract_argument( args, "--scenario=", "horde" );
+    const int turns = std::atoi( extract_argument( args, "--turns=", "100" ).c_str() );
+    const unsigned int seed = static_cast<unsigned int>( std::strtoul( extract_argument( args,
+                              "--rng-seed=", "42" ).c_str(), nullptr, 10 ) );
+    std::string user_dir = extract_argument( args, "--user-dir=", "./bench_user_dir/" );
+    if( !string_ends_with( user_dir, "/" ) ) {
+        user_dir += "/";
+    }
+    if( !args.empty() || turns <= 0 ) {
+        printf( "Usage: cata_bench [options]\n" );
+        printf( "  --scenario=<name>            horde, fire, convoy or base (default horde).\n" );
+        printf( "  --turns=<n>                  Number of turns to simulate (default 100).\n" );
+        printf( "  --rng-seed=<seed>            Seed of the world and of the turns (default 42).\n" );
+        printf( "  --user-dir=<dir>             Set user dir (where the bench world is created).\n" );
+        return args.size() == 1 && ( args[0] == "-h" || args[0] == "--help" ) ? 0 : 1;
+    }
+
+    test_mode = true;
+    setupDebug( DebugOutput::std_err );
+
+    srand( seed );
+    rng_set_engine_seed( seed );
+    try {
+        option_overrides_t no_overrides;
+        init_global_game_state( { mod_id( "test_data" ) }, no_overrides, user_dir );
+    } catch( const std::exception &err ) {
+        fprintf( stderr, "Terminated: %s\n", err.what() );
+        return EXIT_FAILURE;
+    }
+
+    // Reseed so the scenario doesn't depend on how much randomness loading used up
+    srand( seed );
+    rng_set_engine_seed( seed );
+    if( !setup_scenario( scenario ) ) {
+        fprintf( stderr, "Unknown scenario \"%s\"\n", scenario.c_str() );
+        world_generator->delete_world( world_generator->active_world->world_name, true );
+        return EXIT_FAILURE;
+    }
+
+    stage_times times;
+    const unsigned long long allocations_before = allocation_count.load();
+    const auto start = std::chrono::steady_clock::now();
+    for( int i = 0; i < turns; ++i ) {
+        simulate_turn( times );
+    }
+    const std::chrono::duration<double, std::milli> total = std::chrono::steady_clock::now() - start;
+    const unsigned long long allocations = allocation_count.load() - allocations_before;
+
+    JsonOut jsout( std::cout, true );
+    jsout.start_object();
+    jsout.member( "scenario", scenario );
+    jsout.member( "rng_seed", seed );
+    jsout.member( "turns", turns );
+    jsout.member( "total_ms", total.count() );
+    jsout.member( "ms_per_turn", total.count() / turns );
+    jsout.member( "subsystems_ms" );
+    jsout.start_object();
+    for( const std::pair<std::string, double> &stage : times ) {
+        jsout.member( stage.first, stage.second );
+    }
+    jsout.end_object();
+    jsout.member( "allocations", allocations );
+    jsout.member( "peak_rss_kb", peak_rss_kb() );
+    jsout.end_object();
+    std::cout << std::endl;
+
+    world_generator->delete_world( world_generator->active_world->world_name, true );
+    return debug_has_error_been_observed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
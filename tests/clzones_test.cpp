@@ -0,0 +1,48 @@
+#include "catch/catch.hpp"
+
+#include <unordered_set>
+
+#include "clzones.h"
+#include "optional.h"
+#include "point.h"
+
+TEST_CASE( "zone_area_index_queries", "[zones]" )
+{
+    zone_area_index index;
+    CHECK( index.empty() );
+    index.add( tripoint( 10, 10, 0 ), tripoint( 40, 12, 0 ) );
+    // given corners in any order, overlapping the first zone
+    index.add( tripoint( 41, 14, 0 ), tripoint( 38, 11, 0 ) );
+    index.add( tripoint( -30, -30, -2 ), tripoint( -30, -30, 1 ) );
+
+    CHECK( index.contains( tripoint( 10, 10, 0 ) ) );
+    CHECK( index.contains( tripoint( 40, 12, 0 ) ) );
+    CHECK( index.contains( tripoint( 41, 14, 0 ) ) );
+    CHECK( index.contains( tripoint( -30, -30, -1 ) ) );
+    CHECK_FALSE( index.contains( tripoint( 10, 10, 1 ) ) );
+    CHECK_FALSE( index.contains( tripoint( 9, 10, 0 ) ) );
+    CHECK_FALSE( index.contains( tripoint( 41, 10, 0 ) ) );
+
+    CHECK( index.any_near( tripoint( 5, 5, 0 ), 5 ) );
+    CHECK_FALSE( index.any_near( tripoint( 5, 5, 0 ), 4 ) );
+    CHECK_FALSE( index.any_near( tripoint( 10, 10, 1 ), 10 ) );
+
+    std::unordered_set<tripoint> seen;
+    int calls = 0;
+    index.for_each_near( tripoint( 39, 12, 0 ), 1, [&]( const tripoint & p ) {
+        seen.insert( p );
+        ++calls;
+    } );
+    // 3x3 around the point: all in the first zone, the second adds (40,13) (38,13) (39,13)
+    CHECK( calls == static_cast<int>( seen.size() ) );
+    CHECK( seen.size() == 9 );
+
+    const cata::optional<tripoint> nearest = index.nearest( tripoint( 0, 11, 0 ), 10 );
+    REQUIRE( nearest );
+    CHECK( *nearest == tripoint( 10, 11, 0 ) );
+    CHECK_FALSE( index.nearest( tripoint( 0, 11, 0 ), 9 ) );
+
+    index.clear();
+    CHECK( index.empty() );
+    CHECK_FALSE( index.contains( tripoint( 10, 10, 0 ) ) );
+}
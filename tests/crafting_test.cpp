@@ -15,6 +15,7 @@
 #include "calendar.h"
 #include "cata_utility.h"
 #include "character.h"
+#include "crafting_inventory_view.h"
 #include "game.h"
 #include "item.h"
 #include "item_pocket.h"
@@ -26,6 +27,7 @@
 #include "player_helpers.h"
 #include "point.h"
 #include "recipe.h"
+#include "recipe_availability.h"
 #include "recipe_dictionary.h"
 #include "requirements.h"
 #include "ret_val.h"
@@ -322,6 +324,9 @@ static void prep_craft( const recipe_id &rid, const std::vector<item> &tools,
     bool can_craft = r.deduped_requirements().can_make_with_inventory(
                          crafting_inv, r.get_component_filter() );
     REQUIRE( can_craft == expect_craftable );
+    // The view of the same items must agree with the copied inventory.
+    CHECK( r.deduped_requirements().can_make_with_inventory(
+               player_character.crafting_view(), r.get_component_filter() ) == can_craft );
 }
 
 static time_point midnight = calendar::turn_zero + 0_hours;
@@ -607,3 +612,90 @@ TEST_CASE( "total crafting time with or without interruption", "[crafting][time]
         }
     }
 }
+
+TEST_CASE( "crafting_view_follows_map_items", "[crafting]" )
+{
+    clear_avatar();
+    clear_map();
+    const tripoint test_origin( 60, 60, 0 );
+    Character &player_character = get_player_character();
+    player_character.setpos( test_origin );
+    map &here = get_map();
+    const itype_id hammer( "hammer" );
+    const itype_id nail( "nail" );
+
+    const tripoint near_spot = test_origin + tripoint_east;
+    const tripoint far_spot = test_origin + tripoint( PICKUP_RANGE + 2, 0, 0 );
+    here.add_item( near_spot, item( hammer ) );
+    here.add_item( far_spot, item( "screwdriver" ) );
+    {
+        const crafting_inventory_view &view = player_character.crafting_view();
+        CHECK( view.has_tools( hammer, 1 ) );
+        CHECK_FALSE( view.has_tools( itype_id( "screwdriver" ), 1 ) );
+        CHECK_FALSE( view.has_charges( nail, 1 ) );
+    }
+
+    // Items placed or removed later are seen without the character acting.
+    here.add_item( near_spot + tripoint_south, item( nail, calendar::turn, 20 ) );
+    CHECK( player_character.crafting_view().has_charges( nail, 20 ) );
+    CHECK_FALSE( player_character.crafting_view().has_charges( nail, 21 ) );
+
+    here.i_clear( near_spot );
+    CHECK_FALSE( player_character.crafting_view().has_tools( hammer, 1 ) );
+    CHECK( player_character.crafting_view().has_charges( nail, 20 ) );
+
+    // Own items count as well, as in the copied inventory.
+    player_character.i_add( item( hammer ) );
+    player_character.moves--;
+    CHECK( player_character.crafting_view().has_tools( hammer, 1 ) );
+    CHECK( player_character.crafting_inventory().has_tools( hammer, 1 ) );
+}
+
+TEST_CASE( "recipe_indexes_and_availability_cache", "[crafting]" )
+{
+    const recipe *rum = &recipe_id( "brew_rum" ).obj();
+    const itype_id molasses( "molasses" );
+    const itype_id nail( "nail" );
+    const itype_id yeast( "yeast" );
+    const auto contains = []( const std::vector<const recipe *> &v, const recipe * r ) {
+        return std::find( v.begin(), v.end(), r ) != v.end();
+    };
+
+    CHECK( contains( recipe_dict.using_item( molasses ), rum ) );
+    CHECK( contains( recipe_dict.using_quality( quality_id( "COOK" ) ), rum ) );
+    CHECK( contains( recipe_dict.producing( itype_id( "brew_rum" ) ), rum ) );
+    REQUIRE_FALSE( contains( recipe_dict.using_item( nail ), rum ) );
+
+    recipe_subset subset;
+    subset.include( rum );
+    CHECK( subset.reduce( "molass", recipe_subset::search_type::component ).size() == 1 );
+    CHECK( subset.reduce( "nail", recipe_subset::search_type::component ).size() == 0 );
+    CHECK( subset.search_result( itype_id( "brew_rum" ) ).size() == 1 );
+
+    clear_avatar();
+    clear_map();
+    Character &player_character = get_player_character();
+    const tripoint spot = player_character.pos() + tripoint_east;
+    map &here = get_map();
+
+    const crafting_inventory_view &inv = player_character.crafting_view();
+    CHECK_FALSE( player_character.recipe_availability().get( *rum, inv ).can_craft );
+
+    // Unrelated items leave the result alone.
+    here.add_item( spot, item( nail, calendar::turn, 20 ) );
+    CHECK( player_character.recipe_availability().is_cached( *rum ) );
+
+    // A component of the recipe makes it be checked again.
+    here.add_item( spot, item( yeast ) );
+    CHECK_FALSE( player_character.recipe_availability().is_cached( *rum ) );
+
+    // So does a component becoming filthy, even though the count stays the same.
+    player_character.recipe_availability().get( *rum, inv );
+    REQUIRE( player_character.recipe_availability().is_cached( *rum ) );
+    for( item &it : here.i_at( spot ) ) {
+        if( it.typeId() == yeast ) {
+            it.set_flag( flag_id( "FILTHY" ) );
+        }
+    }
+    CHECK_FALSE( player_character.recipe_availability().is_cached( *rum ) );
+}
@@ -0,0 +1,71 @@
+#include "catch/catch.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "creature_tracker.h"
+#include "game_constants.h"
+#include "map_helpers.h"
+#include "memory_fast.h"
+#include "monster.h"
+#include "mtype.h"
+#include "point.h"
+#include "type_id.h"
+
+static const mtype_id mon_zombie( "mon_zombie" );
+
+static bool in_faction( const Creature_tracker &tracker, const monster &mon )
+{
+    const auto iter = tracker.factions().find( mon.faction );
+    if( iter == tracker.factions().end() ) {
+        return false;
+    }
+    return std::find( iter->second.begin(), iter->second.end(), &mon ) != iter->second.end();
+}
+
+TEST_CASE( "creature_tracker_finds_monsters_by_location", "[monster]" )
+{
+    clear_map();
+    Creature_tracker tracker;
+
+    const tripoint first_pos( 10, 10, 0 );
+    const tripoint second_pos( 20, 15, -1 );
+    const tripoint outside_pos( MAPSIZE_X + 5, 3, 0 );
+    const shared_ptr_fast<monster> first = make_shared_fast<monster>( mon_zombie, first_pos );
+    const shared_ptr_fast<monster> second = make_shared_fast<monster>( mon_zombie, second_pos );
+    const shared_ptr_fast<monster> outside = make_shared_fast<monster>( mon_zombie, outside_pos );
+    REQUIRE( tracker.add( first ) );
+    REQUIRE( tracker.add( second ) );
+    REQUIRE( tracker.add( outside ) );
+
+    CHECK( tracker.find( first_pos ) == first );
+    CHECK( tracker.find( second_pos ) == second );
+    CHECK( tracker.find( outside_pos ) == outside );
+    CHECK( tracker.find( first_pos + tripoint_above ) == nullptr );
+    CHECK( in_faction( tracker, *first ) );
+    CHECK( in_faction( tracker, *outside ) );
+
+    const tripoint moved_pos( 11, 10, 0 );
+    REQUIRE( tracker.update_pos( *first, moved_pos ) );
+    first->spawn( moved_pos );
+    CHECK( tracker.find( first_pos ) == nullptr );
+    CHECK( tracker.find( moved_pos ) == first );
+
+    tracker.swap_positions( *first, *second );
+    CHECK( tracker.find( moved_pos ) == second );
+    CHECK( tracker.find( second_pos ) == first );
+
+    tracker.remove( *outside );
+    CHECK( tracker.find( outside_pos ) == nullptr );
+    CHECK_FALSE( in_faction( tracker, *outside ) );
+
+    first->die( nullptr );
+    CHECK( tracker.find( second_pos ) == nullptr );
+    tracker.remove_dead();
+    CHECK( tracker.size() == 1 );
+    CHECK_FALSE( in_faction( tracker, *first ) );
+
+    tracker.rebuild_cache();
+    CHECK( tracker.find( moved_pos ) == second );
+    CHECK( in_faction( tracker, *second ) );
+}
@@ -57,7 +57,7 @@ static void check_lethality( const std::string &explosive_id, const int range, f
         }
         // Set off an explosion
         item grenade( explosive_id );
-        grenade.charges = 0;
+        grenade.set_charges( 0 );
         grenade.type->invoke( get_avatar(), grenade, origin );
         // see how many monsters survive
         std::vector<Creature *> survivors = g->get_creatures_if( []( const Creature & critter ) {
@@ -120,7 +120,7 @@ static void check_vehicle_damage( const std::string &explosive_id, const std::st
 
     // Set off an explosion
     item grenade( explosive_id );
-    grenade.charges = 0;
+    grenade.set_charges( 0 );
     grenade.type->invoke( get_avatar(), grenade, origin );
 
     std::vector<int> after_hp = get_part_hp( target_vehicle );
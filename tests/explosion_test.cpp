@@ -0,0 +1,72 @@
+#include "catch/catch.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+#include "explosion.h"
+#include "field.h"
+#include "field_type.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "point.h"
+
+static const tripoint blast_origin( 60, 60, 0 );
+
+TEST_CASE( "blast_knocks_down_walls_and_continues", "[explosion]" )
+{
+    clear_map_and_put_player_underground();
+    map &here = get_map();
+    for( int y = -20; y <= 20; ++y ) {
+        here.ter_set( blast_origin + point( 3, y ), t_window );
+    }
+
+    explosion_handler::explosion( blast_origin, 1500, 0.8f, true );
+
+    CHECK( here.ter( blast_origin + point_east * 3 ) != t_window );
+    CHECK( here.get_field( blast_origin + point_east * 5, fd_fire ) != nullptr );
+    CHECK( here.get_field( blast_origin + point_west * 5, fd_fire ) != nullptr );
+}
+
+TEST_CASE( "blast_invalidates_map_caches_once_per_z_level", "[explosion]" )
+{
+    clear_map_and_put_player_underground();
+    map &here = get_map();
+    for( int y = -5; y <= 5; ++y ) {
+        here.ter_set( blast_origin + point( 3, y ), t_window );
+        here.ter_set( blast_origin + point( -3, y ), t_window );
+    }
+    const int invalidations_before = here.get_cache_invalidation_count();
+
+    explosion_handler::explosion( blast_origin, 1500, 0.8f, false );
+
+    int broken = 0;
+    for( int y = -5; y <= 5; ++y ) {
+        broken += here.ter( blast_origin + point( 3, y ) ) != t_window;
+        broken += here.ter( blast_origin + point( -3, y ) ) != t_window;
+    }
+    CHECK( broken > 3 );
+    // However many tiles were bashed, each z-level the blast reached is invalidated once.
+    CHECK( here.get_cache_invalidation_count() - invalidations_before <= 3 );
+}
+
+TEST_CASE( "blast_chain_reaction_performance", "[.]" )
+{
+    clear_map_and_put_player_underground();
+    map &here = get_map();
+    for( int y = -20; y <= 20; y += 4 ) {
+        for( int x = -20; x <= 20; ++x ) {
+            here.ter_set( blast_origin + point( x, y ), t_window );
+        }
+    }
+
+    // 20 charges cooking off one after another, as a stack of ammo or a row of tanks would.
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < 20; ++i ) {
+        explosion_handler::explosion( blast_origin + point( i - 10, 0 ), 600 );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long long diff = std::chrono::duration_cast<std::chrono::microseconds>
+                           ( end - start ).count();
+    printf( "20 chained explosions took %lld microseconds.\n", diff );
+}
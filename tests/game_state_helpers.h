@@ -0,0 +1,20 @@
+#pragma once
+#ifndef CATA_TESTS_GAME_STATE_HELPERS_H
+#define CATA_TESTS_GAME_STATE_HELPERS_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "type_id.h"
+
+using name_value_pair_t = std::pair<std::string, std::string>;
+using option_overrides_t = std::vector<name_value_pair_t>;
+
+// Creates a new world with the given mods in user_dir and loads the game data, the
+// avatar and the map around the origin, as the tests and cata_bench run on.
+void init_global_game_state( const std::vector<mod_id> &mods,
+                             option_overrides_t &option_overrides,
+                             const std::string &user_dir );
+
+#endif // CATA_TESTS_GAME_STATE_HELPERS_H
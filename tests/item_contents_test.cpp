@@ -1,10 +1,15 @@
 #include "catch/catch.hpp"
 #include "item_contents.h"
 
+#include <list>
+#include <sstream>
 #include <string>
 
+#include "calendar.h"
 #include "item.h"
 #include "item_pocket.h"
+#include "json.h"
+#include "optional.h"
 #include "point.h"
 #include "ret_val.h"
 #include "type_id.h"
@@ -71,3 +76,68 @@ TEST_CASE( "item_contents" )
     tool_belt.spill_contents( tripoint_zero );
     CHECK( tool_belt.contents.empty() );
 }
+
+TEST_CASE( "contents_weight_follows_changes", "[item][pocket]" )
+{
+    item backpack( "test_backpack" );
+    item jug( "test_jug_plastic" );
+    jug.put_in( item( "water_clean", calendar::turn_zero, 10 ), item_pocket::pocket_type::CONTAINER );
+    REQUIRE( backpack.put_in( jug, item_pocket::pocket_type::CONTAINER ).success() );
+
+    const units::mass empty_backpack = item( "test_backpack" ).weight();
+    const units::mass water_charge = item( "water_clean", calendar::turn_zero, 1 ).weight();
+    CHECK( backpack.weight() == empty_backpack + jug.weight() );
+
+    item &contained_jug = *backpack.contents.all_items_top().front();
+    item &water = *contained_jug.contents.all_items_top().front();
+    const units::mass before = backpack.weight();
+    water.mod_charges( -4 );
+    CHECK( backpack.weight() == before - water_charge * 4 );
+
+    contained_jug.set_weight_override( 5_kilogram );
+    CHECK( backpack.weight() == empty_backpack + 5_kilogram + water_charge * 6 );
+    contained_jug.set_weight_override( cata::nullopt );
+    CHECK( backpack.weight() == before - water_charge * 4 );
+
+    water.set_charges( 2 );
+    CHECK( backpack.weight() == before - water_charge * 8 );
+
+    // Copies have their own pockets, changing one leaves the other alone.
+    item copy = backpack;
+    item &copied_water = *copy.contents.all_items_top().front()->contents.all_items_top().front();
+    copied_water.set_charges( 1 );
+    CHECK( copy.weight() == before - water_charge * 9 );
+    CHECK( backpack.weight() == before - water_charge * 8 );
+    water.set_charges( 3 );
+    CHECK( copy.weight() == before - water_charge * 9 );
+    CHECK( backpack.weight() == before - water_charge * 7 );
+}
+
+TEST_CASE( "weight_and_volume_overrides_are_saved", "[item]" )
+{
+    item folded( "test_box" );
+    folded.set_weight_override( 12345_gram );
+    folded.set_volume_override( 7_liter );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    folded.serialize( jsout );
+    std::istringstream is( os.str() );
+    JsonIn jsin( is );
+    item loaded;
+    loaded.deserialize( jsin );
+    CHECK( loaded.weight() == 12345_gram );
+    CHECK( loaded.volume() == 7_liter );
+    CHECK( loaded.stacks_with( folded ) );
+    CHECK_FALSE( loaded.stacks_with( item( "test_box" ) ) );
+
+    // Older saves stored the overrides as item variables.
+    std::istringstream legacy( R"({"typeid":"test_box","item_vars":{"weight":"2000000","volume":"8"}})" );
+    JsonIn legacy_jsin( legacy );
+    item migrated;
+    migrated.deserialize( legacy_jsin );
+    CHECK( migrated.weight() == 2_kilogram );
+    CHECK( migrated.volume() == 2_liter );
+    CHECK_FALSE( migrated.has_var( "weight" ) );
+    CHECK_FALSE( migrated.has_var( "volume" ) );
+}
@@ -9,6 +9,7 @@
 
 #include "calendar.h"
 #include "enums.h"
+#include "flag.h"
 #include "item_factory.h"
 #include "item_pocket.h"
 #include "itype.h"
@@ -33,9 +34,9 @@ TEST_CASE( "item_volume", "[item]" )
          } ) {
         INFO( "checking batteries that fit in " << v );
         const int charges_that_should_fit = i.charges_per_volume( v );
-        i.charges = charges_that_should_fit;
+        i.set_charges( charges_that_should_fit );
         CHECK( i.volume() <= v ); // this many charges should fit
-        i.charges++;
+        i.set_charges( i.charges + 1 );
         CHECK( i.volume() > v ); // one more charge should not fit
     }
 }
@@ -209,3 +210,39 @@ TEST_CASE( "corpse length sanity check", "[item]" )
         assert_minimum_length_to_volume_ratio( sample );
     }
 }
+
+TEST_CASE( "item_flag_ids", "[item][flag]" )
+{
+    const flag_id waterproof( "WATERPROOF" );
+    CHECK( waterproof == flag_id( "WATERPROOF" ) );
+    CHECK( waterproof.id().str() == "WATERPROOF" );
+    CHECK( waterproof.is_valid() );
+    // Undefined flags are interned as well, but are not valid definitions.
+    const flag_id undefined( "TEST_UNDEFINED_FLAG" );
+    CHECK( undefined != waterproof );
+    CHECK_FALSE( undefined.is_valid() );
+
+    item i( "jumpsuit" );
+    REQUIRE_FALSE( i.has_flag( waterproof ) );
+    i.set_flag( "WATERPROOF" );
+    CHECK( i.has_flag( waterproof ) );
+    CHECK( i.has_own_flag( "WATERPROOF" ) );
+    CHECK( i.get_flags().count( "WATERPROOF" ) );
+    i.unset_flag( waterproof );
+    CHECK_FALSE( i.has_flag( "WATERPROOF" ) );
+    CHECK( i.get_flags().empty() );
+
+    // Flags of the type are visible through the item, but are not its own.
+    for( const std::string &tag : i.type->item_tags ) {
+        CHECK( i.has_flag( tag ) );
+        CHECK( i.type->has_flag( flag_id( tag ) ) );
+        CHECK_FALSE( i.has_own_flag( tag ) );
+    }
+
+    // Testing by string doesn't intern flags no item can have.
+    CHECK_FALSE( i.has_flag( "TEST_NEVER_INTERNED_FLAG" ) );
+    CHECK_FALSE( i.has_own_flag( "TEST_NEVER_INTERNED_FLAG" ) );
+    CHECK_FALSE( i.type->has_flag( "TEST_NEVER_INTERNED_FLAG" ) );
+    CHECK( json_flag::lookup( "TEST_NEVER_INTERNED_FLAG" ) == flag_id() );
+    CHECK( json_flag::lookup( "WATERPROOF" ) == waterproof );
+}
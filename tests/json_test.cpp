@@ -77,3 +77,44 @@ TEST_CASE( "serialize_set", "[json]" )
     std::set<body_part> enum_set = { bp_foot_l };
     test_serialization( enum_set, string_format( R"([%d])", static_cast<int>( bp_foot_l ) ) );
 }
+
+TEST_CASE( "jsonobject_member_lookup", "[json]" )
+{
+    std::istringstream is(
+        R"({"zeta":1,"alpha":true,"mid":2.5,"neg":-3,"big":1e3,"frac":1.5,"s":"str","o":{"a":0}})" );
+    JsonIn jsin( is );
+    JsonObject jo = jsin.get_object();
+
+    CHECK( jo.size() == 8 );
+    CHECK( jo.has_member( "zeta" ) );
+    CHECK_FALSE( jo.has_member( "missing" ) );
+    CHECK( jo.has_number( "mid" ) );
+    CHECK_FALSE( jo.has_number( "alpha" ) );
+    CHECK( jo.has_bool( "alpha" ) );
+    CHECK_FALSE( jo.has_bool( "s" ) );
+
+    CHECK( jo.get_int( "zeta" ) == 1 );
+    CHECK( jo.get_int( "neg", 0 ) == -3 );
+    CHECK( jo.get_int( "big" ) == 1000 );
+    CHECK( jo.get_int( "missing", 7 ) == 7 );
+    CHECK( jo.get_bool( "alpha" ) );
+    CHECK( jo.get_float( "mid" ) == Approx( 2.5 ) );
+    CHECK( jo.get_float( "zeta", 0.0 ) == Approx( 1.0 ) );
+    CHECK_THROWS_AS( jo.get_int( "frac" ), JsonError );
+    CHECK( jo.get_string( "s" ) == "str" );
+    CHECK( jo.get_object( "o" ).get_int( "a" ) == 0 );
+
+    // Iteration order is sorted by member name.
+    std::vector<std::string> names;
+    for( const JsonMember &member : jo ) {
+        names.push_back( member.name() );
+    }
+    CHECK( names == std::vector<std::string> { "alpha", "big", "frac", "mid", "neg", "o", "s", "zeta" } );
+}
+
+TEST_CASE( "jsonobject_duplicate_member", "[json]" )
+{
+    std::istringstream is( R"({"a":1,"b":2,"a":3})" );
+    JsonIn jsin( is );
+    CHECK_THROWS_AS( jsin.get_object(), JsonError );
+}
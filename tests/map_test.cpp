@@ -2,6 +2,7 @@
 #include "map.h"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "avatar.h"
@@ -10,7 +11,10 @@
 #include "game.h"
 #include "game_constants.h"
 #include "map_helpers.h"
+#include "map_iterator.h"
+#include "mapdata.h"
 #include "point.h"
+#include "regional_settings.h"
 #include "type_id.h"
 
 TEST_CASE( "destroy_grabbed_furniture" )
@@ -92,3 +96,74 @@ TEST_CASE( "place_player_can_safely_move_multiple_submaps" )
     g->place_player( tripoint_zero );
     CHECK( get_map().check_submap_active_item_consistency().empty() );
 }
+
+TEST_CASE( "terrain_and_furniture_flag_ids" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint p( 60, 60, 0 );
+    here.ter_set( p, ter_id( "t_dirt" ) );
+    here.furn_set( p, furn_id( "f_chair" ) );
+
+    for( const std::string &flag : ter_id( "t_dirt" )->get_flags() ) {
+        CHECK( ter_id( "t_dirt" )->has_flag( flag_id( flag ) ) );
+        CHECK( here.has_flag_ter( flag_id( flag ), p ) );
+    }
+    for( const std::string &flag : furn_id( "f_chair" )->get_flags() ) {
+        CHECK( furn_id( "f_chair" )->has_flag( flag_id( flag ) ) );
+        CHECK( here.has_flag_furn( flag_id( flag ), p ) );
+    }
+    CHECK( here.has_flag( flag_id( "DIGGABLE" ), p ) == here.has_flag( TFLAG_DIGGABLE, p ) );
+    CHECK_FALSE( here.has_flag_ter_or_furn( flag_id( "TEST_UNDEFINED_TERRAIN_FLAG" ), p ) );
+}
+
+TEST_CASE( "set_tiles_direct_matches_per_tile_writes" )
+{
+    clear_map();
+    tinymap m;
+    m.load( tripoint_abs_sm( 0, 0, 0 ), false );
+    const point size( SEEX * 2, SEEY * 2 );
+    std::vector<ter_furn_id> tiles( size.x * size.y );
+    for( int x = 0; x < size.x; ++x ) {
+        tiles[x].ter = ter_id( "t_wall" );
+    }
+    tiles[size.x + 3].furn = furn_id( "f_chair" );
+    tiles[2 * size.x + 5].ter = ter_id( "t_floor" );
+    tiles[2 * size.x + 5].furn = furn_id( "f_table" );
+
+    const auto reset = [&]() {
+        m.draw_fill_background( ter_id( "t_grass" ) );
+        for( const tripoint &p : m.points_on_zlevel() ) {
+            m.furn_set( p, f_null );
+        }
+    };
+    const auto snapshot = [&]() {
+        std::vector<std::pair<ter_id, furn_id>> result;
+        for( const tripoint &p : m.points_on_zlevel() ) {
+            result.emplace_back( m.ter( p ), m.furn( p ) );
+        }
+        return result;
+    };
+
+    for( int turns = 0; turns < 4; ++turns ) {
+        INFO( "turns " << turns );
+        reset();
+        for( int y = 0; y < size.y; ++y ) {
+            for( int x = 0; x < size.x; ++x ) {
+                const ter_furn_id &tile = tiles[y * size.x + x];
+                if( tile.ter != t_null ) {
+                    m.ter_set( point( x, y ), tile.ter );
+                }
+                if( tile.furn != f_null ) {
+                    m.furn_set( point( x, y ), tile.furn );
+                }
+            }
+        }
+        m.rotate( turns );
+        const std::vector<std::pair<ter_id, furn_id>> expected = snapshot();
+
+        reset();
+        m.set_tiles_direct( point_zero, size, tiles, turns );
+        CHECK( snapshot() == expected );
+    }
+}
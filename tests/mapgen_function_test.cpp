@@ -1,6 +1,24 @@
 #include "catch/catch.hpp"
 
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+
+#include "calendar.h"
+#include "cata_utility.h"
+#include "coordinates.h"
+#include "json.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
 #include "mapgen.h"
+#include "mapgen_functions.h"
+#include "mapgendata.h"
+#include "omdata.h"
+#include "overmapbuffer.h"
+#include "point.h"
+#include "regional_settings.h"
+#include "trap.h"
 #include "type_id.h"
 
 TEST_CASE( "connects_to", "[mapgen][connects]" )
@@ -88,3 +106,67 @@ TEST_CASE( "connects_to", "[mapgen][connects]" )
         CHECK( connects_to( oter_id( "sewer_nesw" ), west ) );
     }
 }
+
+// Generates every city building a number of times and prints how long that took, per building
+// and in total, so that mapgen throughput can be compared between versions.
+TEST_CASE( "city_building_mapgen_throughput", "[.][mapgen]" )
+{
+    constexpr int copies = 20;
+    const regional_settings &region = region_settings_map["default"];
+    const oter_id field( "field" );
+    long long total = 0;
+    for( const building_bin *bin : {
+             &region.city_spec.houses, &region.city_spec.shops, &region.city_spec.parks
+         } ) {
+        for( const overmap_special_id &building : bin->get_all_buildings() ) {
+            const auto start = std::chrono::high_resolution_clock::now();
+            for( int i = 0; i < copies; ++i ) {
+                for( const overmap_special_terrain &terrain : building->terrains ) {
+                    if( !terrain.terrain.is_valid() ) {
+                        continue;
+                    }
+                    fake_map m( f_null, t_dirt, tr_null, terrain.p.z );
+                    mapgendata dat( field, field, field, field, field, field, field, field, field, field,
+                                    terrain.p.z, region, m, terrain.terrain.id(), 0.0f,
+                                    calendar::start_of_cataclysm, nullptr );
+                    run_mapgen_func( terrain.terrain->get_mapgen_id(), dat );
+                }
+            }
+            const auto end = std::chrono::high_resolution_clock::now();
+            const long long diff = std::chrono::duration_cast<std::chrono::microseconds>
+                                   ( end - start ).count();
+            printf( "%s: %d copies took %lld microseconds.\n", building.c_str(), copies, diff );
+            total += diff;
+        }
+    }
+    printf( "All city buildings took %lld microseconds.\n", total );
+}
+
+TEST_CASE( "inline_update_mapgen_places_nested_chunks", "[mapgen][update]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint_abs_omt omt = project_to<coords::omt>(
+                                     tripoint_abs_ms( here.getabs( tripoint( 60, 60, 0 ) ) ) );
+    // Update mapgen is applied to the unrotated terrain, so put some there for a while.
+    const oter_id original = overmap_buffer.ter( omt );
+    overmap_buffer.ter_set( omt, oter_id( "field" ) );
+    on_out_of_scope restore_terrain( [&]() {
+        overmap_buffer.ter_set( omt, original );
+    } );
+
+    const tripoint target = here.getlocal( project_to<coords::ms>( omt ).raw() ) + point( 5, 7 );
+    here.furn_set( target, furn_id( "f_chair" ) );
+    REQUIRE( here.furn( target ) == furn_id( "f_chair" ) );
+
+    // Missions give their update_mapgen inline, the nested chunks have to be resolved as well.
+    std::istringstream is(
+        R"({ "place_nested": [ { "chunks": [ "clear_furniture" ], "x": 5, "y": 7 } ] })" );
+    JsonIn jsin( is );
+    JsonObject jo = jsin.get_object();
+    bool defer = false;
+    const mapgen_update_func update = add_mapgen_update_func( jo, defer );
+    REQUIRE_FALSE( defer );
+    update( omt, nullptr );
+    CHECK( here.furn( target ) == f_null );
+}
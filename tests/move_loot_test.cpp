@@ -0,0 +1,56 @@
+#include "catch/catch.hpp"
+
+#include <algorithm>
+
+#include "avatar.h"
+#include "clzones.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "player_activity.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "type_id.h"
+
+static const activity_id ACT_MOVE_LOOT( "ACT_MOVE_LOOT" );
+
+static const zone_type_id zone_type_LOOT_TOOLS( "LOOT_TOOLS" );
+static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
+
+TEST_CASE( "move_loot_sorts_items_into_their_zones", "[activity][zones]" )
+{
+    clear_avatar();
+    clear_map();
+    avatar &dummy = get_avatar();
+    map &here = get_map();
+    zone_manager &mgr = zone_manager::get_manager();
+    const zone_manager saved_zones = mgr;
+
+    const tripoint unsorted_start = dummy.pos() + tripoint_north_east;
+    const tripoint unsorted_end = dummy.pos() + tripoint_south_east;
+    const tripoint tools_spot = dummy.pos() + tripoint_west;
+    mgr.add( "unsorted", zone_type_LOOT_UNSORTED, your_fac, false, true,
+             here.getabs( unsorted_start ), here.getabs( unsorted_end ) );
+    mgr.add( "tools", zone_type_LOOT_TOOLS, your_fac, false, true,
+             here.getabs( tools_spot ), here.getabs( tools_spot ) );
+    // This tile is both unsorted and a tool zone, tools on it are sorted already.
+    mgr.add( "more tools", zone_type_LOOT_TOOLS, your_fac, false, true,
+             here.getabs( unsorted_end ), here.getabs( unsorted_end ) );
+
+    here.add_item( unsorted_start, item( "hammer" ) );
+    here.add_item( unsorted_start, item( "screwdriver" ) );
+    here.add_item( unsorted_end, item( "wrench" ) );
+
+    dummy.assign_activity( ACT_MOVE_LOOT );
+    process_activity( dummy );
+
+    CHECK( here.i_at( unsorted_start ).empty() );
+    CHECK( here.i_at( tools_spot ).size() + here.i_at( unsorted_end ).size() == 3 );
+    map_stack sorted_tools = here.i_at( unsorted_end );
+    CHECK( std::any_of( sorted_tools.begin(), sorted_tools.end(), []( const item & it ) {
+        return it.typeId() == itype_id( "wrench" );
+    } ) );
+
+    mgr = saved_zones;
+    mgr.cache_data();
+}
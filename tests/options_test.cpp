@@ -0,0 +1,44 @@
+#include "catch/catch.hpp"
+
+#include <string>
+
+#include "debug.h"
+#include "options.h"
+#include "options_helpers.h"
+
+TEST_CASE( "option_handle_follows_option_changes", "[options]" )
+{
+    const option_handle<int> autosave_turns( "AUTOSAVE_TURNS" );
+    const option_handle<bool> autosave( "AUTOSAVE" );
+    const option_handle<std::string> celsius( "USE_CELSIUS" );
+
+    CHECK( autosave_turns.get() == get_option<int>( "AUTOSAVE_TURNS" ) );
+    CHECK( autosave.get() == get_option<bool>( "AUTOSAVE" ) );
+    CHECK( celsius.get() == get_option<std::string>( "USE_CELSIUS" ) );
+
+    {
+        override_option opt_turns( "AUTOSAVE_TURNS", "123" );
+        override_option opt_autosave( "AUTOSAVE", "true" );
+        override_option opt_celsius( "USE_CELSIUS", "kelvin" );
+        CHECK( autosave_turns.get() == 123 );
+        CHECK( autosave );
+        CHECK( celsius.get() == "kelvin" );
+
+        get_options().get_option( "AUTOSAVE" ).setNext();
+        CHECK_FALSE( autosave );
+    }
+
+    // The overrides restored the previous values.
+    CHECK( autosave_turns.get() == get_option<int>( "AUTOSAVE_TURNS" ) );
+    CHECK( autosave.get() == get_option<bool>( "AUTOSAVE" ) );
+    CHECK( celsius.get() == get_option<std::string>( "USE_CELSIUS" ) );
+}
+
+TEST_CASE( "option_handle_unknown_option", "[options]" )
+{
+    std::string error = capture_debugmsg_during( []() {
+        const option_handle<int> missing( "NO_SUCH_OPTION" );
+        CHECK( missing.get() == 0 );
+    } );
+    CHECK( error == "option handle refers to non-existing option NO_SUCH_OPTION\n" );
+}
@@ -1,11 +1,14 @@
 #include "catch/catch.hpp"
 #include "overmap_noise.h"
 
+#include <cstddef>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "coordinates.h"
 #include "game_constants.h"
+#include "point.h"
 
 static void export_raw_noise( const std::string &filename, const om_noise::om_noise_layer &noise,
                               int width, int height )
@@ -68,3 +71,34 @@ TEST_CASE( "om_noise_layer_lake_export", "[.]" )
     export_raw_noise( "lake-map-raw.pgm", f, OMAPX * 5, OMAPY * 5 );
     export_interpreted_noise( "lake-map-interp.pgm", f, OMAPX * 5, OMAPY * 5, 0.25 );
 }
+
+static void check_noise_grid( const om_noise::om_noise_layer &noise )
+{
+    const point_om_omt min( -7, 11 );
+    const point size( 45, 30 );
+    const std::vector<float> grid = noise.noise_grid( min, size );
+    REQUIRE( grid.size() == static_cast<size_t>( size.x * size.y ) );
+    for( int y = 0; y < size.y; y++ ) {
+        for( int x = 0; x < size.x; x++ ) {
+            CHECK( grid[y * size.x + x] == noise.noise_at( min + point( x, y ) ) );
+        }
+    }
+}
+
+TEST_CASE( "om_noise_layer_noise_grid_matches_noise_at", "[overmap][noise]" )
+{
+    const point_abs_omt base( OMAPX * 3, -OMAPY );
+    check_noise_grid( om_noise::om_noise_layer_forest( base, 1920237457 ) );
+    check_noise_grid( om_noise::om_noise_layer_floodplain( base, 1920237457 ) );
+    check_noise_grid( om_noise::om_noise_layer_lake( base, 1920237457 ) );
+
+    // The cache falls back to the layer itself outside the overmap.
+    const om_noise::om_noise_layer_lake lake( base, 1920237457 );
+    const om_noise::om_noise_layer_cache cache( lake );
+    for( const point_om_omt &p : {
+             point_om_omt( 0, 0 ), point_om_omt( OMAPX - 1, OMAPY - 1 ), point_om_omt( 17, 93 ),
+             point_om_omt( -1, 5 ), point_om_omt( OMAPX, 5 )
+         } ) {
+        CHECK( cache.noise_at( p ) == lake.noise_at( p ) );
+    }
+}
@@ -1,18 +1,26 @@
 #include "catch/catch.hpp"
 #include "overmap.h"
 
+#include <algorithm>
+#include <array>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "calendar.h"
+#include "cata_utility.h"
 #include "common_types.h"
 #include "coordinates.h"
 #include "enums.h"
 #include "game_constants.h"
+#include "line.h"
 #include "omdata.h"
+#include "optional.h"
+#include "overmap_generation.h"
 #include "overmap_types.h"
 #include "overmapbuffer.h"
+#include "point.h"
 #include "type_id.h"
 
 TEST_CASE( "set_and_get_overmap_scents" )
@@ -176,3 +184,117 @@ TEST_CASE( "is_ot_match", "[overmap][terrain]" )
     }
 }
 
+
+TEST_CASE( "npc_road_path_follows_the_roads", "[overmap][pathfinding]" )
+{
+    // Open air high above some overmap, with a straight road and a detour around its middle.
+    const tripoint_abs_omt base = project_combine( point_abs_om( 5, 5 ),
+                                  tripoint_om_omt( 30, 30, 5 ) );
+    const oter_id road( "road_ns" );
+    const oter_id air( "open_air" );
+    // The overmap is shared with the other tests, put its terrain back afterwards.
+    std::map<tripoint_abs_omt, oter_id> original;
+    const auto ter_set = [&]( const tripoint_abs_omt & p, const oter_id & id ) {
+        original.emplace( p, overmap_buffer.ter( p ) );
+        overmap_buffer.ter_set( p, id );
+    };
+    on_out_of_scope restore_terrain( [&]() {
+        for( const auto &e : original ) {
+            overmap_buffer.ter_set( e.first, e.second );
+        }
+    } );
+    for( int x = 0; x <= 10; ++x ) {
+        ter_set( base + point_rel_omt( x, 0 ), road );
+    }
+    for( int y = 1; y <= 3; ++y ) {
+        ter_set( base + point_rel_omt( 4, y ), road );
+        ter_set( base + point_rel_omt( 6, y ), road );
+    }
+    ter_set( base + point_rel_omt( 5, 3 ), road );
+
+    const tripoint_abs_omt src = base;
+    const tripoint_abs_omt dest = base + point_rel_omt( 10, 0 );
+    path_type ptype;
+    ptype.only_road = true;
+
+    const auto check_route = [&]( const std::vector<tripoint_abs_omt> &path ) {
+        REQUIRE_FALSE( path.empty() );
+        CHECK( path.front() == dest );
+        CHECK( path.back() == src );
+        for( size_t i = 0; i < path.size(); ++i ) {
+            CHECK( overmap_buffer.ter( path[i] ) == road );
+            if( i > 0 ) {
+                CHECK( manhattan_dist( path[i - 1].xy(), path[i].xy() ) == 1 );
+            }
+        }
+    };
+
+    std::vector<tripoint_abs_omt> path = overmap_buffer.get_npc_path( src, dest, ptype );
+    check_route( path );
+    CHECK( path.size() == 11 );
+
+    // Cutting the straight road sends the path around the detour.
+    ter_set( base + point_rel_omt( 5, 0 ), air );
+    path = overmap_buffer.get_npc_path( src, dest, ptype );
+    check_route( path );
+    CHECK( path.size() == 17 );
+
+    // Without the detour there is no road route at all.
+    ter_set( base + point_rel_omt( 5, 3 ), air );
+    CHECK( overmap_buffer.get_npc_path( src, dest, ptype ).empty() );
+
+    // Flying does not care about the roads, but can't enter them either.
+    path_type air_ptype;
+    air_ptype.only_air = true;
+    const tripoint_abs_omt air_dest = base + point_rel_omt( 5, 0 );
+    path = overmap_buffer.get_npc_path( base + point_rel_omt( 5, -3 ), air_dest, air_ptype );
+    REQUIRE_FALSE( path.empty() );
+    CHECK( path.front() == air_dest );
+    CHECK( path.size() == 4 );
+}
+
+TEST_CASE( "overmap_generation_service_is_deterministic", "[overmap][slow]" )
+{
+    const point_abs_om west_pos( 100, 100 );
+    const point_abs_om east_pos = west_pos + point_east;
+    const std::array<cata::optional<overmap_border>, 4> no_borders;
+
+    // The east overmap is queued after its west neighbour, so it waits for it and is
+    // generated from its border.
+    std::unique_ptr<overmap> west;
+    std::unique_ptr<overmap> east;
+    {
+        overmap_generation_service service;
+        service.enqueue( std::make_unique<overmap>( west_pos ), no_borders );
+        service.enqueue( std::make_unique<overmap>( east_pos ), no_borders );
+        CHECK( service.is_queued( east_pos ) );
+        east = service.take( east_pos );
+        west = service.take( west_pos );
+        CHECK_FALSE( service.is_queued( west_pos ) );
+    }
+    REQUIRE( west );
+    REQUIRE( east );
+
+    for( const auto &kv : west->border( om_direction::type::east ).connections_out ) {
+        const std::vector<tripoint_om_omt> &continued = east->connections_out[kv.first];
+        for( const tripoint_om_omt &p : kv.second ) {
+            INFO( "connection " << kv.first.str() << " at " << p.to_string() );
+            CHECK( std::find( continued.begin(), continued.end(),
+                              tripoint_om_omt( 0, p.y(), p.z() ) ) != continued.end() );
+        }
+    }
+
+    // Generating the west overmap again gives the same terrain.
+    overmap_generation_service service;
+    service.enqueue( std::make_unique<overmap>( west_pos ), no_borders );
+    std::unique_ptr<overmap> again = service.take( west_pos );
+    REQUIRE( again );
+    int differences = 0;
+    for( int x = 0; x < OMAPX; ++x ) {
+        for( int y = 0; y < OMAPY; ++y ) {
+            const tripoint_om_omt p( x, y, 0 );
+            differences += west->ter( p ) == again->ter( p ) ? 0 : 1;
+        }
+    }
+    CHECK( differences == 0 );
+}
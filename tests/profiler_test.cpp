@@ -0,0 +1,62 @@
+#include "catch/catch.hpp"
+#include "profiler.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cata_utility.h"
+#include "filesystem.h"
+#include "json.h"
+
+static void profiled_stage()
+{
+    const profiler::zone stage( "stage" );
+    const profiler::zone inner( "inner" );
+}
+
+TEST_CASE( "profiler_sums_zones_per_turn", "[profiler]" )
+{
+    profiler::enable();
+    {
+        const profiler::zone outer( "outer" );
+        profiled_stage();
+        profiled_stage();
+    }
+    profiler::end_turn();
+
+    const std::vector<std::pair<std::string, double>> &turn = profiler::last_turn();
+    REQUIRE( turn.size() == 3 );
+    CHECK( turn[0].first == "outer" );
+    CHECK( turn[1].first == "stage" );
+    CHECK( turn[2].first == "inner" );
+    CHECK( turn[0].second >= turn[1].second );
+    CHECK( turn[1].second >= turn[2].second );
+
+    // Zones of earlier turns don't count
+    profiled_stage();
+    profiler::end_turn();
+    CHECK( profiler::last_turn().size() == 2 );
+
+    const std::string path = "./profiler_test_trace.json";
+    REQUIRE( profiler::write_trace( path ) );
+    profiler::disable();
+
+    int events = 0;
+    REQUIRE( read_from_file_json( path, [&events]( JsonIn & jsin ) {
+        JsonObject trace = jsin.get_object();
+        trace.allow_omitted_members();
+        for( JsonObject event : trace.get_array( "traceEvents" ) ) {
+            event.allow_omitted_members();
+            CHECK( event.get_string( "ph" ) == "X" );
+            CHECK( event.get_float( "dur" ) >= 0.0 );
+            ++events;
+        }
+    } ) );
+    CHECK( events == 7 );
+    remove_file( path );
+
+    // Nothing is recorded while the profiler is disabled
+    profiled_stage();
+    CHECK_FALSE( profiler::enabled() );
+}
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "test_statistics.h"
+#include "point.h"
 #include "rng.h"
 #include "optional.h"
 
@@ -79,3 +80,84 @@ TEST_CASE( "random_entry_preserves_constness" )
     i1 = 5678;
     CHECK( v1[0] == 5678 );
 }
+
+TEST_CASE( "rng_engine_scope_gives_a_separate_sequence", "[rng]" )
+{
+    const auto draw = []() {
+        std::vector<int> values;
+        for( int i = 0; i < 20; ++i ) {
+            values.push_back( rng( 0, 1000 ) );
+        }
+        return values;
+    };
+
+    const cata_default_random_engine *global_engine = &rng_get_engine();
+    std::vector<int> first;
+    std::vector<int> second;
+    {
+        cata_default_random_engine engine( 1234 );
+        rng_engine_scope use_engine( engine );
+        CHECK( &rng_get_engine() == &engine );
+        first = draw();
+    }
+    CHECK( &rng_get_engine() == global_engine );
+    // The global engine is in use again and does not disturb the scoped sequence.
+    rng( 0, 1000 );
+    {
+        cata_default_random_engine engine( 1234 );
+        rng_engine_scope use_engine( engine );
+        second = draw();
+    }
+    CHECK( first == second );
+}
+
+TEST_CASE( "normal_roll_outside_a_scope_does_not_leak_into_it", "[rng]" )
+{
+    const auto draw = []() {
+        cata_default_random_engine engine( 1234 );
+        rng_engine_scope use_engine( engine );
+        std::vector<double> values;
+        // An even number, so nothing is left over from the scope itself.
+        for( int i = 0; i < 4; ++i ) {
+            values.push_back( normal_roll( 0.0, 1.0 ) );
+        }
+        return values;
+    };
+
+    const std::vector<double> first = draw();
+    // A single roll on the global engine, a cached spare value would be left over from it.
+    normal_roll( 0.0, 1.0 );
+    CHECK( draw() == first );
+}
+
+TEST_CASE( "rng_streams_are_reproducible_and_independent", "[rng]" )
+{
+    const auto draw = []( rng_stream & stream ) {
+        std::vector<int> values;
+        for( int i = 0; i < 20; ++i ) {
+            values.push_back( rng( stream, 0, 1000 ) );
+        }
+        return values;
+    };
+    const rng_stream submaps = rng_stream_for( rng_context::submap, 42 );
+
+    rng_stream a = submaps.split( tripoint( 10, 20, 0 ) );
+    rng_stream b = submaps.split( tripoint( 10, 20, 0 ) );
+    rng_stream neighbour = submaps.split( tripoint( 11, 20, 0 ) );
+    rng_stream other_context = rng_stream_for( rng_context::creature, 42 ).split( tripoint( 10, 20,
+                               0 ) );
+    const std::vector<int> values = draw( a );
+    CHECK( values == draw( b ) );
+    CHECK( values != draw( neighbour ) );
+    CHECK( values != draw( other_context ) );
+
+    // Drawing from a stream leaves the engine of the thread alone.
+    rng_set_engine_seed( 99 );
+    const int expected = rng( 0, 1000000 );
+    rng_set_engine_seed( 99 );
+    rng_stream c = submaps.split( 7 );
+    one_in( c, 3 );
+    x_in_y( c, 1, 3 );
+    dice( c, 2, 6 );
+    CHECK( rng( 0, 1000000 ) == expected );
+}
@@ -5,9 +5,11 @@
 #include "calendar.h"
 #include "enums.h"
 #include "flat_set.h"
+#include "game.h"
 #include "item.h"
 #include "point.h"
 #include "weather.h"
+#include "weather_gen.h"
 
 static void set_map_temperature( int new_temperature )
 {
@@ -71,7 +73,7 @@ TEST_CASE( "Rate of rotting" )
         CHECK( freeze_item.get_rot() == 0_turns );
 
         // The item in freezer should still not be frozen
-        CHECK( !freeze_item.item_tags.count( "FROZEN" ) );
+        CHECK( !freeze_item.has_own_flag( "FROZEN" ) );
     }
 }
 
@@ -98,3 +100,45 @@ TEST_CASE( "Items rot away" )
         INFO( "Rot: " << to_turns<int>( test_item.get_rot() ) );
     }
 }
+
+TEST_CASE( "Rot catch-up outside the reality bubble" )
+{
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+
+    SECTION( "Shared climate timeline matches the weather generator" ) {
+        weather_manager &weather = get_weather();
+        const weather_generator &wgen = weather.get_cur_weather_gen();
+        const unsigned seed = g->get_seed();
+        // Two squares in the same submap share their hourly temperatures.
+        const tripoint sm_origin( 0, 0, 0 );
+        const time_point hour = calendar::turn_zero + 1_hours * to_hours<int>( calendar::turn -
+                                calendar::turn_zero );
+        const double expected = wgen.get_weather_temperature( sm_origin, hour, seed );
+        CHECK( weather.get_past_weather_temperature( tripoint( 5, 7, 0 ), hour + 20_minutes ) ==
+               Approx( expected ) );
+        CHECK( weather.get_past_weather_temperature( sm_origin, hour ) == Approx( expected ) );
+        // Looking further back extends the timeline without changing what is there.
+        const double earlier = wgen.get_weather_temperature( sm_origin, hour - 30_days, seed );
+        CHECK( weather.get_past_weather_temperature( sm_origin, hour - 30_days ) == Approx( earlier ) );
+        CHECK( weather.get_past_weather_temperature( sm_origin, hour ) == Approx( expected ) );
+    }
+
+    SECTION( "Constant environment rots the same in one go as hour by hour" ) {
+        item hourly_item( "flour" );
+        item batched_item( "flour" );
+        hourly_item.process( nullptr, tripoint_zero, 1, temperature_flag::ROOT_CELLAR );
+        batched_item.process( nullptr, tripoint_zero, 1, temperature_flag::ROOT_CELLAR );
+
+        for( int i = 0; i < 240; ++i ) {
+            calendar::turn += 1_hours + 1_turns;
+            hourly_item.process( nullptr, tripoint_zero, 1, temperature_flag::ROOT_CELLAR );
+        }
+        batched_item.process( nullptr, tripoint_zero, 1, temperature_flag::ROOT_CELLAR );
+
+        CHECK( to_turns<int>( batched_item.get_rot() ) ==
+               Approx( to_turns<int>( hourly_item.get_rot() ) ).epsilon( 0.01 ) );
+        CHECK( batched_item.get_rot() > 0_turns );
+    }
+}
@@ -0,0 +1,45 @@
+#include "catch/catch.hpp"
+
+#include "game_constants.h"
+#include "point.h"
+#include "sight_cache.h"
+
+TEST_CASE( "sight_cache_stores_pairs_both_ways", "[vision]" )
+{
+    sight_cache cache;
+    const tripoint a( 5, 7, 0 );
+    const tripoint b( 60, 70, -2 );
+    const tripoint c( MAPSIZE_X - 1, MAPSIZE_Y - 1, OVERMAP_HEIGHT );
+
+    CHECK( cache.get( a, b ) == -1 );
+    cache.insert( a, b, true );
+    cache.insert( a, c, false );
+    CHECK( cache.get( a, b ) == 1 );
+    CHECK( cache.get( b, a ) == 1 );
+    CHECK( cache.get( c, a ) == 0 );
+    CHECK( cache.get( b, c ) == -1 );
+
+    cache.insert( b, a, false );
+    CHECK( cache.get( a, b ) == 0 );
+
+    cache.invalidate();
+    CHECK( cache.get( a, b ) == -1 );
+    CHECK( cache.get( a, c ) == -1 );
+}
+
+TEST_CASE( "sight_cache_keeps_recent_entries_under_pressure", "[vision]" )
+{
+    sight_cache cache;
+    const tripoint origin( 0, 0, 0 );
+    // Far more pairs than the cache holds, the last one inserted must still be there.
+    tripoint last;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            for( int x = 0; x < MAPSIZE_X; ++x ) {
+                last = tripoint( x, y, z );
+                cache.insert( origin, last, ( x + y ) % 2 == 0 );
+            }
+        }
+    }
+    CHECK( cache.get( last, origin ) == ( ( last.x + last.y ) % 2 == 0 ? 1 : 0 ) );
+}
@@ -0,0 +1,51 @@
+#include "catch/catch.hpp"
+#include "simplexnoise.h"
+
+#include <cstddef>
+#include <vector>
+
+#include "rng.h"
+
+// The batched functions must return exactly what the single point versions do, including for
+// the odd leftover points that don't fill a whole block.
+TEST_CASE( "batched_simplex_noise_matches_single_points", "[noise]" )
+{
+    const size_t n = 203;
+    std::vector<float> x( n );
+    std::vector<float> y( n );
+    std::vector<float> z( n );
+    std::vector<float> w( n );
+    for( size_t i = 0; i < n; i++ ) {
+        if( i % 2 == 0 ) {
+            // Integer lattice points, as overmap generation uses.
+            x[i] = rng( -500, 500 );
+            y[i] = rng( -500, 500 );
+            z[i] = rng( 0, 1000 );
+        } else {
+            x[i] = rng_float( -500, 500 );
+            y[i] = rng_float( -500, 500 );
+            z[i] = rng_float( 0, 1000 );
+        }
+        w[i] = rng_float( -50, 50 );
+    }
+
+    std::vector<float> out( n );
+    SECTION( "raw_noise_3d" ) {
+        raw_noise_3d( x.data(), y.data(), z.data(), out.data(), n );
+        for( size_t i = 0; i < n; i++ ) {
+            CHECK( out[i] == raw_noise_3d( x[i], y[i], z[i] ) );
+        }
+    }
+    SECTION( "raw_noise_4d" ) {
+        raw_noise_4d( x.data(), y.data(), z.data(), w.data(), out.data(), n );
+        for( size_t i = 0; i < n; i++ ) {
+            CHECK( out[i] == raw_noise_4d( x[i], y[i], z[i], w[i] ) );
+        }
+    }
+    SECTION( "scaled_octave_noise_3d" ) {
+        scaled_octave_noise_3d( 8, 0.5, 0.03, 0, 1, x.data(), y.data(), z.data(), out.data(), n );
+        for( size_t i = 0; i < n; i++ ) {
+            CHECK( out[i] == scaled_octave_noise_3d( 8, 0.5, 0.03, 0, 1, x[i], y[i], z[i] ) );
+        }
+    }
+}
@@ -331,6 +331,6 @@ TEST_CASE( "time_to_throw_independent_of_number_of_projectiles", "[throwing],[ba
         } else {
             CHECK( initial_moves == cost );
         }
-        thrown.charges--;
+        thrown.set_charges( thrown.charges - 1 );
     }
 }
@@ -2,10 +2,12 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <utility>
 #include <vector>
 
 #include "calendar.h"
 #include "character.h"
+#include "item.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "point.h"
@@ -179,3 +181,70 @@ TEST_CASE( "maximum reverse velocity", "[vehicle][power][reverse]" )
     }
 }
 
+
+// Links the origin tiles of two vehicles with a jumper cable, the way the cable item does.
+static void connect_with_cable( vehicle &source, vehicle &target )
+{
+    map &here = get_map();
+    vehicle_part source_part( vpart_id( "jumper_cable" ), point_zero, item( "jumper_cable" ) );
+    source_part.target.first = here.getabs( target.global_pos3() );
+    source_part.target.second = here.getabs( target.global_pos3() );
+    source.install_part( point_zero, source_part );
+
+    vehicle_part target_part( vpart_id( "jumper_cable" ), point_zero, item( "jumper_cable" ) );
+    target_part.target.first = here.getabs( source.global_pos3() );
+    target_part.target.second = here.getabs( source.global_pos3() );
+    target.install_part( point_zero, target_part );
+}
+
+TEST_CASE( "power_grid_of_cable_connected_vehicles", "[vehicle][power]" )
+{
+    reset_player();
+    build_test_map( ter_id( "t_pavement" ) );
+    clear_vehicles();
+    map &here = get_map();
+
+    vehicle *first = here.add_vehicle( vproto_id( "reactor_test" ), tripoint( 10, 10, 0 ), 0, 0, 0 );
+    vehicle *second = here.add_vehicle( vproto_id( "reactor_test" ), tripoint( 14, 10, 0 ), 0, 0, 0 );
+    vehicle *third = here.add_vehicle( vproto_id( "reactor_test" ), tripoint( 18, 10, 0 ), 0, 0, 0 );
+    REQUIRE( first != nullptr );
+    REQUIRE( second != nullptr );
+    REQUIRE( third != nullptr );
+    for( vehicle *veh : { first, second, third } ) {
+        veh->discharge_battery( veh->fuel_left( fuel_type_battery ), false );
+        veh->charge_battery( 2000, false );
+    }
+
+    CHECK( first->power_grid().empty() );
+    CHECK( first->fuel_left( fuel_type_battery ) == 2000 );
+
+    connect_with_cable( *first, *second );
+    connect_with_cable( *second, *third );
+
+    const std::vector<std::pair<vehicle *, int>> &grid = first->power_grid();
+    REQUIRE( grid.size() == 2 );
+    CHECK( grid[0] == std::make_pair( second, 1 ) );
+    CHECK( grid[1] == std::make_pair( third, 2 ) );
+    CHECK( first->fuel_left( fuel_type_battery, true ) == 6000 );
+
+    // Draining more than the first vehicle holds takes the rest from the others,
+    // plus the 1% lost in the cable to the second one
+    CHECK( first->discharge_battery( 3000 ) == 0 );
+    CHECK( first->fuel_left( fuel_type_battery ) == 0 );
+    CHECK( second->fuel_left( fuel_type_battery ) == 990 );
+    CHECK( first->fuel_left( fuel_type_battery, true ) == 2990 );
+
+    // Unplugging the second cable cuts the third vehicle off
+    const tripoint third_pos = here.getabs( third->global_pos3() );
+    const std::vector<int> cables = second->loose_parts;
+    for( const int p : cables ) {
+        if( second->part( p ).target.second == third_pos ) {
+            second->remove_part( p );
+        }
+    }
+    third->remove_part( third->part_with_feature( point_zero, "POWER_TRANSFER", false ) );
+    second->part_removal_cleanup();
+    third->part_removal_cleanup();
+    REQUIRE( first->power_grid().size() == 1 );
+    CHECK( first->power_grid()[0].first == second );
+}
@@ -1,6 +1,7 @@
 #include "catch/catch.hpp"
 #include "vehicle.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "avatar.h"
@@ -13,6 +14,9 @@
 #include "optional.h"
 #include "point.h"
 #include "type_id.h"
+#include "veh_type.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 
 TEST_CASE( "detaching_vehicle_unboards_passengers" )
 {
@@ -76,3 +80,70 @@ TEST_CASE( "add_item_to_broken_vehicle_part" )
     const item itm2 = item( "jeans" );
     REQUIRE( !veh_ptr->add_item( *cargo_part, itm2 ) );
 }
+
+TEST_CASE( "parts_at_mount_matches_part_list" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vproto_id( "car" ), vehicle_origin, 0, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+
+    for( const vpart_reference &vp : veh_ptr->get_all_parts() ) {
+        const point mount = vp.mount();
+        const mount_part_range here_parts = veh_ptr->parts_at_mount( mount );
+        std::vector<int> indexed( here_parts.begin(), here_parts.end() );
+        std::vector<int> scanned = veh_ptr->parts_at_relative( mount, false );
+        CHECK( std::is_permutation( indexed.begin(), indexed.end(), scanned.begin(), scanned.end() ) );
+        CHECK( std::is_sorted( indexed.begin(), indexed.end(), [&]( int lhs, int rhs ) {
+            return veh_ptr->part_info( lhs ).list_order < veh_ptr->part_info( rhs ).list_order;
+        } ) );
+
+        const optional_vpart_position ovp = here.veh_at( veh_ptr->global_part_pos3( vp.part() ) );
+        REQUIRE( ovp );
+        CHECK( &ovp->vehicle() == veh_ptr );
+    }
+    CHECK( veh_ptr->parts_at_mount( point( 100, 100 ) ).empty() );
+    CHECK( veh_ptr->parts_at_mount( point( -100, -100 ) ).empty() );
+}
+
+TEST_CASE( "vehicle_move_queue_orders_by_remaining_turn" )
+{
+    vehicle slow;
+    vehicle fast;
+    vehicle stopped;
+    slow.of_turn = 0.5f;
+    fast.of_turn = 2.0f;
+    stopped.of_turn = 0.0f;
+
+    vehicle_move_queue queue;
+    queue.push( slow );
+    queue.push( fast );
+    queue.push( stopped );
+    CHECK( queue.pop() == &fast );
+
+    // Vehicles are pushed again when their turn changes, the old entry is skipped
+    fast.of_turn = 0.25f;
+    queue.push( fast );
+    slow.of_turn = 1.0f;
+    queue.push( slow );
+    CHECK( queue.pop() == &slow );
+    CHECK( queue.pop() == &fast );
+    CHECK( queue.pop() == nullptr );
+}
+
+TEST_CASE( "vehicle_cache_counts_occupied_tiles" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vproto_id( "bicycle" ), vehicle_origin, 0, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    here.reset_vehicle_cache( 0 );
+
+    const level_cache &cache = here.access_cache( 0 );
+    CHECK( cache.veh_exists_count == static_cast<int>( veh_ptr->get_points( true ).size() ) );
+    here.clear_vehicle_cache( 0 );
+    CHECK( cache.veh_exists_count == 0 );
+    CHECK_FALSE( cache.veh_in_active_range );
+}
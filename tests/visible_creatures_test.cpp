@@ -0,0 +1,78 @@
+#include "catch/catch.hpp"
+
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "creature.h"
+#include "game.h"
+#include "line.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "monster.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "type_id.h"
+
+static const efftype_id effect_blind( "blind" );
+
+static void rebuild_vision()
+{
+    g->reset_light_level();
+    map &here = get_map();
+    here.update_visibility_cache( 0 );
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0 );
+}
+
+TEST_CASE( "visible_creatures_follow_the_creatures", "[vision]" )
+{
+    clear_map();
+    clear_avatar();
+    calendar::turn = calendar::turn_zero + 12_hours;
+    avatar &u = get_avatar();
+    u.setpos( tripoint( 60, 60, 0 ) );
+    // Earlier tests may have left the sight range of a blinded player cached
+    u.recalc_sight_limits();
+    monster &zombie = spawn_test_monster( "mon_zombie", u.pos() + point( 6, 0 ) );
+    rebuild_vision();
+
+    REQUIRE( u.visible_creatures().size() == 1 );
+    const visible_creature &seen = u.visible_creatures().front();
+    CHECK( seen.critter == &zombie );
+    CHECK( seen.mon == &zombie );
+    CHECK( seen.guy == nullptr );
+    CHECK( seen.distance == 6 );
+    CHECK( seen.dir == direction::EAST );
+    CHECK( seen.attitude == Creature::Attitude::HOSTILE );
+    CHECK( u.visible_creatures_in_range( 6 ).size() == 1 );
+    CHECK( u.visible_creatures_in_range( 5 ).empty() );
+    CHECK( g->is_hostile_very_close() == nullptr );
+
+    // Moving the monster refreshes the snapshot, without rebuilding any map cache.
+    zombie.setpos( u.pos() + point( 0, -3 ) );
+    REQUIRE( u.visible_creatures().size() == 1 );
+    CHECK( u.visible_creatures().front().distance == 3 );
+    CHECK( u.visible_creatures().front().dir == direction::NORTH );
+    CHECK( g->is_hostile_very_close() == &zombie );
+    CHECK( u.hostile_creatures( 60 ).size() == 1 );
+    CHECK( u.targetable_creatures( 60, false ).size() == 1 );
+
+    // Taming the monster shows right away, in the same turn.
+    zombie.friendly = -1;
+    CHECK( u.visible_creatures().front().attitude == Creature::Attitude::FRIENDLY );
+    CHECK( u.hostile_creatures( 60 ).empty() );
+    CHECK( u.targetable_creatures( 60, false ).empty() );
+    zombie.friendly = 0;
+
+    // So does going blind.
+    u.add_effect( effect_blind, 1_minutes );
+    u.recalc_sight_limits();
+    CHECK( u.visible_creatures().empty() );
+    u.remove_effect( effect_blind );
+    u.recalc_sight_limits();
+    CHECK( u.visible_creatures().size() == 1 );
+
+    zombie.die( nullptr );
+    CHECK( u.visible_creatures().empty() );
+}
@@ -13,7 +13,8 @@ TEST_CASE( "visitable_summation" )
 
     item bottle_of_water( "bottle_plastic", calendar::turn );
     item water_in_bottle( "water", calendar::turn );
-    water_in_bottle.charges = bottle_of_water.get_remaining_capacity_for_liquid( water_in_bottle );
+    water_in_bottle.set_charges(
+        bottle_of_water.get_remaining_capacity_for_liquid( water_in_bottle ) );
     bottle_of_water.put_in( water_in_bottle, item_pocket::pocket_type::CONTAINER );
     test_inv.add_item( bottle_of_water );
 
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include "calendar.h"
@@ -117,6 +118,27 @@ TEST_CASE( "weather realism" )
     }
 }
 
+TEST_CASE( "batched_weather_matches_single_queries", "[weather]" )
+{
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    const unsigned seed = 317'024'741;
+    std::vector<std::pair<tripoint, time_point>> queries;
+    for( int i = 0; i < 37; ++i ) {
+        queries.emplace_back( tripoint( i * 250, -i * 90, 0 ), calendar::turn_zero + i * 7_hours );
+    }
+
+    const std::vector<w_point> batch = wgen.get_weather( queries, seed );
+    REQUIRE( batch.size() == queries.size() );
+    for( size_t i = 0; i < queries.size(); ++i ) {
+        const w_point single = wgen.get_weather( queries[i].first, queries[i].second, seed );
+        // Wind also draws from the global rng, so only the noise driven values are compared.
+        CHECK( batch[i].temperature == single.temperature );
+        CHECK( batch[i].humidity == single.humidity );
+        CHECK( batch[i].pressure == single.pressure );
+        CHECK( batch[i].time == single.time );
+    }
+}
+
 TEST_CASE( "local wind chill calculation", "[weather][wind_chill]" )
 {
     // `get_local_windchill` returns degrees F offset from current temperature,